@@ -40,6 +40,8 @@ simulation = {
         dirichlet_alpha = dirichlet_success
     },
     system = {
-        type = "eigenvalues"
+        type = "eigenvalues",
+        -- "dense" (1D only) or "arnoldi" for a matrix-free Krylov-Schur solve:
+        -- solver = "arnoldi", eigenvalues = 4, krylov_dimension = 30, tolerance = 1e-10
     }
 }
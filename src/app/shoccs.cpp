@@ -50,5 +50,8 @@ int main(int argc, char* argv[])
     spdlog::info("Starting shoccs");
     // auto console = spdlog::stdout_color_st("system");
 
-    ccs::simulation_run(lua["simulation"]);
+    if (lua["simulation"]["ensemble"].valid())
+        ccs::ensemble_run(lua["simulation"]);
+    else
+        ccs::simulation_run(lua["simulation"]);
 }
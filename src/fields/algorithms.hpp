@@ -6,6 +6,9 @@
 #include <range/v3/algorithm/min.hpp>
 #include <range/v3/algorithm/minmax.hpp>
 
+#include <algorithm>
+#include <cmath>
+
 namespace ccs
 {
 
@@ -48,6 +51,15 @@ constexpr auto max(T&& t)
         V{std::numeric_limits<V>::lowest()});
 }
 
+// lazily evaluated |e| / (atol + rtol max(|a|, |b|)) for the error `e` of a step which
+// took the solution from `a` to `b`
+constexpr auto weighted_error(real atol, real rtol)
+{
+    return lift([atol, rtol](auto&& e, auto&& a, auto&& b) {
+        return std::abs(e) / (atol + rtol * std::max(std::abs(a), std::abs(b)));
+    });
+}
+
 template <Vector T, Vector U>
 constexpr auto dot(T&& t, U&& u)
 {
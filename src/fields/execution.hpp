@@ -0,0 +1,313 @@
+#pragma once
+
+#include "expression.hpp"
+#include "parallel/thread_pool.hpp"
+
+#include <cassert>
+#include <limits>
+#include <span>
+#include <vector>
+
+#include <range/v3/view/zip.hpp>
+
+//
+// Elementwise assignment, out[i] op= in[i], used by the tuple and field operators.
+// Large assignments are split across the default thread pool:
+//
+//   - random access ranges are cut into equal contiguous chunks
+//   - multi_slice selections (`fluid`) are split on slice boundaries, with the work
+//     balanced by the slice lengths, and each slice is a plain loop over the base range
+//   - predicate selections are chunked over the base range and masked by the predicate
+//   - a multi_slice selection given a contiguous range holding just the selected values,
+//     one slice after another, is split as above
+//
+// Only inputs that read stored data, directly or through stateless expressions such as
+// u - v or a lifted abs, are split.  Other lazy views may call into code that is not
+// thread safe, e.g. a manufactured solution evaluated by lua, so they are assigned
+// serially along with anything else, or selections that do not match on both sides.
+// Such sources should be evaluated into a field first when the assignment is large
+//
+namespace ccs
+{
+namespace detail
+{
+template <typename Rng, typename Fn>
+class multi_slice_view;
+
+template <typename Rng, typename Pred, typename Fn>
+class predicate_view;
+
+template <typename>
+struct is_multi_slice_view : std::false_type {
+};
+
+template <typename Rng, typename Fn>
+struct is_multi_slice_view<multi_slice_view<Rng, Fn>> : std::true_type {
+};
+
+template <typename>
+struct is_predicate_view : std::false_type {
+};
+
+template <typename Rng, typename Pred, typename Fn>
+struct is_predicate_view<predicate_view<Rng, Pred, Fn>> : std::true_type {
+};
+} // namespace detail
+
+template <typename T>
+concept MultiSliceView = detail::is_multi_slice_view<std::remove_cvref_t<T>>::value;
+
+template <typename T>
+concept PredicateView = detail::is_predicate_view<std::remove_cvref_t<T>>::value;
+
+// assignments smaller than this run on the calling thread
+inline constexpr integer min_parallel_items = 1 << 15;
+
+namespace detail
+{
+template <typename R>
+concept RandomAccessSized = rs::random_access_range<R> && rs::sized_range<R>;
+
+// selections that can be assigned through their underlying range
+template <typename T>
+concept SliceSelection = MultiSliceView<T> && requires(T& t)
+{
+    { t.index_slices() } -> std::same_as<std::span<const index_slice>>;
+    requires RandomAccessSized<decltype(t.base())>;
+};
+
+template <typename T>
+concept MaskSelection = PredicateView<T> && requires(T& t)
+{
+    requires RandomAccessSized<decltype(t.base())>;
+    requires RandomAccessSized<decltype(t.predicate())>;
+};
+
+// ranges whose elements are references to stored values, e.g. a selection of a field,
+// rather than values computed on access
+template <typename R>
+struct is_stored
+    : std::bool_constant<rs::random_access_range<R> &&
+                         std::is_lvalue_reference_v<rs::range_reference_t<R>>> {
+};
+
+template <typename V>
+struct is_stored<rs::repeat_n_view<V>> : std::true_type {
+};
+
+template <typename Fn, typename... Rngs>
+struct is_stored<expr_view<Fn, Rngs...>> : std::conjunction<is_stored<Rngs>...> {
+};
+
+template <typename Rng>
+struct is_stored<rs::ref_view<Rng>> : is_stored<std::remove_cv_t<Rng>> {
+};
+
+// selections made from stored data or expressions over it
+template <typename Rng, typename Fn>
+struct is_stored<multi_slice_view<Rng, Fn>> : is_stored<Rng> {
+};
+
+template <typename In>
+concept StoredExpression = requires(const In& in)
+{
+    as_expr(in);
+} && is_stored<std::remove_cvref_t<decltype(as_expr(std::declval<const In&>()))>>::value;
+
+// numbers, stored data and stateless expressions over them.  Anything else may call
+// into code that is not thread safe when read
+template <typename In>
+concept StoredInput = Numeric<std::remove_cvref_t<In>> || rs::contiguous_range<In> ||
+                      is_stored<std::remove_cvref_t<In>>::value ||
+                      IndexedExpression<std::remove_cvref_t<In>> ||
+                      StoredExpression<std::remove_cvref_t<In>>;
+
+// the smallest assignment split across threads; never for other inputs
+template <typename In>
+inline constexpr integer parallel_items =
+    StoredInput<In> ? min_parallel_items : std::numeric_limits<integer>::max();
+
+// where writing starts: a pointer for contiguous ranges, an iterator otherwise
+template <typename R>
+constexpr auto output_start(R&& r)
+{
+    if constexpr (rs::contiguous_range<R>)
+        return rs::data(r);
+    else
+        return rs::begin(r);
+}
+
+// where reading starts: numbers are used as is and expressions over contiguous data
+// become an indexer, otherwise a pointer or iterator
+template <typename R>
+constexpr auto input_start(R&& r)
+{
+    using T = std::remove_cvref_t<R>;
+    if constexpr (Numeric<T>)
+        return r;
+    else if constexpr (IndexedExpression<T>)
+        return indexer(as_expr(r));
+    else
+        return output_start(FWD(r));
+}
+
+// op(out[i], in[i]) for i in [first, last).  Iterators are advanced once per chunk so
+// selections with costly random access are only walked incrementally
+template <typename O, typename R, typename Op>
+constexpr void assign_chunk(O o0, const R& r0, integer first, integer last, Op& op)
+{
+    auto o = o0 + first;
+    if constexpr (Numeric<R>) {
+        for (integer i = first; i < last; ++i, ++o) op(*o, r0);
+    } else if constexpr (std::invocable<const R&, integer>) {
+        for (integer i = first; i < last; ++i, ++o) op(*o, r0(i));
+    } else {
+        auto r = r0 + first;
+        for (integer i = first; i < last; ++i, ++o, ++r) op(*o, *r);
+    }
+}
+
+// as above but skipping elements where the predicate is false
+template <typename O, typename R, typename P, typename Op>
+constexpr void
+assign_masked_chunk(O o0, const R& r0, P p0, integer first, integer last, Op& op)
+{
+    auto o = o0 + first;
+    auto p = p0 + first;
+    if constexpr (Numeric<R>) {
+        for (integer i = first; i < last; ++i, ++o, ++p)
+            if (*p) op(*o, r0);
+    } else if constexpr (std::invocable<const R&, integer>) {
+        for (integer i = first; i < last; ++i, ++o, ++p)
+            if (*p) op(*o, r0(i));
+    } else {
+        auto r = r0 + first;
+        for (integer i = first; i < last; ++i, ++o, ++p, ++r)
+            if (*p) op(*o, *r);
+    }
+}
+
+template <typename Out, typename In, typename Op>
+void assign_range(Out&& out, In&& in, Op& op)
+{
+    integer n = rs::size(out);
+    if constexpr (!Numeric<std::remove_cvref_t<In>>)
+        n = std::min<integer>(n, rs::size(in));
+
+    const auto o0 = output_start(out);
+    const auto r0 = input_start(in);
+    parallel_for(n, parallel_items<In>, [&](integer first, integer last) {
+        assign_chunk(o0, r0, first, last, op);
+    });
+}
+
+// number of elements in the slices before each slice, and in total
+inline std::vector<integer> slice_offsets(std::span<const index_slice> slices)
+{
+    std::vector<integer> prefix(slices.size() + 1);
+    for (std::size_t s = 0; s < slices.size(); ++s)
+        prefix[s + 1] = prefix[s] + (slices[s].last - slices[s].first);
+    return prefix;
+}
+
+template <typename Out, typename In, typename Op>
+void assign_slices(Out&& out,
+                   In&& in,
+                   std::span<const index_slice> slices,
+                   Op& op)
+{
+    const auto prefix = slice_offsets(slices);
+
+    const auto o0 = output_start(out);
+    const auto r0 = input_start(in);
+    parallel_for(std::span<const integer>{prefix},
+                 parallel_items<In>,
+                 [&](integer first, integer last) {
+                     for (integer s = first; s < last; ++s)
+                         assign_chunk(o0, r0, slices[s].first, slices[s].last, op);
+                 });
+}
+
+// as above but `in` only holds the selected elements
+template <typename Out, typename In, typename Op>
+void assign_packed(Out&& out, In&& in, std::span<const index_slice> slices, Op& op)
+{
+    const auto prefix = slice_offsets(slices);
+    assert(static_cast<integer>(rs::size(in)) >= prefix.back());
+
+    const auto o0 = output_start(out);
+    const auto r0 = rs::data(in);
+    parallel_for(std::span<const integer>{prefix},
+                 parallel_items<In>,
+                 [&](integer first, integer last) {
+                     for (integer s = first; s < last; ++s) {
+                         auto o = o0 + slices[s].first;
+                         auto r = r0 + prefix[s];
+                         for (integer i = slices[s].first; i < slices[s].last; ++i)
+                             op(*o++, *r++);
+                     }
+                 });
+}
+
+template <typename Out, typename In, typename Pred, typename Op>
+void assign_masked(Out&& out, In&& in, Pred&& pred, Op& op)
+{
+    const integer n = rs::size(pred);
+    const auto o0 = output_start(out);
+    const auto r0 = input_start(in);
+    const auto p0 = rs::begin(pred);
+    parallel_for(n, parallel_items<In>, [&](integer first, integer last) {
+        assign_masked_chunk(o0, r0, p0, first, last, op);
+    });
+}
+} // namespace detail
+
+// op(out[i], in[i]) for each element of out, where `in` is either a range or a number
+template <typename Out, typename In, typename Op>
+void assign_elements(Out&& out, In&& in, Op op)
+{
+    constexpr bool numeric = Numeric<std::remove_cvref_t<In>>;
+
+    if constexpr (detail::SliceSelection<Out>) {
+        if constexpr (numeric) {
+            detail::assign_slices(out.base(), in, out.index_slices(), op);
+            return;
+        } else if constexpr (detail::SliceSelection<In>) {
+            const auto s = out.index_slices();
+            const auto t = in.index_slices();
+            if (s.data() == t.data() && s.size() == t.size()) {
+                detail::assign_slices(out.base(), in.base(), s, op);
+                return;
+            }
+        } else if constexpr (rs::contiguous_range<In> && rs::sized_range<In>) {
+            detail::assign_packed(out.base(), in, out.index_slices(), op);
+            return;
+        }
+    } else if constexpr (detail::MaskSelection<Out>) {
+        if constexpr (numeric) {
+            detail::assign_masked(out.base(), in, out.predicate(), op);
+            return;
+        } else if constexpr (detail::MaskSelection<In>) {
+            using P = decltype(out.predicate());
+            if constexpr (std::same_as<P, decltype(in.predicate())>) {
+                // selections made with the same predicate range start at the same place
+                if (rs::begin(out.predicate()) == rs::begin(in.predicate())) {
+                    detail::assign_masked(out.base(), in.base(), out.predicate(), op);
+                    return;
+                }
+            }
+        }
+    } else if constexpr (detail::RandomAccessSized<Out> &&
+                         (numeric || detail::RandomAccessSized<In>)) {
+        detail::assign_range(out, in, op);
+        return;
+    }
+
+    if constexpr (numeric) {
+        for (auto&& o : out) op(o, in);
+    } else {
+        for (auto&& [o, i] : vs::zip(out, in)) op(o, i);
+    }
+}
+
+} // namespace ccs
@@ -0,0 +1,113 @@
+#include "selector.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/transform.hpp>
+
+#include <thread>
+#include <vector>
+
+using namespace ccs;
+
+namespace
+{
+// large enough to be split across several threads
+constexpr integer n = 8 * min_parallel_items + 3;
+using T = std::vector<real>;
+} // namespace
+
+TEST_CASE("parallel assignment")
+{
+    set_thread_count(4);
+
+    tuple<T> x{vs::iota(0, n)};
+    tuple<T> y{vs::iota(n, 2 * n)};
+    auto&& a = get<0>(x);
+    auto&& b = get<0>(y);
+
+    SECTION("expressions")
+    {
+        tuple<T> z{};
+        z = x + 2 * y;
+        REQUIRE(rs::size(get<0>(z)) == n);
+        for (integer i = 0; i < n; ++i) REQUIRE(get<0>(z)[i] == i + 2 * (n + i));
+
+        z -= x;
+        for (integer i = 0; i < n; ++i) REQUIRE(get<0>(z)[i] == 2 * (n + i));
+
+        z *= 0.5;
+        for (integer i = 0; i < n; ++i) REQUIRE(get<0>(z)[i] == n + i);
+    }
+
+    SECTION("multi_slice")
+    {
+        std::vector<index_slice> slices{};
+        for (integer i = 0; i + 10 < n; i += 16) slices.push_back({i, i + 10});
+        auto in_slice = [](integer i) { return i % 16 < 10 && i - i % 16 + 10 < n; };
+
+        x | sel::multi_slice(slices) = y;
+        for (integer i = 0; i < n; ++i) REQUIRE(a[i] == (in_slice(i) ? n + i : i));
+
+        x | sel::multi_slice(slices) += 1;
+        for (integer i = 0; i < n; ++i) REQUIRE(a[i] == (in_slice(i) ? n + i + 1 : i));
+
+        // values for just the selected elements
+        std::vector<real> packed(10 * slices.size());
+        for (integer k = 0; k < (integer)packed.size(); ++k) packed[k] = -k;
+        assign_elements(get<0>(x | sel::multi_slice(slices)), packed, eq);
+        for (integer i = 0; i < n; ++i)
+            if (in_slice(i)) REQUIRE(a[i] == -(i / 16 * 10 + i % 16));
+    }
+
+    SECTION("predicate")
+    {
+        std::vector<bool> mask(n);
+        for (integer i = 0; i < n; ++i) mask[i] = i % 3 == 0;
+
+        x | sel::predicate(vs::all(mask)) = y;
+        for (integer i = 0; i < n; ++i) REQUIRE(a[i] == (mask[i] ? b[i] : i));
+
+        x | sel::predicate(vs::all(mask)) = -1;
+        for (integer i = 0; i < n; ++i) REQUIRE(a[i] == (mask[i] ? -1 : i));
+    }
+
+    SECTION("lifted expressions and selections")
+    {
+        constexpr auto magnitude = lift([](auto&& v) { return std::abs(v); });
+        std::vector<index_slice> slices{};
+        for (integer i = 0; i + 10 < n; i += 16) slices.push_back({i, i + 10});
+        auto in_slice = [](integer i) { return i % 16 < 10 && i - i % 16 + 10 < n; };
+
+        // the sources of e.g. `error | m.fluid_all(object_bcs) = abs(u - sol)`
+        using E = std::remove_cvref_t<decltype(get<0>(magnitude(x - y)))>;
+        using S = std::remove_cvref_t<decltype(get<0>(y | sel::multi_slice(slices)))>;
+        using SE =
+            std::remove_cvref_t<decltype(get<0>(x - y | sel::multi_slice(slices)))>;
+        static_assert(detail::parallel_items<E> == min_parallel_items);
+        static_assert(detail::parallel_items<S> == min_parallel_items);
+        static_assert(detail::parallel_items<SE> == min_parallel_items);
+
+        x | sel::multi_slice(slices) = magnitude(x - y);
+        for (integer i = 0; i < n; ++i) REQUIRE(a[i] == (in_slice(i) ? n : i));
+
+        x | sel::multi_slice(slices) += y;
+        for (integer i = 0; i < n; ++i) REQUIRE(a[i] == (in_slice(i) ? 2 * n + i : i));
+    }
+
+    SECTION("lazy inputs stay on the calling thread")
+    {
+        const auto id = std::this_thread::get_id();
+        integer elsewhere = 0;
+        auto f = vs::iota(integer{0}, n) | vs::transform([&](integer i) {
+                     if (std::this_thread::get_id() != id) ++elsewhere;
+                     return 3.0 * i;
+                 });
+
+        assign_elements(a, f, eq);
+        REQUIRE(elsewhere == 0);
+        for (integer i = 0; i < n; ++i) REQUIRE(a[i] == 3 * i);
+    }
+
+    set_thread_count(1);
+}
@@ -0,0 +1,162 @@
+#pragma once
+
+#include "types.hpp"
+
+#include <algorithm>
+#include <concepts>
+#include <tuple>
+#include <type_traits>
+
+#include <range/v3/range/concepts.hpp>
+#include <range/v3/range/primitives.hpp>
+#include <range/v3/view/all.hpp>
+#include <range/v3/view/interface.hpp>
+#include <range/v3/view/ref.hpp>
+#include <range/v3/view/repeat_n.hpp>
+#include <range/v3/view/zip_with.hpp>
+
+namespace ccs
+{
+
+//
+// Lazy elementwise expressions.  An expr_view iterates like a zip_with view, so any
+// code consuming ranges can use it, but it also exposes its operands so that an
+// expression whose leaves are all contiguous ranges or repeated values can be
+// evaluated with a single indexed loop the compiler is able to vectorize.  By default
+// that is for the baseline instruction set; wider vectors need SHOCCS_NATIVE_ARCH.
+//
+template <typename Fn, typename... Rngs>
+class expr_view : public rs::view_interface<expr_view<Fn, Rngs...>>
+{
+    // the function is recreated on evaluation rather than stored
+    static_assert(std::is_empty_v<Fn> && std::default_initializable<Fn>);
+
+    // the only copy of the operands, so nesting expressions does not duplicate them
+    std::tuple<Rngs...> rngs;
+
+    // Iteration goes through a zip_with over references to the operands.  Its iterators
+    // hold the stateless function by value and iterators into the operands, so they
+    // remain valid after the zip itself is gone
+    template <typename Self>
+    static constexpr auto zipped(Self& self)
+    {
+        return std::apply([](auto&... r) { return vs::zip_with(Fn{}, vs::ref(r)...); },
+                          self.rngs);
+    }
+
+    template <typename Self>
+    static constexpr auto min_size(Self& self)
+    {
+        return std::apply(
+            [](auto&... r) {
+                return std::min({static_cast<std::size_t>(rs::size(r))...});
+            },
+            self.rngs);
+    }
+
+public:
+    expr_view() = default;
+
+    constexpr expr_view(Fn, Rngs... r) : rngs{MOVE(r)...} {}
+
+    constexpr auto begin()
+    {
+        auto z = zipped(*this);
+        return rs::begin(z);
+    }
+
+    constexpr auto end()
+    {
+        auto z = zipped(*this);
+        return rs::end(z);
+    }
+
+    constexpr auto begin() const requires(rs::range<const Rngs>&&...)
+    {
+        auto z = zipped(*this);
+        return rs::begin(z);
+    }
+
+    constexpr auto end() const requires(rs::range<const Rngs>&&...)
+    {
+        auto z = zipped(*this);
+        return rs::end(z);
+    }
+
+    constexpr auto size() requires(rs::sized_range<Rngs>&&...) { return min_size(*this); }
+
+    constexpr auto size() const requires(rs::sized_range<const Rngs>&&...)
+    {
+        return min_size(*this);
+    }
+
+    constexpr const std::tuple<Rngs...>& operands() const { return rngs; }
+
+    static constexpr Fn fn() { return Fn{}; }
+};
+
+template <typename Fn, typename... Rngs>
+constexpr auto zip_expr(Fn fn, Rngs&&... rngs)
+{
+    return expr_view<Fn, vs::all_t<Rngs>...>{fn, vs::all(FWD(rngs))...};
+}
+
+namespace detail
+{
+template <typename>
+struct is_expr_view : std::false_type {
+};
+
+template <typename Fn, typename... Rngs>
+struct is_expr_view<expr_view<Fn, Rngs...>> : std::true_type {
+};
+
+// leaves that can be read by index
+template <typename T>
+struct is_indexed : std::bool_constant<rs::contiguous_range<T> && rs::sized_range<T>> {
+};
+
+template <typename V>
+struct is_indexed<rs::repeat_n_view<V>> : std::true_type {
+};
+
+template <typename Fn, typename... Rngs>
+struct is_indexed<expr_view<Fn, Rngs...>> : std::conjunction<is_indexed<Rngs>...> {
+};
+
+template <typename Fn, typename... Rngs>
+constexpr const expr_view<Fn, Rngs...>& as_expr(const expr_view<Fn, Rngs...>& e)
+{
+    return e;
+}
+
+// Convert an expression into a callable returning its i'th element
+template <typename R>
+constexpr auto indexer(R r)
+{
+    if constexpr (is_expr_view<R>::value) {
+        return std::apply(
+            [](auto... rngs) {
+                return [... e = indexer(MOVE(rngs))](integer i) {
+                    return R::fn()(e(i)...);
+                };
+            },
+            r.operands());
+    } else if constexpr (rs::contiguous_range<R>) {
+        return [p = rs::data(r)](integer i) { return p[i]; };
+    } else {
+        return [v = *rs::begin(r)](integer) { return v; };
+    }
+}
+} // namespace detail
+
+// Expressions may be wrapped in other views (e.g. a one element tuple), so they are
+// detected through their expr_view base
+template <typename T>
+concept IndexedExpression = requires(const T& t)
+{
+    detail::as_expr(t);
+} && detail::is_indexed<std::remove_cvref_t<
+    decltype(detail::as_expr(std::declval<const T&>()))>>::value;
+
+} // namespace ccs
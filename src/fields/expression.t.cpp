@@ -0,0 +1,65 @@
+#include "tuple.hpp"
+#include "tuple_math.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <range/v3/algorithm/equal.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/repeat_n.hpp>
+
+#include <span>
+#include <vector>
+
+using namespace ccs;
+
+TEST_CASE("indexed expressions")
+{
+    std::vector<real> a{1, 2, 3, 4, 5};
+    std::vector<real> b{5, 4, 3, 2, 1};
+    const std::vector<real> expected{11, 10, 9, 8, 7};
+
+    // a + 2 * b
+    auto e = zip_expr(
+        std::plus{}, a, zip_expr(std::multiplies{}, std::span{b}, vs::repeat_n(2.0, 5)));
+    static_assert(IndexedExpression<decltype(e)>);
+
+    // each operand is held once however deeply the expression is nested
+    static_assert(sizeof(e) <= sizeof(vs::all_t<std::vector<real>&>) +
+                                   sizeof(std::span<real>) +
+                                   sizeof(rs::repeat_n_view<real>));
+
+    // the expression is still an ordinary range
+    REQUIRE(rs::equal(e, expected));
+
+    std::vector<real> out(5);
+    assign_elements(out, e, [](auto& o, auto i) { o = i; });
+    REQUIRE(out == expected);
+
+    // leaves which cannot be indexed keep the expression on the range path
+    auto f = zip_expr(std::plus{}, a, vs::iota(0, 5));
+    static_assert(!IndexedExpression<decltype(f)>);
+    static_assert(!IndexedExpression<decltype(a)>);
+}
+
+TEST_CASE("indexed tuple math")
+{
+    using T = std::vector<real>;
+    tuple<T, T> x{T{1, 2, 3}, T{4, 5}};
+    tuple<T, T> y{T{1, 1, 1}, T{2, 2}};
+
+    // assignment through resize_and_copy
+    tuple<T, T> z{};
+    z = x + 2 * y;
+    REQUIRE(get<0>(z) == T{3, 4, 5});
+    REQUIRE(get<1>(z) == T{8, 9});
+
+    // compound assignment
+    z -= y * x;
+    REQUIRE(get<0>(z) == T{2, 2, 2});
+    REQUIRE(get<1>(z) == T{0, -1});
+
+    // mixed with a non-indexed leaf
+    z = x + tuple{vs::iota(0, 3), vs::iota(0, 2)};
+    REQUIRE(get<0>(z) == T{1, 3, 5});
+    REQUIRE(get<1>(z) == T{4, 6});
+}
@@ -2,6 +2,8 @@
 
 #include "field_fwd.hpp"
 
+#include <span>
+
 namespace ccs
 {
 
@@ -24,6 +26,28 @@ constexpr void for_each(F&& f, T&&... t)
     for_each_vector(FWD(f), FWD(t)...);
 }
 
+// Call f with matching spans over each contiguous part of the fields: the D, Rx, Ry
+// and Rz parts of every scalar and of every vector component
+template <Field... T, typename F>
+constexpr void for_each_span(F&& f, T&&... t)
+{
+    auto scalar_parts = [&f](auto&&... s) {
+        f(std::span{get<si::D>(s)}...);
+        f(std::span{get<si::Rx>(s)}...);
+        f(std::span{get<si::Ry>(s)}...);
+        f(std::span{get<si::Rz>(s)}...);
+    };
+
+    for_each_scalar(scalar_parts, t...);
+    for_each_vector(
+        [&scalar_parts](auto&&... v) {
+            scalar_parts(get<vi::X>(v)...);
+            scalar_parts(get<vi::Y>(v)...);
+            scalar_parts(get<vi::Z>(v)...);
+        },
+        t...);
+}
+
 template <Field... T, typename F>
 constexpr auto transform_scalar(F&& f, T&&... t)
 {
@@ -611,6 +611,8 @@ public:
     template <typename U>
         requires std::invocable<Fn, U>
     constexpr auto apply(U&& u) const { return f(FWD(u)); }
+
+    constexpr std::span<const index_slice> index_slices() const { return slices; }
 };
 
 template <typename Rng, typename Fn>
@@ -664,12 +666,40 @@ constexpr auto multi_slice_base_fn::operator()(Rng&& rng,
         FWD(rng), slices, rs::compose(rs::bind_back(multi_slice_fn{}, slices), FWD(f)));
 }
 
+// index_runs applies the same slices to each component picked out by a selection, e.g.
+// `sel::Rx | sel::index_runs(slices)`.  Used in place of a predicate when the selected
+// points are known ahead of time, so only those points are visited
+struct index_runs_fn {
+    template <TupleLike U>
+    constexpr auto operator()(U&& u, std::span<const index_slice> slices) const
+    {
+        return transform(
+            [slices](auto&& ui) {
+                // reapplying the selection recovers this component from a new tuple
+                using I = typename std::remove_cvref_t<decltype(ui)>::index;
+                return multi_slice_view(
+                    tuple{FWD(ui)},
+                    slices,
+                    rs::compose(rs::bind_back(index_runs_fn{}, slices),
+                                selection_view_fn<I>{}));
+            },
+            FWD(u));
+    }
+
+    constexpr auto operator()(std::span<const index_slice> slices) const
+    {
+        return rs::make_view_closure(rs::bind_back(*this, MOVE(slices)));
+    }
+};
+
 } // namespace detail
 
 namespace sel
 {
 constexpr inline auto multi_slice = ::ccs::detail::multi_slice_fn{};
 using multi_slice_t = decltype(multi_slice(std::span<const index_slice>{}));
+
+constexpr inline auto index_runs = ::ccs::detail::index_runs_fn{};
 } // namespace sel
 
 namespace detail
@@ -874,6 +904,8 @@ public:
         }
         else { return f(FWD(u)); }
     }
+
+    constexpr const Pred& predicate() const { return pred; }
 };
 
 template <typename Rng, typename Pred, typename Fn>
@@ -447,6 +447,44 @@ TEST_CASE("multi_slice vector assignment")
                                                vs::iota(71, 73))});
 }
 
+TEST_CASE("index_runs scalar selection")
+{
+    using T = std::vector<int>;
+    using U = std::vector<index_slice>;
+
+    scalar<T> s{tuple{vs::iota(0, 24)},
+                tuple{vs::iota(24, 34), vs::iota(34, 44), vs::iota(44, 54)}};
+
+    U runs{{1, 3}, {6, 9}};
+    const auto rx = sel::Rx | sel::index_runs(runs);
+
+    // only the points in the runs of the selected component are visited
+    REQUIRE(rs::equal(s | rx, vs::concat(vs::iota(25, 27), vs::iota(30, 33))));
+
+    scalar<T> t = s + 100;
+    REQUIRE(rs::equal(get<0>(s | rx).apply(t), t | rx));
+
+    s | rx = -1;
+    REQUIRE(rs::equal(get<si::Rx>(s),
+                      vs::concat(vs::iota(24, 25),
+                                 vs::repeat_n(-1, 2),
+                                 vs::iota(27, 30),
+                                 vs::repeat_n(-1, 3),
+                                 vs::iota(33, 34))));
+    REQUIRE(rs::equal(get<si::D>(s), vs::iota(0, 24)));
+    REQUIRE(rs::equal(get<si::Ry>(s), vs::iota(34, 44)));
+    REQUIRE(rs::equal(get<si::Rz>(s), vs::iota(44, 54)));
+
+    // the same runs are applied to each component of a larger selection
+    s | (sel::R | sel::index_runs(runs)) = -2;
+    REQUIRE(rs::count(get<si::D>(s), -2) == 0);
+    REQUIRE(rs::count(get<si::Rx>(s), -2) == 5);
+    REQUIRE(rs::count(get<si::Ry>(s), -2) == 5);
+    REQUIRE(rs::count(get<si::Rz>(s), -2) == 5);
+    REQUIRE(get<si::Ry>(s)[6] == -2);
+    REQUIRE(get<si::Ry>(s)[9] == 43);
+}
+
 TEST_CASE("default operators for storing selections in mesh")
 {
 
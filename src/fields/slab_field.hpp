@@ -0,0 +1,197 @@
+#pragma once
+
+#include "field.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <new>
+#include <span>
+
+namespace ccs
+{
+
+// An owning field whose D and R parts, for every scalar and every vector component,
+// live back to back in a single aligned allocation.  Each part starts on an
+// `alignment` byte boundary; the padding between parts is not part of the field.
+//
+// The parts are handed out as a field_span or field_view so a slab_field can be
+// passed anywhere those are expected, while copies, fills and scaling of the whole
+// field run as one loop over data().  The span and view are carved out once when the
+// buffer is allocated and handed out by reference; a function taking them by value
+// still copies their vectors.
+//
+// Only the scratch registers of the rk4 and euler integrators use it.  The solution and
+// the checkpoint copies the simulation cycle keeps are fields, which the systems build
+// and resize through field&.
+class slab_field
+{
+public:
+    static constexpr std::size_t alignment = 64;
+
+private:
+    struct aligned_delete {
+        void operator()(real* p) const
+        {
+            ::operator delete[](p, std::align_val_t{alignment});
+        }
+    };
+
+    std::unique_ptr<real[], aligned_delete> buf;
+    system_size sz{};
+    integer n = 0;
+    field_span spans;
+    field_view views;
+
+    static constexpr integer padded(integer m)
+    {
+        constexpr integer w = alignment / sizeof(real);
+        return (m + w - 1) / w * w;
+    }
+
+    // length of the padded parts of a single scalar
+    static integer scalar_length(const scalar<integer>& ss)
+    {
+        using namespace si;
+        return padded(get<D>(ss)) + padded(get<Rx>(ss)) + padded(get<Ry>(ss)) +
+               padded(get<Rz>(ss));
+    }
+
+    template <typename T>
+    static scalar<std::span<T>> make_scalar(T* p, const scalar<integer>& ss)
+    {
+        using namespace si;
+        auto part = [&p](integer m) {
+            auto s = std::span<T>{p, static_cast<std::size_t>(m)};
+            p += padded(m);
+            return s;
+        };
+        auto d = part(get<D>(ss));
+        auto rx = part(get<Rx>(ss));
+        auto ry = part(get<Ry>(ss));
+        auto rz = part(get<Rz>(ss));
+        return tuple{tuple{d}, tuple{rx, ry, rz}};
+    }
+
+    // lay out all scalars followed by the x, y, z components of all vectors
+    template <typename T>
+    detail::field<std::vector<scalar<std::span<T>>>, std::vector<vector<std::span<T>>>>
+    carve(T* p) const
+    {
+        const auto& ss = sz.scalar_size;
+        const integer m = scalar_length(ss);
+
+        std::vector<scalar<std::span<T>>> s;
+        std::vector<vector<std::span<T>>> v;
+        s.reserve(sz.nscalars);
+        v.reserve(sz.nvectors);
+
+        for (integer i = 0; i < sz.nscalars; ++i, p += m) s.push_back(make_scalar(p, ss));
+        for (integer i = 0; i < sz.nvectors; ++i, p += 3 * m)
+            v.push_back(vector<std::span<T>>{
+                make_scalar(p, ss), make_scalar(p + m, ss), make_scalar(p + 2 * m, ss)});
+
+        return {MOVE(s), MOVE(v)};
+    }
+
+    void allocate()
+    {
+        if (n > 0) {
+            buf.reset(static_cast<real*>(
+                ::operator new[](n * sizeof(real), std::align_val_t{alignment})));
+            std::fill_n(buf.get(), n, 0.0);
+        }
+        spans = carve(buf.get());
+        views = carve(static_cast<const real*>(buf.get()));
+    }
+
+public:
+    slab_field() = default;
+
+    explicit slab_field(system_size sz)
+        : sz{sz}, n{(sz.nscalars + 3 * sz.nvectors) * scalar_length(sz.scalar_size)}
+    {
+        allocate();
+    }
+
+    slab_field(const slab_field& other) : sz{other.sz}, n{other.n}
+    {
+        allocate();
+        std::copy_n(other.buf.get(), n, buf.get());
+    }
+
+    slab_field(slab_field&& other) noexcept { swap(other); }
+
+    slab_field& operator=(const slab_field& other)
+    {
+        if (this == &other) return *this;
+
+        if (sz != other.sz) {
+            slab_field tmp{other};
+            swap(tmp);
+        } else {
+            std::copy_n(other.buf.get(), n, buf.get());
+        }
+        return *this;
+    }
+
+    slab_field& operator=(slab_field&& other) noexcept
+    {
+        swap(other);
+        return *this;
+    }
+
+    slab_field& operator=(real v)
+    {
+        std::fill_n(buf.get(), n, v);
+        return *this;
+    }
+
+    // copy the values of a field, or evaluate a field expression, of the same size
+    template <Field F>
+    slab_field& operator=(F&& f)
+    {
+        for_each([](auto& u, auto&& v) { u = v; }, spans, FWD(f));
+        return *this;
+    }
+
+    template <std::invocable<field_span&> F>
+    slab_field& operator=(F&& f)
+    {
+        std::invoke(FWD(f), spans);
+        return *this;
+    }
+
+    slab_field& operator*=(real a)
+    {
+        for (auto& x : data()) x *= a;
+        return *this;
+    }
+
+    // the whole allocation, including padding
+    std::span<real> data() { return {buf.get(), static_cast<std::size_t>(n)}; }
+    std::span<const real> data() const
+    {
+        return {buf.get(), static_cast<std::size_t>(n)};
+    }
+
+    system_size size() const { return sz; }
+
+    operator const field_span&() { return spans; }
+    operator const field_view&() const { return views; }
+
+    void swap(slab_field& other) noexcept
+    {
+        std::swap(buf, other.buf);
+        std::swap(sz, other.sz);
+        std::swap(n, other.n);
+        // exchange the spans themselves rather than the values they refer to
+        std::swap(spans, other.spans);
+        std::swap(views, other.views);
+    }
+
+    friend void swap(slab_field& a, slab_field& b) noexcept { a.swap(b); }
+};
+
+inline system_size ssize(const slab_field& f) { return f.size(); }
+
+} // namespace ccs
@@ -0,0 +1,104 @@
+#include "slab_field.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <cstdint>
+
+using namespace ccs;
+
+namespace
+{
+const auto sz = system_size{2, 1, tuple{tuple{10}, tuple{2, 4, 5}}};
+
+// number of reals in the field, not counting padding
+constexpr integer field_size = 5 * (10 + 2 + 4 + 5);
+
+bool aligned(const real* p)
+{
+    return reinterpret_cast<std::uintptr_t>(p) % slab_field::alignment == 0;
+}
+} // namespace
+
+TEST_CASE("layout")
+{
+    slab_field x{sz};
+    REQUIRE(ssize(x) == sz);
+    REQUIRE(x.data().size() >= field_size);
+
+    const auto first = x.data().data();
+    const auto last = first + x.data().size();
+    integer n = 0;
+    for_each_span(
+        [&](auto s) {
+            REQUIRE(aligned(s.data()));
+            REQUIRE(s.data() >= first);
+            REQUIRE(s.data() + s.size() <= last);
+            n += s.size();
+        },
+        field_view{x});
+    REQUIRE(n == field_size);
+
+    // an empty field owns nothing
+    slab_field y{};
+    REQUIRE(y.data().empty());
+    REQUIRE(field_view{y}.nscalars() == 0);
+}
+
+TEST_CASE("assignment")
+{
+    slab_field x{sz};
+    field y{sz};
+
+    x = 2;
+    y = field_view{x};
+    for_each_span([](auto s) { REQUIRE(std::ranges::count(s, 2) == s.size()); }, y);
+
+    y = 3;
+    x = y;
+    for_each_span([](auto s) { REQUIRE(std::ranges::count(s, 3) == s.size()); },
+                  field_view{x});
+
+    x *= 2;
+    for_each_span([](auto s) { REQUIRE(std::ranges::count(s, 6) == s.size()); },
+                  field_view{x});
+
+    // writes through the span are seen by the slab
+    auto f = [](field_span fs) {
+        auto&& [u, v] = fs.scalars(0, 1);
+        u = 10;
+        v = 11;
+    };
+    x = f;
+    REQUIRE(get<si::D>(field_view{x}.scalars(0))[0] == 10);
+    REQUIRE(get<si::Rz>(field_view{x}.scalars(1))[4] == 11);
+    REQUIRE(get<vi::zRz>(field_view{x}.vectors()[0])[4] == 6);
+}
+
+TEST_CASE("copy and move")
+{
+    slab_field x{sz};
+    x = 1;
+
+    slab_field y{x};
+    y = 2;
+    REQUIRE(x.data()[0] == 1);
+    REQUIRE(y.data()[0] == 2);
+
+    // copy assignment between equally sized fields reuses the allocation
+    const auto p = x.data().data();
+    x = y;
+    REQUIRE(x.data().data() == p);
+    REQUIRE(x.data()[0] == 2);
+
+    slab_field z{MOVE(y)};
+    REQUIRE(ssize(z) == sz);
+    REQUIRE(y.data().empty());
+
+    // swapping exchanges the storage along with the spans into it
+    z = 5;
+    swap(x, z);
+    REQUIRE(x.data()[0] == 5);
+    REQUIRE(get<si::D>(field_view{x}.scalars(0))[0] == 5);
+    REQUIRE(get<si::D>(field_view{z}.scalars(0))[0] == 2);
+}
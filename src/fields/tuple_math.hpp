@@ -31,7 +31,7 @@ private:
     {                                                                                    \
         for_each(                                                                        \
             [v](auto&& rng) {                                                            \
-                for (auto&& x : rng) x f v;                                              \
+                assign_elements(FWD(rng), v, [](auto&& x, V v) { x f v; });              \
             },                                                                           \
             u);                                                                          \
                                                                                          \
@@ -44,7 +44,7 @@ private:
     {                                                                                    \
         for_each(                                                                        \
             [](auto&& out, auto&& in) {                                                  \
-                for (auto&& [o, i] : vs::zip(out, in)) o f i;                            \
+                assign_elements(FWD(out), FWD(in), [](auto&& o, auto&& i) { o f i; });   \
             },                                                                           \
             u,                                                                           \
             FWD(v));                                                                     \
@@ -81,7 +81,7 @@ private:
         return transform(                                                                \
             [v](auto&& rng) {                                                            \
                 const auto sz = rs::size(rng);                                           \
-                return vs::zip_with(f, FWD(rng), vs::repeat_n(v, sz));                   \
+                return zip_expr(f, FWD(rng), vs::repeat_n(v, sz));                       \
             },                                                                           \
             FWD(u));                                                                     \
     }                                                                                    \
@@ -93,7 +93,7 @@ private:
         return transform(                                                                \
             [v](auto&& rng) {                                                            \
                 const auto sz = rs::size(rng);                                           \
-                return vs::zip_with(f, vs::repeat_n(v, sz), FWD(rng));                   \
+                return zip_expr(f, vs::repeat_n(v, sz), FWD(rng));                       \
             },                                                                           \
             FWD(u));                                                                     \
     }                                                                                    \
@@ -105,7 +105,7 @@ private:
         op(U&& u, V&& v)                                                                 \
     {                                                                                    \
         return transform(                                                                \
-            [](auto&& a, auto&& b) { return vs::zip_with(f, FWD(a), FWD(b)); },          \
+            [](auto&& a, auto&& b) { return zip_expr(f, FWD(a), FWD(b)); },              \
             FWD(u),                                                                      \
             FWD(v));                                                                     \
     }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "execution.hpp"
 #include "tuple_fwd.hpp"
 
 #include <tuple>
@@ -280,17 +281,16 @@ constexpr void resize_and_copy(C&& container, R&& r)
 {
     constexpr bool can_resize = requires(C c, R r) { c.resize(rs::size(r)); };
     constexpr bool compare_sizes = requires(C c, R r) { rs::size(c) < rs::size(r); };
+    constexpr auto assign = [](auto&& o, auto&& i) { o = FWD(i); };
     if constexpr (can_resize)
     {
         container.resize(rs::size(r));
-        rs::copy(FWD(r), rs::begin(container));
+        assign_elements(FWD(container), FWD(r), assign);
     }
     else if constexpr (compare_sizes)
     {
-        auto min_sz =
-            rs::size(container) < rs::size(r) ? rs::size(container) : rs::size(r);
-        // note that copy_n takes an input iterator rather than a range
-        rs::copy_n(rs::begin(r), min_sz, rs::begin(container));
+        // only the common length is copied
+        assign_elements(FWD(container), FWD(r), assign);
     }
     else { rs::copy(FWD(r), rs::begin(container)); }
 }
@@ -307,7 +307,7 @@ constexpr void resize_and_copy(C&& container, R&& r)
 template <Numeric N, OutputRange<N> T>
 constexpr void resize_and_copy(T&& t, N n)
 {
-    rs::fill(FWD(t), n);
+    assign_elements(FWD(t), n, [](auto&& o, N n) { o = n; });
 }
 
 template <typename R, OutputTuple<R> T>
@@ -368,21 +368,25 @@ constexpr R to(Arg&& arg)
 
 //
 // lifting a function allows us to more easily call the function on each element
-// of the ranges of the tuple
+// of the ranges of the tuple.  Stateless functions build expressions, see expr_view
 //
 template <typename Fn>
 constexpr auto lift(Fn fn)
 {
-    return [fn](auto&&... tup) {
+    auto zip = [fn]<rs::range... Args>(Args && ... rngs)
+    {
+        if constexpr (std::is_empty_v<Fn> && std::default_initializable<Fn>)
+            return zip_expr(fn, FWD(rngs)...);
+        else
+            return vs::zip_with(fn, FWD(rngs)...);
+    };
+
+    return [zip](auto&&... tup) {
         using type = mp_front<mp_list<decltype(tup)...>>;
         if constexpr (TupleLike<type>)
-            return transform(
-                [fn]<rs::range... Args>(Args && ... rngs) {
-                    return vs::zip_with(fn, FWD(rngs)...);
-                },
-                FWD(tup)...);
+            return transform(zip, FWD(tup)...);
         else // assume its just a range for now
-            return vs::zip_with(fn, FWD(tup)...);
+            return zip(FWD(tup)...);
     };
 }
 
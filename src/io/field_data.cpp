@@ -58,4 +58,36 @@ void field_data::write(field_view f, std::span<const std::string> filenames) con
     }
 }
 
+void field_data::stage(field_view f, std::vector<real>& buf) const
+{
+    const integer sz = ix[0] * ix[1] * ix[2];
+
+    buf.clear();
+    for (auto&& sc : f.scalars()) {
+        auto d = get<si::D>(sc);
+        buf.insert(buf.end(), d.begin(), d.begin() + sz);
+
+        auto g = [&]<int I>(auto&& r) {
+            auto&& rng = get<I>(r);
+            buf.insert(buf.end(), rng.begin(), rng.end());
+        };
+        g.template operator()<0>(sc | sel::R);
+        g.template operator()<1>(sc | sel::R);
+        g.template operator()<2>(sc | sel::R);
+    }
+}
+
+void field_data::write(std::span<const real> staged,
+                       std::span<const std::string> filenames) const
+{
+    if (filenames.empty()) return;
+    const auto n = staged.size() / filenames.size();
+
+    for (auto&& fname : filenames) {
+        std::ofstream o(fname);
+        o.write(reinterpret_cast<const char*>(staged.data()), n * sizeof(real));
+        staged = staged.subspan(n);
+    }
+}
+
 } // namespace ccs
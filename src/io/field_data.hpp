@@ -17,6 +17,13 @@ public:
 
     void write(field_view, std::span<const std::string> filenames) const;
 
+    // copy the data of each scalar, in the order it is written, into `buf`.  Lets the
+    // field be written after it has been modified
+    void stage(field_view, std::vector<real>& buf) const;
+
+    // write data staged by `stage`.  The scalars are of equal size
+    void write(std::span<const real> staged, std::span<const std::string> filenames) const;
+
     void write_geom(std::span<const std::string> filenames,
                     tuple<std::span<const mesh_object_info>,
                           std::span<const mesh_object_info>,
@@ -24,15 +24,42 @@ field_io::field_io(xdmf&& xdmf_w,
                    d_interval&& dump_interval,
                    std::string&& io_dir,
                    int suffix_length,
-                   const logs& build_logger)
+                   const logs& build_logger,
+                   int max_pending)
     : xdmf_w{MOVE(xdmf_w)},
       field_data_w{MOVE(field_data_w)},
       dump_interval{MOVE(dump_interval)},
       io_dir{MOVE(io_dir)},
       suffix_length{suffix_length},
-      logger{build_logger, "field_io"}
+      logger{build_logger, "field_io"},
+      writer_logger{build_logger, "field_io_writer"}
 {
+    if (max_pending > 0) queue = std::make_unique<output_queue>(max_pending);
 }
+
+field_io::field_io(field_io&& other) { *this = MOVE(other); }
+
+field_io& field_io::operator=(field_io&& other)
+{
+    flush();
+    other.flush();
+
+    xdmf_w = MOVE(other.xdmf_w);
+    field_data_w = MOVE(other.field_data_w);
+    dump_interval = MOVE(other.dump_interval);
+    io_dir = MOVE(other.io_dir);
+    suffix_length = other.suffix_length;
+    logger = MOVE(other.logger);
+    writer_logger = MOVE(other.writer_logger);
+    queue = MOVE(other.queue);
+    return *this;
+}
+
+void field_io::flush()
+{
+    if (queue) queue->flush();
+}
+
 bool field_io::write(std::span<const std::string> names,
                      field_view f,
                      const step_controller& step,
@@ -54,8 +81,6 @@ bool field_io::write(std::span<const std::string> names,
                           }) |
                           rs::to<std::vector<std::string>>();
 
-    xdmf_w.write(n, step, names, xmf_file_names, r, logger);
-
     if (n == 0) {
         auto file_names = std::vector<std::string>{io / "rx", io / "ry", io / "rz"};
         field_data_w.write_geom(file_names, r);
@@ -65,7 +90,26 @@ bool field_io::write(std::span<const std::string> names,
                            vs::transform([io](auto&& name) { return io / name; }) |
                            rs::to<std::vector<std::string>>();
 
-    field_data_w.write(f, data_file_names);
+    if (queue) {
+        // the data is copied now since the field will be overwritten by the next step
+        auto buf = queue->acquire();
+        field_data_w.stage(f, buf);
+
+        queue->submit(MOVE(buf),
+                      [this,
+                       n,
+                       time = (real)step,
+                       names = std::vector<std::string>(names.begin(), names.end()),
+                       xmf_file_names = MOVE(xmf_file_names),
+                       data_file_names = MOVE(data_file_names),
+                       r](std::span<const real> staged) {
+                          xdmf_w.write(n, time, names, xmf_file_names, r, writer_logger);
+                          field_data_w.write(staged, data_file_names);
+                      });
+    } else {
+        xdmf_w.write(n, step, names, xmf_file_names, r, logger);
+        field_data_w.write(f, data_file_names);
+    }
 
     ++dump_interval;
     return true;
@@ -83,6 +127,8 @@ std::optional<field_io> field_io::from_lua(const sol::table& tbl, const logs& lo
     sol::optional<real> write_every_time = io["write_every_time"];
     std::string dir = io["dir"].get_or("io"s);
     int len = io["suffix_length"].get_or(6);
+    // number of dumps that may be written in the background.  Zero writes synchronously
+    int max_pending = io["max_pending_writes"].get_or(2);
     std::string xmf_base = io["xdmf_filename"].get_or("view.xmf"s);
 
     if (write_every_step) {
@@ -105,7 +151,12 @@ std::optional<field_io> field_io::from_lua(const sol::table& tbl, const logs& lo
     auto step = write_every_step ? interval<int>{*write_every_step} : interval<int>{};
     auto time = write_every_time ? interval<real>{*write_every_time} : interval<real>{};
 
-    return field_io{
-        MOVE(xdmf_w), MOVE(data_w), d_interval{step, time}, MOVE(dir), len, logger};
+    return field_io{MOVE(xdmf_w),
+                    MOVE(data_w),
+                    d_interval{step, time},
+                    MOVE(dir),
+                    len,
+                    logger,
+                    max_pending};
 }
 } // namespace ccs
@@ -1,6 +1,7 @@
 #pragma once
 #include <array>
 #include <iostream>
+#include <memory>
 #include <string>
 #include <tuple>
 #include <vector>
@@ -10,6 +11,7 @@
 #include "interval.hpp"
 #include "logging.hpp"
 #include "mesh/mesh_types.hpp"
+#include "output_queue.hpp"
 #include "types.hpp"
 #include "xdmf.hpp"
 
@@ -20,6 +22,10 @@ namespace ccs
 // Forward decls
 class step_controller;
 
+// Writes the fields at the dump intervals.  With a positive `max_pending`, each dump is
+// copied into a staging buffer and written on a background thread while the simulation
+// continues.  At most `max_pending` dumps are in flight; further writes wait for the
+// oldest to finish.  Otherwise the dumps are written before `write` returns
 class field_io
 {
 
@@ -30,6 +36,11 @@ class field_io
     std::string io_dir;
     int suffix_length;
     logs logger;
+    // the background jobs log through their own logger since loggers are not
+    // thread-safe
+    logs writer_logger;
+    // declared last so pending writes finish before the writers are destroyed
+    std::unique_ptr<output_queue> queue;
 
 public:
     field_io() = default;
@@ -39,7 +50,12 @@ public:
              d_interval&& dump_interval,
              std::string&& io_dir,
              int suffix_length,
-             const logs& = {});
+             const logs& = {},
+             int max_pending = 0);
+
+    // pending writes refer to the writers so they are finished before moving
+    field_io(field_io&&);
+    field_io& operator=(field_io&&);
 
     bool write(std::span<const std::string>,
                field_view field,
@@ -49,6 +65,9 @@ public:
                      std::span<const mesh_object_info>,
                      std::span<const mesh_object_info>>);
 
+    // wait for all pending writes to reach the filesystem
+    void flush();
+
     static std::optional<field_io> from_lua(const sol::table&, const logs& = {});
 };
 
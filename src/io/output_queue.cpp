@@ -0,0 +1,69 @@
+#include "output_queue.hpp"
+
+#include <algorithm>
+
+namespace ccs
+{
+
+output_queue::output_queue(int max_pending) : pool(std::max(max_pending, 1))
+{
+    worker = std::thread{[this] { work(); }};
+}
+
+output_queue::~output_queue()
+{
+    {
+        std::lock_guard lk{m};
+        stop = true;
+    }
+    cv.notify_all();
+    worker.join();
+}
+
+void output_queue::work()
+{
+    std::unique_lock lk{m};
+    while (true) {
+        cv.wait(lk, [this] { return stop || !jobs.empty(); });
+        // drain the queue before stopping
+        if (jobs.empty()) return;
+
+        auto [b, j] = MOVE(jobs.front());
+        jobs.pop_front();
+        busy = true;
+
+        lk.unlock();
+        j(b);
+        lk.lock();
+
+        busy = false;
+        pool.push_back(MOVE(b));
+        cv.notify_all();
+    }
+}
+
+output_queue::buffer output_queue::acquire()
+{
+    std::unique_lock lk{m};
+    cv.wait(lk, [this] { return !pool.empty(); });
+    auto b = MOVE(pool.back());
+    pool.pop_back();
+    return b;
+}
+
+void output_queue::submit(buffer&& b, job&& j)
+{
+    {
+        std::lock_guard lk{m};
+        jobs.emplace_back(MOVE(b), MOVE(j));
+    }
+    cv.notify_all();
+}
+
+void output_queue::flush()
+{
+    std::unique_lock lk{m};
+    cv.wait(lk, [this] { return jobs.empty() && !busy; });
+}
+
+} // namespace ccs
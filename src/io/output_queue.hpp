@@ -0,0 +1,52 @@
+#pragma once
+
+#include "types.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <vector>
+
+namespace ccs
+{
+// Runs output jobs in submission order on a background thread so the caller does not
+// wait on the filesystem.  Each job reads from a staging buffer taken from a pool of
+// `max_pending` buffers.  Acquiring a buffer blocks while all of them are in flight,
+// which bounds both the memory used and how far the output can lag behind
+class output_queue
+{
+public:
+    using buffer = std::vector<real>;
+    using job = std::function<void(std::span<const real>)>;
+
+private:
+    std::vector<buffer> pool;
+    std::deque<std::pair<buffer, job>> jobs;
+    std::mutex m;
+    std::condition_variable cv;
+    bool busy = false;
+    bool stop = false;
+    std::thread worker;
+
+    void work();
+
+public:
+    explicit output_queue(int max_pending = 2);
+    // finishes all pending jobs
+    ~output_queue();
+
+    output_queue(const output_queue&) = delete;
+    output_queue& operator=(const output_queue&) = delete;
+
+    // staging buffer for the next job.  Keeps the capacity of earlier jobs
+    buffer acquire();
+
+    void submit(buffer&& b, job&& j);
+
+    // wait for all submitted jobs to finish
+    void flush();
+};
+} // namespace ccs
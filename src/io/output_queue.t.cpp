@@ -0,0 +1,73 @@
+#include "output_queue.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+using namespace ccs;
+
+TEST_CASE("order")
+{
+    std::vector<real> seen;
+    {
+        output_queue q{2};
+        for (int i = 0; i < 10; i++) {
+            auto b = q.acquire();
+            b.assign(3, i);
+            q.submit(MOVE(b), [&seen](std::span<const real> s) {
+                seen.push_back(std::accumulate(s.begin(), s.end(), 0.0));
+            });
+        }
+        q.flush();
+        REQUIRE(seen.size() == 10);
+    }
+
+    for (int i = 0; i < 10; i++) REQUIRE(seen[i] == 3.0 * i);
+}
+
+TEST_CASE("back pressure")
+{
+    output_queue q{2};
+    std::atomic<bool> release{false};
+    std::atomic<int> done{};
+
+    auto blocked = [&](std::span<const real>) {
+        while (!release) std::this_thread::yield();
+        ++done;
+    };
+
+    q.submit(q.acquire(), blocked);
+    q.submit(q.acquire(), blocked);
+
+    // both buffers are in flight so the next acquire waits for the first job
+    std::atomic<bool> acquired{false};
+    std::thread t{[&] {
+        auto b = q.acquire();
+        acquired = true;
+        q.submit(MOVE(b), [&](std::span<const real>) { ++done; });
+    }};
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    REQUIRE(!acquired);
+
+    release = true;
+    t.join();
+    q.flush();
+    REQUIRE(acquired);
+    REQUIRE(done == 3);
+}
+
+TEST_CASE("destructor drains")
+{
+    std::atomic<int> done{};
+    {
+        output_queue q{1};
+        for (int i = 0; i < 5; i++)
+            q.submit(q.acquire(), [&](std::span<const real>) { ++done; });
+    }
+    REQUIRE(done == 5);
+}
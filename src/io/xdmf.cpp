@@ -1,7 +1,10 @@
+#include <fstream>
 #include <iomanip>
 #include <iostream>
 #include <pugixml.hpp>
+#include <sstream>
 #include <string>
+#include <string_view>
 
 #include <fmt/core.h>
 #include <fmt/ranges.h>
@@ -19,22 +22,23 @@ namespace ccs
 namespace
 {
 
-void append_xdmf(pugi::xml_document& doc,
-                 int step,
-                 real time,
-                 std::span<const std::string> var_names,
-                 std::span<const std::string> file_names,
-                 const std::string& dimensions,
-                 tuple<std::span<const mesh_object_info>,
-                       std::span<const mesh_object_info>,
-                       std::span<const mesh_object_info>> t,
-                 unsigned long f_sz)
+// closes the elements left open by the header.  Always the last bytes of the file
+constexpr std::string_view trailer = "</Grid>\n</Domain>\n</Xdmf>\n";
+
+// xml for the spatial collection of one dump, indented to sit inside the time series
+std::string grid_xml(int step,
+                     real time,
+                     std::span<const std::string> var_names,
+                     std::span<const std::string> file_names,
+                     const std::string& dimensions,
+                     tuple<std::span<const mesh_object_info>,
+                           std::span<const mesh_object_info>,
+                           std::span<const mesh_object_info>> t,
+                     unsigned long f_sz)
 {
-    // Get first grid node
-    auto time_series = doc.root().first_element_by_path("Xdmf/Domain/Grid");
+    pugi::xml_document doc{};
 
-    // Add a grid to main grid
-    auto grid_col = time_series.append_child("Grid");
+    auto grid_col = doc.append_child("Grid");
     grid_col.append_attribute("Name") = step;
     grid_col.append_attribute("GridType") = "Collection";
     grid_col.append_attribute("CollectionType") = "Spatial";
@@ -86,6 +90,10 @@ void append_xdmf(pugi::xml_document& doc,
     offset = sub_grid(x, "RX", 2, fmt::format("{} 1", rs::size(x)), offset);
     offset = sub_grid(y, "RY", 3, fmt::format("{} 1", rs::size(y)), offset);
     offset = sub_grid(z, "RZ", 4, fmt::format("{} 1", rs::size(z)), offset);
+
+    std::ostringstream os;
+    grid_col.print(os, "\t", pugi::format_default, pugi::encoding_auto, 1);
+    return os.str();
 }
 
 std::string header(const int3& i,
@@ -94,6 +102,8 @@ std::string header(const int3& i,
                          std::span<const mesh_object_info>,
                          std::span<const mesh_object_info>> t)
 {
+    // everything up to and including the opening of the time series.  The dumps and the
+    // trailer follow
     auto&& [min, max] = d;
     real3 dxyz = (max - min) / clamp_lo(i - 1.0, 1.0);
     std::string header = fmt::format(R"(<?xml version="1.0" encoding="utf-8"?>
@@ -118,9 +128,6 @@ std::string header(const int3& i,
 <DataItem NumberType="Float" Precision="8" Format="Binary" Dimensions="{rz} 3">rz</DataItem>
 </Geometry>
 <Grid Name="TimeSeries" GridType="Collection" CollectionType="Temporal">
-</Grid>
-</Domain>
-</Xdmf>
 )",
                                      "dims"_a = fmt::join(i.begin(), i.end(), " "),
                                      "origin"_a = fmt::join(min.begin(), min.end(), " "),
@@ -130,6 +137,22 @@ std::string header(const int3& i,
                                      "rz"_a = rs::size(get<2>(t)));
     return header;
 }
+
+// position of the trailer in an existing file, or -1 if the file does not end with one
+std::streamoff find_trailer(const std::string& filename)
+{
+    std::ifstream f{filename, std::ios::binary | std::ios::ate};
+    if (!f) return -1;
+
+    const std::streamoff sz = f.tellg();
+    const std::streamoff pos = sz - (std::streamoff)trailer.size();
+    if (pos < 0) return -1;
+
+    std::string end(trailer.size(), '\0');
+    f.seekg(pos);
+    f.read(end.data(), end.size());
+    return f && end == trailer ? pos : -1;
+}
 } // namespace
 
 //
@@ -142,39 +165,50 @@ void xdmf::write(int grid_number,
                  tuple<std::span<const mesh_object_info>,
                        std::span<const mesh_object_info>,
                        std::span<const mesh_object_info>> tp,
-                 const logs& logger) const
+                 const logs& logger)
 {
 
     // if initial write then we need to generate the file with an outline
     if (grid_number == 0) {
+        // overwrite whatever is there
+        std::ofstream f{xmf_filename, std::ios::binary | std::ios::trunc};
+        if (!f) {
+            std::cerr << "Failed to create xdmf file\n";
+            std::terminate();
+        }
         std::string h = header(ix, bounds, tp);
-
-        // build file from scratch and overwrite whatever is there
-        pugi::xml_document doc{};
-        if (!doc.load_string(h.c_str(), pugi::parse_full)) {
-            std::cerr << "Failed to load initial xdmf string\n";
+        f << h << trailer;
+        trailer_pos = h.size();
+    } else if (trailer_pos < 0) {
+        // appending to a file written by another writer, e.g. on restart
+        trailer_pos = find_trailer(xmf_filename);
+        if (trailer_pos < 0) {
+            std::cerr << "Failed to find the end of the xdmf file\n";
             std::terminate();
         }
-        doc.save_file(xmf_filename.c_str());
     }
 
-    // process existing document
-    pugi::xml_document doc{};
-    if (!doc.load_file(xmf_filename.c_str(), pugi::parse_full)) {
-        std::cerr << "Failed to reload xdmf file\n";
+    // Overwrite the trailer with the new grid and close the document again.  Both go out
+    // in a single write so the file is only briefly incomplete.  The file never shrinks
+    // so there is nothing to truncate
+    auto grid = grid_xml(grid_number,
+                         time,
+                         var_names,
+                         file_names,
+                         fmt::format("{}", fmt::join(ix.extents, " ")),
+                         tp,
+                         ix[0] * ix[1] * ix[2]);
+    grid += trailer;
+
+    std::fstream f{xmf_filename, std::ios::binary | std::ios::in | std::ios::out};
+    f.seekp(trailer_pos);
+    f.write(grid.data(), grid.size());
+    f.flush();
+    if (!f) {
+        std::cerr << "Failed to update xdmf file\n";
         std::terminate();
     }
-
-    append_xdmf(doc,
-                grid_number,
-                time,
-                var_names,
-                file_names,
-                fmt::format("{}", fmt::join(ix.extents, " ")),
-                tp,
-                ix[0] * ix[1] * ix[2]);
-
-    doc.save_file(xmf_filename.c_str());
+    trailer_pos += grid.size() - trailer.size();
 
     logger(spdlog::level::info,
            "Update xdmf file: {}, with grid {} at time {}",
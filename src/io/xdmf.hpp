@@ -5,14 +5,24 @@
 #include "logging.hpp"
 #include "mesh/mesh_types.hpp"
 
+#include <ios>
+#include <string>
+
 namespace ccs
 {
 
+// Writes the xmf file describing a time series of dumps.  The file is written once
+// with a header and a fixed trailer closing the open elements.  Each dump overwrites
+// the trailer with its grid and rewrites the trailer after it, so the cost of a dump
+// does not depend on the number of previous dumps and the file on disk is a complete
+// document between dumps
 class xdmf
 {
     std::string xmf_filename;
     index_extents ix;
     domain_extents bounds;
+    // offset of the trailer in the file.  Negative when not yet known
+    std::streamoff trailer_pos = -1;
 
 public:
     xdmf() = default;
@@ -28,7 +38,7 @@ public:
                tuple<std::span<const mesh_object_info>,
                      std::span<const mesh_object_info>,
                      std::span<const mesh_object_info>>,
-               const logs& logger) const;
+               const logs& logger);
 };
 
 } // namespace ccs
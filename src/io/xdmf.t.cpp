@@ -2,6 +2,7 @@
 #include <catch2/catch_test_macros.hpp>
 
 #include "xdmf.hpp"
+#include <pugixml.hpp>
 #include <filesystem>
 #include <fstream>
 #include <string>
@@ -32,3 +33,49 @@ TEST_CASE("header")
     file_names[1] = "V.00001";
     writer.write(1, 0.1, var_names, file_names, T{}, logger);
 }
+
+TEST_CASE("append")
+{
+    using U = std::span<const mesh_object_info>;
+    using T = tuple<U, U, U>;
+    std::vector<std::string> var_names{"U"};
+    std::vector<std::string> file_names{"U.00000"};
+    auto ix = index_extents{.extents = {3, 4, 5}};
+    auto dom = domain_extents{.min = {0.1, 0.2, 0.3}, .max = {1.1, 1.2, 1.3}};
+    auto tmp = fs::temp_directory_path() / "appendtest.xmf";
+    auto logger = logs{"", true, "field_io"};
+
+    auto count_grids = [&tmp]() {
+        pugi::xml_document doc{};
+        REQUIRE(doc.load_file(tmp.c_str()));
+        auto series = doc.root().first_element_by_path("Xdmf/Domain/Grid");
+        REQUIRE(series);
+
+        int n = 0;
+        for (auto&& g : series.children("Grid")) {
+            REQUIRE(g.attribute("Name").as_int() == n);
+            REQUIRE(g.child("Time").attribute("Value").as_double() ==
+                    Catch::Approx(0.5 * n));
+            ++n;
+        }
+        return n;
+    };
+
+    {
+        auto writer = xdmf{tmp, ix, dom};
+        for (int i = 0; i < 3; i++) {
+            writer.write(i, 0.5 * i, var_names, file_names, T{}, logger);
+            // the file is a complete document after every dump
+            REQUIRE(count_grids() == i + 1);
+        }
+    }
+
+    // a new writer, as on restart, appends to the existing file
+    auto writer = xdmf{tmp, ix, dom};
+    writer.write(3, 1.5, var_names, file_names, T{}, logger);
+    REQUIRE(count_grids() == 4);
+
+    // dumping grid 0 starts over
+    writer.write(0, 0.0, var_names, file_names, T{}, logger);
+    REQUIRE(count_grids() == 1);
+}
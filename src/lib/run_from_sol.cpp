@@ -5,6 +5,7 @@
 
 #include <sol/sol.hpp>
 
+#include "simulation/ensemble.hpp"
 #include "simulation/simulation_cycle.hpp"
 
 namespace ccs
@@ -18,4 +19,13 @@ std::optional<real3> simulation_run(const sol::table& lua)
         return {std::nullopt};
     }
 }
+
+std::optional<std::vector<real3>> ensemble_run(const sol::table& lua)
+{
+    if (auto e = ensemble::from_lua(lua); e) {
+        return {e->run()};
+    } else {
+        return {std::nullopt};
+    }
+}
 } // namespace ccs
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <optional>
+#include <vector>
 #include <sol/forward.hpp>
 
 #include "shoccs_config.hpp"
@@ -8,4 +9,7 @@
 namespace ccs
 {
 std::optional<real3> simulation_run(const sol::table& lua);
+
+// run every scheme in lua.ensemble on a common mesh and return their summaries
+std::optional<std::vector<real3>> ensemble_run(const sol::table& lua);
 } // namespace ccs
@@ -0,0 +1,108 @@
+#include "block.hpp"
+
+#include <algorithm>
+
+namespace ccs::matrix
+{
+
+block::block(std::vector<inner_block>&& blocks) : blocks{MOVE(blocks)}
+{
+    build_batches();
+}
+
+// Group runs of consecutive blocks that only differ by a unit shift in their offsets.
+// The lane count is capped at the stride so lanes never alias rows of another lane
+void block::build_batches()
+{
+    batches.clear();
+
+    for (integer i = 0; i < (integer)blocks.size(); i++) {
+        if (!batches.empty()) {
+            auto& last = batches.back();
+            const auto& f = blocks[last.first];
+            const auto& b = blocks[i];
+            const auto lanes = last.lanes;
+
+            if (f.stride() > 1 && lanes < std::min(f.stride(), max_lanes) &&
+                b.row_offset() == f.row_offset() + lanes &&
+                b.col_offset() == f.col_offset() + lanes && f.same_structure(b)) {
+                ++last.lanes;
+                continue;
+            }
+        }
+        batches.push_back({i, 1, 0, 0});
+    }
+
+    work.assign(1, 0);
+    reach.clear();
+    ordered = true;
+    for (auto& [first, lanes, begin, end] : batches) {
+        const auto& f = blocks[first];
+        work.push_back(work.back() + f.rows() * lanes);
+
+        begin = f.row_offset();
+        end = f.rows() ? begin + (f.rows() - 1) * f.stride() + lanes : begin;
+
+        if (!reach.empty()) ordered = ordered && batches[reach.size() - 1].begin <= begin;
+        reach.push_back(reach.empty() ? end : std::max(reach.back(), end));
+    }
+}
+
+namespace
+{
+// first local row of a line starting at `offset` whose global row is at least `row`
+integer local_row(integer row, integer offset, integer stride, integer rows)
+{
+    const auto d = row - offset;
+    const auto k = d > 0 ? (d + stride - 1) / stride : 0;
+    return std::min(k, rows);
+}
+} // namespace
+
+template <typename Op>
+void block::apply_rows(integer first,
+                       integer last,
+                       std::span<const real> x,
+                       std::span<real> b,
+                       Op op) const
+{
+    // skip the batches that end before `first`
+    auto i = std::ranges::upper_bound(reach, first) - reach.begin();
+
+    for (; i < (integer)batches.size(); i++) {
+        const auto [j, lanes, begin, end] = batches[i];
+        if (begin >= last) {
+            if (ordered) break;
+            continue;
+        }
+        if (end <= first) continue;
+
+        const auto& blk = blocks[j];
+        const auto st = blk.stride();
+        const auto n = blk.rows();
+
+        // the lanes normally agree on the rows to update.  Otherwise do them one by one
+        const auto k0 = local_row(first, begin, st, n);
+        const auto k1 = local_row(last, begin, st, n);
+        if (k0 == local_row(first, begin + lanes - 1, st, n) &&
+            k1 == local_row(last, begin + lanes - 1, st, n)) {
+            blk.apply_rows(k0, k1, lanes, x, b, op);
+        } else {
+            for (integer l = 0; l < lanes; l++)
+                blocks[j + l].apply_rows(local_row(first, begin + l, st, n),
+                                         local_row(last, begin + l, st, n),
+                                         1,
+                                         x,
+                                         b,
+                                         op);
+        }
+    }
+}
+
+template void block::apply_rows<eq_t>(
+    integer, integer, std::span<const real>, std::span<real>, eq_t) const;
+
+template void block::apply_rows<plus_eq_t>(
+    integer, integer, std::span<const real>, std::span<real>, plus_eq_t) const;
+
+} // namespace ccs::matrix
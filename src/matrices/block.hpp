@@ -1,6 +1,7 @@
 #pragma once
 
 #include "inner_block.hpp"
+#include "parallel/thread_pool.hpp"
 
 #include <concepts>
 
@@ -10,14 +11,44 @@ namespace ccs::matrix
 // Due to the requirements of a cut-cell mesh, the InnerBlocks may not be adjacent to
 // eachother.  To simplify construction, a builder class is exposed which computes all
 // the zero locations at the end of the construction process
+//
+// Lines in the non-unit-stride directions are interleaved in memory: neighboring lines
+// differ by one in their offsets.  When such neighbors also share coefficients they are
+// grouped into a batch at construction and applied together, one row at a time across
+// all lanes, so the inner loops run over contiguous memory.  Batches are split across
+// the default thread pool; each row is written by exactly one thread so the result does
+// not depend on the thread count.
 class block
 {
+    struct batch {
+        integer first;
+        integer lanes;
+        // range of rows in the output touched by the batch
+        integer begin;
+        integer end;
+    };
+
     std::vector<inner_block> blocks;
+    std::vector<batch> batches;
+    // number of rows in batches [0, i) for balancing the work across threads
+    std::vector<integer> work;
+    // largest `end` of batches [0, i] and whether the batches are sorted by `begin`.
+    // Used to find the batches touching a range of rows
+    std::vector<integer> reach;
+    bool ordered = true;
+
+    // avoid waking the pool for small operators
+    static constexpr integer min_work = 1 << 14;
+    // bound the size of a batch so a direction with few batches can still be split
+    // across threads
+    static constexpr integer max_lanes = 64;
+
+    void build_batches();
 
 public:
     block() = default;
 
-    block(std::vector<inner_block>&& blocks) : blocks{std::move(blocks)} {}
+    block(std::vector<inner_block>&& blocks);
 
     integer rows() const
     {
@@ -30,15 +61,33 @@ public:
     template <typename Op = eq_t>
     void operator()(std::span<const real> x, std::span<real> b, Op op = {}) const
     {
-        for (auto&& block : blocks) { block(x, b, op); }
+        parallel_for(work, min_work, [&](integer first, integer last) {
+            for (integer i = first; i < last; i++) {
+                const auto [j, lanes, begin, end] = batches[i];
+                if (lanes == 1)
+                    blocks[j](x, b, op);
+                else
+                    blocks[j].apply_lanes(lanes, x, b, op);
+            }
+        });
     }
 
+    // only update the rows of b in [first, last).  Lets several operators be fused into
+    // one sweep over the domain.  Runs on the calling thread
+    template <typename Op = eq_t>
+    void apply_rows(integer first,
+                    integer last,
+                    std::span<const real> x,
+                    std::span<real> b,
+                    Op op = {}) const;
+
     void visit(visitor& v) const
     {
         for (auto&& block : blocks) { block.visit(v); }
     }
 
     struct builder;
+    struct refill;
 };
 
 struct block::builder {
@@ -54,4 +103,28 @@ struct block::builder {
 
     block to_block() && { return block{MOVE(b)}; }
 };
+
+// Overwrites the boundary coefficients of a block with the inner blocks visited in the
+// order they were added to its builder.  The batches are regrouped by `finish` since
+// blocks sharing coefficients before may no longer do so
+struct block::refill {
+    block& m;
+    integer n = 0;
+
+    template <rs::input_range R>
+    void left(R&& rng)
+    {
+        m.blocks[n].assign_left(FWD(rng));
+    }
+
+    template <rs::input_range R>
+    void right(R&& rng)
+    {
+        m.blocks[n].assign_right(FWD(rng));
+    }
+
+    void next() { ++n; }
+
+    void finish() { m.build_batches(); }
+};
 } // namespace ccs::matrix
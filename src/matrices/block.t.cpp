@@ -224,4 +224,120 @@ TEST_CASE("strided")
 
         REQUIRE_THAT(bp, Approx(bb));
     }
-}
\ No newline at end of file
+}
+TEST_CASE("batched lines")
+{
+    // Adjacent strided lines with shared coefficients are applied together.  The result
+    // must match applying each line on its own, including when a line in the middle
+    // breaks the batch
+    using T = std::vector<real>;
+
+    const integer columns = 20;
+    const integer stride = 7;
+
+    const T lc = vs::generate_n(g, 4 * 6) | rs::to<T>();
+    const T ic = vs::generate_n(g, 7) | rs::to<T>();
+    const T rc = vs::generate_n(g, 3 * 5) | rs::to<T>();
+    T rc_other = rc;
+    rc_other[0] += 1.0;
+
+    std::vector<matrix::inner_block> lines;
+    for (integer i = 0; i < stride; i++)
+        lines.emplace_back(columns,
+                           i,
+                           i,
+                           stride,
+                           matrix::dense(4, 6, lc),
+                           matrix::circulant(columns - 7, ic),
+                           matrix::dense(3, 5, i == 3 ? rc_other : rc));
+
+    const auto A = matrix::block{std::vector{lines}};
+
+    const T x = vs::generate_n(g, columns * stride) | rs::to<T>();
+    T b = vs::generate_n(g, x.size()) | rs::to<T>();
+    T bb = b;
+
+    A(x, b);
+    for (auto&& line : lines) line(x, bb);
+    REQUIRE(rs::equal(b, bb));
+
+    A(x, b, plus_eq);
+    for (auto&& line : lines) line(x, bb, plus_eq);
+    REQUIRE(rs::equal(b, bb));
+}
+
+TEST_CASE("threads")
+{
+    // x-lines of a 300 x 400 grid.  Results must not depend on the thread count
+    using T = std::vector<real>;
+
+    const integer columns = 300;
+    const integer stride = 400;
+
+    const T lc = vs::generate_n(g, 4 * 6) | rs::to<T>();
+    const T ic = vs::generate_n(g, 7) | rs::to<T>();
+    const T rc = vs::generate_n(g, 3 * 5) | rs::to<T>();
+
+    auto bld = matrix::block::builder(stride);
+    for (integer i = 0; i < stride; i++)
+        bld.add_inner_block(columns,
+                            i,
+                            i,
+                            stride,
+                            matrix::dense(4, 6, lc),
+                            matrix::circulant(columns - 7, ic),
+                            matrix::dense(3, 5, rc));
+    const auto A = MOVE(bld).to_block();
+
+    const T x = vs::generate_n(g, columns * stride) | rs::to<T>();
+    const T b0 = vs::generate_n(g, x.size()) | rs::to<T>();
+
+    set_thread_count(1);
+    T b = b0;
+    A(x, b, plus_eq);
+
+    for (int threads : {2, 3, 8}) {
+        set_thread_count(threads);
+        T bb = b0;
+        A(x, bb, plus_eq);
+        REQUIRE(rs::equal(b, bb));
+    }
+    set_thread_count(1);
+}
+
+TEST_CASE("apply rows")
+{
+    // Applying the block over consecutive ranges of rows must match applying it at once
+    using T = std::vector<real>;
+
+    const integer columns = 9;
+    const integer stride = 11;
+
+    const T lc = vs::generate_n(g, 3 * 4) | rs::to<T>();
+    const T ic = vs::generate_n(g, 3) | rs::to<T>();
+    const T rc = vs::generate_n(g, 2 * 3) | rs::to<T>();
+
+    auto bld = matrix::block::builder(stride);
+    for (integer i = 0; i < stride; i++)
+        bld.add_inner_block(columns,
+                            i,
+                            i,
+                            stride,
+                            matrix::dense(3, 4, lc),
+                            matrix::circulant(columns - 5, ic),
+                            matrix::dense(2, 3, rc));
+    const auto A = MOVE(bld).to_block();
+    const integer n = columns * stride;
+
+    const T x = vs::generate_n(g, n) | rs::to<T>();
+    const T b0 = vs::generate_n(g, n) | rs::to<T>();
+    T b = b0;
+    A(x, b, plus_eq);
+
+    for (integer tile : {1, 5, 11, 30, 99}) {
+        T bb = b0;
+        for (integer first = 0; first < n; first += tile)
+            A.apply_rows(first, std::min(n, first + tile), x, bb, plus_eq);
+        REQUIRE(rs::equal(b, bb));
+    }
+}
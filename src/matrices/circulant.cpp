@@ -1,24 +1,67 @@
 #include "circulant.hpp"
+#include "kernels.hpp"
 
+#include <algorithm>
 #include <cassert>
 
-#include <range/v3/algorithm/copy.hpp>
-#include <range/v3/numeric/inner_product.hpp>
-#include <range/v3/range/concepts.hpp>
-#include <range/v3/view/drop.hpp>
-#include <range/v3/view/repeat_n.hpp>
-#include <range/v3/view/sliding.hpp>
-#include <range/v3/view/stride.hpp>
-#include <range/v3/view/zip.hpp>
-#include <range/v3/view/zip_with.hpp>
-
 namespace ccs::matrix
 {
 
+namespace
+{
+template <int N, typename Op>
+void fixed_width(std::span<const real> v,
+                 const real* x,
+                 real* b,
+                 integer rows,
+                 integer st,
+                 integer lanes)
+{
+    if (lanes > 1)
+        detail::circulant_lanes<N, Op>(v.data(), x, b, rows, st, lanes);
+    else if (st == 1)
+        detail::circulant_unit_stride<N, Op>(v.data(), x, b, rows);
+    else
+        detail::circulant_strided<N, Op>(v.data(), x, b, rows, st);
+}
+
+template <typename Op>
+void any_width(std::span<const real> v,
+               const real* x,
+               real* b,
+               integer rows,
+               integer st,
+               integer lanes)
+{
+    if (lanes > 1)
+        detail::circulant_generic_lanes<Op>(v.data(), v.size(), x, b, rows, st, lanes);
+    else
+        detail::circulant_generic<Op>(v.data(), v.size(), x, b, rows, st);
+}
+
+template <typename Op>
+auto kernel_for(integer width)
+{
+    switch (width) {
+    case 3:
+        return &fixed_width<3, Op>;
+    case 5:
+        return &fixed_width<5, Op>;
+    case 7:
+        return &fixed_width<7, Op>;
+    case 9:
+        return &fixed_width<9, Op>;
+    default:
+        return &any_width<Op>;
+    }
+}
+} // namespace
+
 circulant::circulant(integer rows, std::span<const real> coeffs)
     : matrix_base{rows, rows + (integer)coeffs.size() - 1, (integer)coeffs.size() / 2},
       v{coeffs}
 {
+    select_kernels();
 }
 
 circulant::circulant(integer rows,
@@ -28,39 +71,60 @@ circulant::circulant(integer rows,
     : matrix_base{rows, rows + (integer)coeffs.size() - 1, row_offset, -1, stride},
       v{coeffs}
 {
+    select_kernels();
+}
+
+void circulant::select_kernels()
+{
+    eq_kernel = kernel_for<eq_t>(size());
+    plus_eq_kernel = kernel_for<plus_eq_t>(size());
+}
+
+bool circulant::same_structure(const circulant& o) const
+{
+    return rows() == o.rows() && stride() == o.stride() &&
+           std::ranges::equal(v, o.v);
 }
 
 template <typename Op>
 void circulant::operator()(std::span<const real> x, std::span<real> b, Op op) const
 {
+    apply_lanes(1, x, b, op);
+}
+
+template <typename Op>
+void circulant::apply_lanes(integer lanes,
+                            std::span<const real> x,
+                            std::span<real> b,
+                            Op op) const
+{
+    apply_rows(0, rows(), lanes, x, b, op);
+}
+
+template <typename Op>
+void circulant::apply_rows(integer first,
+                           integer last,
+                           integer lanes,
+                           std::span<const real> x,
+                           std::span<real> b,
+                           Op) const
+{
+    assert(first >= 0 && last <= rows());
     assert(row_offset() >= stride() * (size() / 2));
-    assert((integer)b.size() >= row_offset() + rows() * stride());
-    assert((integer)x.size() >= row_offset() + (rows() + (size() / 2) - 1) * stride());
+    assert((integer)b.size() >= row_offset() + rows() * stride() + lanes - 1);
+    assert((integer)x.size() >=
+           row_offset() + (rows() + (size() / 2) - 1) * stride() + lanes - 1);
+    if (first >= last) return;
+
     // move input and output spans to correct position
     const auto st = stride();
-    x = x.subspan(row_offset() - st * (size() / 2));
-    b = b.subspan(row_offset());
-
-    if (st == 1) {
-        auto rng =
-            vs::zip_with([](auto&& a, auto&& b) { return rs::inner_product(a, b, 0.0); },
-                         vs::repeat_n(v, rows()),
-                         x | vs::sliding(size()));
-
-        // rs::copy(rng, rs::begin(b));
-        for (auto&& [y, z] : vs::zip(b, rng)) op(y, z);
-    } else {
-        auto in = x | vs::stride(st);
-        auto out = b | vs::stride(st);
-
-        auto rng =
-            vs::zip_with([](auto&& a, auto&& b) { return rs::inner_product(a, b, 0.0); },
-                         vs::repeat_n(v, rows()),
-                         in | vs::sliding(size()));
-
-        // rs::copy(rng, rs::begin(out));
-        for (auto&& [y, z] : vs::zip(out, rng)) op(y, z);
-    }
+    x = x.subspan(row_offset() + st * (first - size() / 2));
+    b = b.subspan(row_offset() + st * first);
+
+    if constexpr (std::same_as<Op, plus_eq_t>)
+        plus_eq_kernel(v, x.data(), b.data(), last - first, st, lanes);
+    else
+        eq_kernel(v, x.data(), b.data(), last - first, st, lanes);
 }
 
 template void
@@ -68,4 +132,18 @@ circulant::operator()<eq_t>(std::span<const real>, std::span<real>, eq_t) const;
 template void
 circulant::operator()<plus_eq_t>(std::span<const real>, std::span<real>, plus_eq_t) const;
 
+template void circulant::apply_lanes<eq_t>(integer,
+                                           std::span<const real>,
+                                           std::span<real>,
+                                           eq_t) const;
+template void circulant::apply_lanes<plus_eq_t>(integer,
+                                                std::span<const real>,
+                                                std::span<real>,
+                                                plus_eq_t) const;
+
+template void circulant::apply_rows<eq_t>(
+    integer, integer, integer, std::span<const real>, std::span<real>, eq_t) const;
+template void circulant::apply_rows<plus_eq_t>(
+    integer, integer, integer, std::span<const real>, std::span<real>, plus_eq_t) const;
+
 } // namespace ccs::matrix
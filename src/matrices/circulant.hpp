@@ -11,6 +11,15 @@ class circulant : public matrix_base
 {
     std::span<const real> v;
 
+    // interior kernels specialized on the width of the stencil.  They are selected when
+    // the matrix is built so the call operator does not need to dispatch on size()
+    using kernel =
+        void (*)(std::span<const real>, const real*, real*, integer, integer, integer);
+    kernel eq_kernel = nullptr;
+    kernel plus_eq_kernel = nullptr;
+
+    void select_kernels();
+
 public:
     circulant() = default;
 
@@ -26,9 +35,29 @@ public:
     template <typename Op = eq_t>
     void operator()(std::span<const real> x, std::span<real> b, Op op = {}) const;
 
+    // apply the matrix to `lanes` adjacent lines.  Line `l` is offset from the first
+    // by `l` rows and columns
+    template <typename Op = eq_t>
+    void apply_lanes(integer lanes,
+                     std::span<const real> x,
+                     std::span<real> b,
+                     Op op = {}) const;
+
+    // apply rows [first, last) of the matrix to `lanes` adjacent lines
+    template <typename Op = eq_t>
+    void apply_rows(integer first,
+                    integer last,
+                    integer lanes,
+                    std::span<const real> x,
+                    std::span<real> b,
+                    Op op = {}) const;
+
     void visit(visitor& v) const { return v.visit(*this); }
 
     std::span<const real> data() const { return v; }
+
+    // same shape and coefficients
+    bool same_structure(const circulant&) const;
 };
 
 } // namespace ccs::matrix
@@ -5,15 +5,22 @@
 #include <catch2/matchers/catch_matchers_vector.hpp>
 
 #include "random/random.hpp"
+#include <chrono>
+#include <iostream>
 #include <vector>
 
+#include <range/v3/numeric/inner_product.hpp>
 #include <range/v3/range/conversion.hpp>
 #include <range/v3/view/drop.hpp>
 #include <range/v3/view/generate_n.hpp>
 #include <range/v3/view/iota.hpp>
+#include <range/v3/view/repeat_n.hpp>
+#include <range/v3/view/sliding.hpp>
 #include <range/v3/view/stride.hpp>
 #include <range/v3/view/take.hpp>
 #include <range/v3/view/transform.hpp>
+#include <range/v3/view/zip.hpp>
+#include <range/v3/view/zip_with.hpp>
 
 using namespace ccs;
 using Catch::Matchers::Approx;
@@ -114,3 +121,100 @@ TEST_CASE("stride")
         REQUIRE_THAT(q, Approx(r));
     }
 }
+
+namespace
+{
+// reference implementation of a strided circulant product
+template <typename Op>
+std::vector<real> reference(const std::vector<real>& c,
+                            integer rows,
+                            integer offset,
+                            integer stride,
+                            const std::vector<real>& x,
+                            std::vector<real> b,
+                            Op op)
+{
+    const integer n = c.size();
+    for (integer i = 0; i < rows; i++) {
+        real s = 0.0;
+        for (integer k = 0; k < n; k++)
+            s += c[k] * x[offset + (i + k - n / 2) * stride];
+        op(b[offset + i * stride], s);
+    }
+    return b;
+}
+} // namespace
+
+TEST_CASE("stencil widths")
+{
+    using T = std::vector<real>;
+    randomize();
+
+    // 3, 5, 7, 9 have specialized kernels while 11 goes through the generic path
+    for (integer width : {3, 5, 7, 9, 11}) {
+        const T coeffs = vs::generate_n(g, width) | rs::to<T>();
+
+        for (integer stride : {1, 3}) {
+            // pick enough rows to exercise both vector lanes and the scalar remainder
+            const integer rows = 37;
+            const integer offset = stride * (width / 2) + 1;
+            const auto A = matrix::circulant{rows, offset, stride, coeffs};
+            const auto x =
+                vs::generate_n(g, offset + (rows + width) * stride) | rs::to<T>();
+            const auto b0 = vs::generate_n(g, x.size()) | rs::to<T>();
+
+            auto b = b0;
+            A(x, b);
+            REQUIRE_THAT(b, Approx(reference(coeffs, rows, offset, stride, x, b0, eq)));
+
+            b = b0;
+            A(x, b, plus_eq);
+            REQUIRE_THAT(b,
+                         Approx(reference(coeffs, rows, offset, stride, x, b0, plus_eq)));
+        }
+    }
+}
+
+// Compare throughput of the width specialized kernels against the range-v3 expression
+// they replaced.  Hidden by default; run with `t-circulant "[benchmark]"`
+TEST_CASE("kernel throughput", "[.][benchmark]")
+{
+    using T = std::vector<real>;
+    using clock = std::chrono::steady_clock;
+    randomize();
+
+    const integer rows = 1 << 20;
+    const int reps = 20;
+
+    auto range_path = [](const T& v, std::span<const real> x, std::span<real> b) {
+        auto rng =
+            vs::zip_with([](auto&& a, auto&& b) { return rs::inner_product(a, b, 0.0); },
+                         vs::repeat_n(v, rs::size(b)),
+                         x | vs::sliding(v.size()));
+        for (auto&& [y, z] : vs::zip(b, rng)) y = z;
+    };
+
+    auto gflops = [&](integer width, auto&& f) {
+        auto t0 = clock::now();
+        for (int i = 0; i < reps; i++) f();
+        std::chrono::duration<double> dt = clock::now() - t0;
+        return 2.0 * width * rows * reps / dt.count() * 1e-9;
+    };
+
+    for (integer width : {3, 5, 7, 9}) {
+        const T coeffs = vs::generate_n(g, width) | rs::to<T>();
+        const auto A = matrix::circulant{rows, coeffs};
+        const auto x = vs::generate_n(g, rows + width) | rs::to<T>();
+        auto b = T(x.size());
+        auto b_ref = T(x.size());
+
+        const auto kernel = gflops(width, [&]() { A(x, b); });
+        const auto range = gflops(width, [&]() {
+            range_path(coeffs, x, std::span(b_ref).subspan(width / 2, rows));
+        });
+
+        REQUIRE_THAT(b, Approx(b_ref));
+        std::cout << "width " << width << ": kernel " << kernel << " GFLOP/s, range-v3 "
+                  << range << " GFLOP/s\n";
+    }
+}
@@ -4,6 +4,8 @@
 #include "matrix_visitor.hpp"
 #include "unit_stride_visitor.hpp"
 
+#include <algorithm>
+
 namespace ccs::matrix
 {
 class coefficient_visitor : public visitor
@@ -23,6 +25,9 @@ public:
 
     std::span<const real> matrix() const { return m; }
 
+    // zero the coefficients so an operator with the same structure can be visited again
+    void clear() { std::ranges::fill(m, 0.0); }
+
     const real* data() const { return m.data(); }
     real* data() { return m.data(); }
 };
@@ -1,4 +1,9 @@
 #include "csr.hpp"
+#include "parallel/thread_pool.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <numeric>
 
 #include <range/v3/algorithm/sort.hpp>
 #include <range/v3/view/enumerate.hpp>
@@ -30,9 +35,55 @@ csr csr::builder::to_csr(integer nrows)
                u};
 }
 
+csr csr::builder::to_csr(integer nrows, std::vector<integer>& slots)
+{
+    // sort a permutation of the points, in the same order as above, so the slot of each
+    // point is known
+    std::vector<integer> order(p.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::ranges::stable_sort(
+        order, std::less<>{}, [this](integer i) -> const pts& { return p[i]; });
+
+    slots.resize(p.size());
+    for (auto&& [k, i] : vs::enumerate(order)) slots[i] = k;
+
+    std::vector<integer> u(nrows + 1);
+    for (auto&& pt : p) {
+        assert(pt.row < nrows);
+        ++u[pt.row + 1];
+    }
+    std::partial_sum(u.begin(), u.end(), u.begin());
+
+    return csr{order | vs::transform([this](integer i) { return p[i].v; }),
+               order | vs::transform([this](integer i) { return p[i].col; }),
+               u};
+}
+
 void csr::operator()(std::span<const real> x, std::span<real> b) const
 {
-    for (integer row = 0; row < rows(); row++)
+    // u doubles as the running count of nonzeros so rows are split by work
+    parallel_for(u, min_work, [&](integer first, integer last) {
+        for (integer row = first; row < last; row++)
+            for (integer i = u[row]; i < u[row + 1]; i++) b[row] += w[i] * x[v[i]];
+    });
+}
+
+void csr::apply_rows(integer first,
+                     integer last,
+                     std::span<const real> x,
+                     std::span<real> b) const
+{
+    last = std::min(last, rows());
+    for (integer row = first; row < last; row++)
+        for (integer i = u[row]; i < u[row + 1]; i++) b[row] += w[i] * x[v[i]];
+}
+
+void csr::apply_rows(std::span<const integer> selected,
+                     std::span<const real> x,
+                     std::span<real> b) const
+{
+    if (rows() == 0) return;
+    for (auto row : selected)
         for (integer i = u[row]; i < u[row + 1]; i++) b[row] += w[i] * x[v[i]];
 }
 
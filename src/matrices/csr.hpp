@@ -17,6 +17,9 @@ class csr
     std::vector<integer> u; // starting column index for rows
     flag f;
 
+    // avoid waking the thread pool for small matrices
+    static constexpr integer min_work = 1 << 14;
+
 public:
     csr() = default;
 
@@ -36,9 +39,20 @@ public:
     // number of non-zero entries
     integer size() const { return (integer)w.size(); }
 
+    // rows are split across the default thread pool
     void operator()(std::span<const real> x, std::span<real> b) const;
 
+    // only accumulate rows [first, last) or the listed rows.  Run on the calling thread
+    void apply_rows(integer first,
+                    integer last,
+                    std::span<const real> x,
+                    std::span<real> b) const;
+    void apply_rows(std::span<const integer> rows,
+                    std::span<const real> x,
+                    std::span<real> b) const;
+
     struct builder;
+    struct refill;
 
     flag flags() const { return f; }
     void flags(flag f_) { f = f_; }
@@ -68,6 +82,20 @@ struct csr::builder {
     }
 
     csr to_csr(integer nrows);
+
+    // as above but also records the position in the value array of each point, in the
+    // order the points were added.  The matrix is the same as the one above
+    csr to_csr(integer nrows, std::vector<integer>& slots);
+};
+
+// Overwrites the values of a matrix built with `builder::to_csr(nrows, slots)` when the
+// points are added in the same order as they were to the builder
+struct csr::refill {
+    csr& m;
+    std::span<const integer> slots;
+    integer n = 0;
+
+    void add_point(integer, integer, real v) { m.w[slots[n++]] = v; }
 };
 
 // using CSR_Builder = csr::builder_;
@@ -4,6 +4,7 @@
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers_vector.hpp>
 
+#include "parallel/thread_pool.hpp"
 #include "random/random.hpp"
 #include <vector>
 
@@ -159,3 +160,71 @@ TEST_CASE("Random Builder")
         REQUIRE_THAT(b, Approx(exact));
     }
 }
+
+TEST_CASE("Refill")
+{
+    using P = matrix::csr::builder::pts;
+    auto pts = std::vector<P>{{6, 6, 1.0},
+                              {0, 6, 2.0},
+                              {9, 0, 3.0},
+                              {6, 9, 4.0},
+                              {0, 1, 5.0},
+                              {6, 6, 6.0},
+                              {2, 4, 7.0}};
+
+    auto builder = matrix::csr::builder();
+    for (auto&& [r, c, v] : pts) builder.add_point(r, c, v);
+
+    std::vector<integer> slots;
+    auto A = builder.to_csr(10, slots);
+    REQUIRE((integer)slots.size() == A.size());
+
+    // laid out like a matrix built without slots, including the repeated point
+    const auto A0 = builder.to_csr(10);
+    for (integer r = 0; r < 10; r++) {
+        REQUIRE(rs::equal(A.column_indices(r), A0.column_indices(r)));
+        REQUIRE(rs::equal(A.column_coefficients(r), A0.column_coefficients(r)));
+    }
+
+    // new values added in the original order should give the same matrix as building
+    // from scratch
+    auto B_ = matrix::csr::builder();
+    auto fill = matrix::csr::refill{A, slots};
+    for (auto&& [r, c, v] : pts) {
+        B_.add_point(r, c, -v * v);
+        fill.add_point(r, c, -v * v);
+    }
+    const auto B = B_.to_csr(10);
+
+    const T x = random_vec(10);
+    T a(x.size()), b(x.size());
+    A(x, a);
+    B(x, b);
+
+    REQUIRE_THAT(a, Approx(b));
+}
+
+TEST_CASE("threads")
+{
+    // large enough to be split across threads
+    const integer rows = 50000;
+    auto builder = matrix::csr::builder();
+    for (integer r = 0; r < rows; r++)
+        for (int j = pick(0, 5); j > 0; j--) builder.add_point(r, pick(0, (int)rows - 1), pick());
+
+    const auto A = builder.to_csr(rows);
+    const T x = random_vec(rows);
+    const T b0 = random_vec(rows);
+
+    set_thread_count(1);
+    T b = b0;
+    A(x, b);
+
+    for (int threads : {2, 3, 8}) {
+        set_thread_count(threads);
+        T bb = b0;
+        A(x, bb);
+        REQUIRE(rs::equal(b, bb));
+    }
+    set_thread_count(1);
+}
@@ -1,13 +1,5 @@
 #include "dense.hpp"
-// range includes
-#include <range/v3/algorithm/copy.hpp>
-#include <range/v3/numeric/inner_product.hpp>
-#include <range/v3/range/concepts.hpp>
-#include <range/v3/view/chunk.hpp>
-#include <range/v3/view/repeat_n.hpp>
-#include <range/v3/view/stride.hpp>
-#include <range/v3/view/zip.hpp>
-#include <range/v3/view/zip_with.hpp>
+#include "kernels.hpp"
 
 #include <cassert>
 
@@ -16,33 +8,47 @@ namespace ccs::matrix
 
 template <typename Op>
 void dense::operator()(std::span<const real> x, std::span<real> b, Op op) const
+{
+    apply_lanes(1, x, b, op);
+}
+
+template <typename Op>
+void dense::apply_lanes(integer lanes, std::span<const real> x, std::span<real> b, Op op) const
+{
+    apply_rows(0, rows(), lanes, x, b, op);
+}
+
+template <typename Op>
+void dense::apply_rows(integer first,
+                       integer last,
+                       integer lanes,
+                       std::span<const real> x,
+                       std::span<real> b,
+                       Op) const
 {
     // sanity checks
-    assert((integer)b.size() >= row_offset() + (rows() - 1) * stride());
-    assert((integer)x.size() >= col_offset() + (columns() - 1) * stride());
+    assert(first >= 0 && last <= rows());
+    assert((integer)b.size() >= row_offset() + (rows() - 1) * stride() + lanes - 1);
+    assert((integer)x.size() >= col_offset() + (columns() - 1) * stride() + lanes - 1);
+    if (first >= last) return;
+
     // move input and output spans to correct position
     x = x.subspan(col_offset());
-    b = b.subspan(row_offset());
-    const auto st = stride();
-
-    if (st == 1) {
-        auto rng =
-            vs::zip_with([](auto&& a, auto&& b) { return rs::inner_product(a, b, 0.0); },
-                         vs::chunk(v, columns()),
-                         vs::repeat_n(x, rows()));
-        // rs::copy(rng, rs::begin(b));
-        for (auto&& [y, z] : vs::zip(b, rng)) op(y, z);
-    } else {
-        auto in = x | vs::stride(st);
-        auto out = b | vs::stride(st);
-
-        auto rng =
-            vs::zip_with([](auto&& a, auto&& b) { return rs::inner_product(a, b, 0.0); },
-                         vs::chunk(v, columns()),
-                         vs::repeat_n(in, rows()));
-        for (auto&& [y, z] : vs::zip(out, rng)) op(y, z);
-        // rs::copy(rng, rs::begin(out));
-    }
+    b = b.subspan(row_offset() + first * stride());
+
+    detail::dense_lanes<Op>(v.data() + first * columns(),
+                            last - first,
+                            columns(),
+                            x.data(),
+                            b.data(),
+                            stride(),
+                            lanes);
+}
+
+bool dense::same_structure(const dense& o) const
+{
+    return rows() == o.rows() && columns() == o.columns() && stride() == o.stride() &&
+           f == o.f && v == o.v;
 }
 
 //
@@ -51,4 +57,18 @@ template void dense::operator()<eq_t>(std::span<const real>, std::span<real>, eq
 template void
 dense::operator()<plus_eq_t>(std::span<const real>, std::span<real>, plus_eq_t) const;
 
+template void
+dense::apply_lanes<eq_t>(integer, std::span<const real>, std::span<real>, eq_t) const;
+
+template void dense::apply_lanes<plus_eq_t>(integer,
+                                            std::span<const real>,
+                                            std::span<real>,
+                                            plus_eq_t) const;
+
+template void dense::apply_rows<eq_t>(
+    integer, integer, integer, std::span<const real>, std::span<real>, eq_t) const;
+
+template void dense::apply_rows<plus_eq_t>(
+    integer, integer, integer, std::span<const real>, std::span<real>, plus_eq_t) const;
+
 } // namespace ccs::matrix
@@ -44,9 +44,36 @@ public:
 
     auto size() const noexcept { return v.size(); }
 
+    // overwrite the coefficients keeping the shape and flags
+    template <rs::input_range R>
+    void assign(R&& rng)
+    {
+        rs::copy(rng | vs::take(v.size()), v.begin());
+    }
+
     template <typename Op = eq_t>
     void operator()(std::span<const real> x, std::span<real> b, Op op = {}) const;
 
+    // apply the matrix to `lanes` adjacent lines.  Line `l` is offset from the first
+    // by `l` rows and columns
+    template <typename Op = eq_t>
+    void apply_lanes(integer lanes,
+                     std::span<const real> x,
+                     std::span<real> b,
+                     Op op = {}) const;
+
+    // apply rows [first, last) of the matrix to `lanes` adjacent lines
+    template <typename Op = eq_t>
+    void apply_rows(integer first,
+                    integer last,
+                    integer lanes,
+                    std::span<const real> x,
+                    std::span<real> b,
+                    Op op = {}) const;
+
+    // same shape, flags and coefficients
+    bool same_structure(const dense&) const;
+
     std::span<const real> data() const { return v; }
     flag flags() const { return f; }
     void flags(flag f_) { f = f_; }
@@ -0,0 +1,105 @@
+#include "gmres.hpp"
+#include "krylov_ops.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace ccs::matrix
+{
+
+gmres::gmres(int restart, real tol, int max_iterations)
+    : restart{restart}, tol{tol}, max_iterations{max_iterations}
+{
+}
+
+void gmres::reserve(integer size)
+{
+    if (n == size) return;
+    n = size;
+
+    const int m = restart;
+    V.assign(n * (m + 1), 0.0);
+    H.assign((m + 1) * m, 0.0);
+    cs.assign(m, 0.0);
+    sn.assign(m, 0.0);
+    g.assign(m + 1, 0.0);
+    h.assign(m + 1, 0.0);
+    // the largest set of block sums is for the dots of the last arnoldi step
+    partial.reserve(((n + reduction_block_rows - 1) / reduction_block_rows) * (m + 1));
+}
+
+gmres::result
+gmres::operator()(const linear_operator& A, std::span<const real> b, std::span<real> x)
+{
+    reserve(b.size());
+
+    const int m = restart;
+    auto col = [this](int j) { return V.data() + j * n; };
+    auto Hij = [this, m](int i, int j) -> real& { return H[i + j * (m + 1)]; };
+
+    const real bnorm = norm(n, b.data(), partial);
+    if (bnorm == 0.0) {
+        std::fill(x.begin(), x.end(), 0.0);
+        return {0, 0.0, true};
+    }
+
+    for (int it = 0;;) {
+        // r = b - A x
+        real* r = col(0);
+        A(x, std::span<real>(r, n));
+        for (integer i = 0; i < n; i++) r[i] = b[i] - r[i];
+        const real beta = norm(n, r, partial);
+
+        if (beta <= tol * bnorm || it >= max_iterations)
+            return {it, beta / bnorm, beta <= tol * bnorm};
+
+        scale(n, 1.0 / beta, r);
+        std::fill(g.begin(), g.end(), 0.0);
+        g[0] = beta;
+
+        // arnoldi steps, reducing H to upper triangular form as it is built
+        int k = 0;
+        while (k < m && it < max_iterations) {
+            const int j = k;
+            real* w = col(j + 1);
+            A(std::span<const real>(col(j), n), std::span<real>(w, n));
+
+            for (int l = 0; l <= j + 1; l++) Hij(l, j) = 0.0;
+            for (int pass = 0; pass < 2; pass++) {
+                dots(n, j + 1, V.data(), w, h.data(), partial);
+                subtract(n, j + 1, V.data(), h.data(), w);
+                for (int l = 0; l <= j; l++) Hij(l, j) += h[l];
+            }
+            const real hnext = norm(n, w, partial);
+            Hij(j + 1, j) = hnext;
+            if (hnext > 0.0) scale(n, 1.0 / hnext, w);
+
+            for (int l = 0; l < j; l++) {
+                const real t = cs[l] * Hij(l, j) + sn[l] * Hij(l + 1, j);
+                Hij(l + 1, j) = -sn[l] * Hij(l, j) + cs[l] * Hij(l + 1, j);
+                Hij(l, j) = t;
+            }
+
+            const real d = std::hypot(Hij(j, j), Hij(j + 1, j));
+            cs[j] = d > 0.0 ? Hij(j, j) / d : 1.0;
+            sn[j] = d > 0.0 ? Hij(j + 1, j) / d : 0.0;
+            Hij(j, j) = d;
+            Hij(j + 1, j) = 0.0;
+            g[j + 1] = -sn[j] * g[j];
+            g[j] = cs[j] * g[j];
+
+            ++k;
+            ++it;
+            if (std::abs(g[k]) <= tol * bnorm || hnext == 0.0) break;
+        }
+
+        // x += V y where H y = g.  -y is stored in h for the update
+        for (int i = k - 1; i >= 0; i--) {
+            real s = g[i];
+            for (int l = i + 1; l < k; l++) s -= Hij(i, l) * -h[l];
+            h[i] = Hij(i, i) != 0.0 ? -s / Hij(i, i) : 0.0;
+        }
+        subtract(n, k, V.data(), h.data(), x.data());
+    }
+}
+} // namespace ccs::matrix
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "common.hpp"
+
+#include <functional>
+#include <span>
+#include <vector>
+
+namespace ccs::matrix
+{
+// Restarted GMRES for a large non-symmetric operator given only through its products.
+// A basis of `restart` vectors is built with classical Gram-Schmidt and one
+// reorthogonalization and the least squares problem is updated with Givens rotations.
+// The workspace, (restart + 1) vectors of the operator size, is kept between solves so
+// repeated solves of the same size do not allocate.
+//
+// As with the Krylov-Schur solver the reductions do not depend on the thread count.
+class gmres
+{
+    int restart = 30;
+    real tol = 1e-10;
+    int max_iterations = 500;
+
+    integer n = 0;
+    std::vector<real> V, H, cs, sn, g, h, partial;
+
+public:
+    using linear_operator = std::function<void(std::span<const real>, std::span<real>)>;
+
+    struct result {
+        int iterations;
+        // final residual norm relative to the norm of b
+        real residual;
+        bool converged;
+    };
+
+    gmres() = default;
+
+    // iterate until the residual norm is below `tol` times the norm of b
+    gmres(int restart, real tol = 1e-10, int max_iterations = 500);
+
+    // allocate the workspace for operators of size n
+    void reserve(integer n);
+
+    // solve A x = b using x as the initial guess
+    result
+    operator()(const linear_operator& A, std::span<const real> b, std::span<real> x);
+};
+} // namespace ccs::matrix
@@ -0,0 +1,124 @@
+#include "gmres.hpp"
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "parallel/thread_pool.hpp"
+#include "random/random.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using namespace ccs;
+using T = std::vector<real>;
+
+namespace
+{
+// I - a D where D is a one sided difference on a periodic grid, a non-symmetric operator
+auto shifted_advection(real a)
+{
+    return [a](std::span<const real> x, std::span<real> y) {
+        const integer n = x.size();
+        for (integer i = 0; i < n; i++) y[i] = x[i] - a * (x[i] - x[(i + n - 1) % n]);
+    };
+}
+
+real residual(const matrix::gmres::linear_operator& A, const T& b, const T& x)
+{
+    T r(b.size());
+    A(x, r);
+    real s = 0.0, bs = 0.0;
+    for (std::size_t i = 0; i < b.size(); i++) {
+        s += (b[i] - r[i]) * (b[i] - r[i]);
+        bs += b[i] * b[i];
+    }
+    return std::sqrt(s / bs);
+}
+} // namespace
+
+TEST_CASE("diagonal")
+{
+    const integer n = 200;
+    auto A = [](std::span<const real> x, std::span<real> y) {
+        for (integer i = 0; i < (integer)x.size(); i++) y[i] = (i + 1) * x[i];
+    };
+
+    T b(n), x(n, 0.0);
+    std::ranges::generate(b, []() { return pick(); });
+
+    auto solver = matrix::gmres{40, 1e-12};
+    const auto res = solver(A, b, x);
+    REQUIRE(res.converged);
+    REQUIRE(res.residual <= 1e-12);
+    for (integer i = 0; i < n; i++) REQUIRE(x[i] == Catch::Approx(b[i] / (i + 1)));
+}
+
+TEST_CASE("restarts")
+{
+    // more iterations than the basis size are needed
+    const integer n = 500;
+    const auto A = matrix::gmres::linear_operator{shifted_advection(-4.0)};
+
+    T b(n), x(n, 0.0);
+    std::ranges::generate(b, []() { return pick(); });
+
+    auto solver = matrix::gmres{10, 1e-10, 1000};
+    const auto res = solver(A, b, x);
+    REQUIRE(res.converged);
+    REQUIRE(res.iterations > 10);
+    REQUIRE(residual(A, b, x) <= 1e-9);
+
+    // a converged guess needs no iterations
+    const auto again = solver(A, b, x);
+    REQUIRE(again.converged);
+    REQUIRE(again.iterations == 0);
+}
+
+TEST_CASE("zero rhs")
+{
+    const auto A = matrix::gmres::linear_operator{shifted_advection(-1.0)};
+    T b(20, 0.0), x(20, 1.0);
+
+    auto solver = matrix::gmres{};
+    const auto res = solver(A, b, x);
+    REQUIRE(res.converged);
+    REQUIRE(std::ranges::all_of(x, [](real v) { return v == 0.0; }));
+}
+
+TEST_CASE("iteration limit")
+{
+    const integer n = 500;
+    const auto A = matrix::gmres::linear_operator{shifted_advection(-4.0)};
+
+    T b(n), x(n, 0.0);
+    std::ranges::generate(b, []() { return pick(); });
+
+    auto solver = matrix::gmres{5, 1e-14, 7};
+    const auto res = solver(A, b, x);
+    REQUIRE(!res.converged);
+    REQUIRE(res.iterations == 7);
+    REQUIRE(res.residual < 1.0);
+}
+
+TEST_CASE("threads")
+{
+    const integer n = 1 << 16;
+    const auto A = matrix::gmres::linear_operator{shifted_advection(-2.0)};
+
+    T b(n);
+    std::ranges::generate(b, []() { return pick(); });
+
+    auto solver = matrix::gmres{20, 1e-10, 60};
+    set_thread_count(1);
+    T x(n, 0.0);
+    solver(A, b, x);
+
+    for (int threads : {2, 4}) {
+        set_thread_count(threads);
+        T y(n, 0.0);
+        solver(A, b, y);
+        REQUIRE(y == x);
+    }
+    set_thread_count(1);
+}
@@ -1,5 +1,7 @@
 #include "inner_block.hpp"
 
+#include <algorithm>
+
 namespace ccs::matrix
 {
 // Block matrix arising from method-of-lines discretization along a line.  A full domain
@@ -47,6 +49,49 @@ void inner_block::operator()(std::span<const real> x, std::span<real> b, Op op)
     right_boundary(x, b, op);
 }
 
+template <typename Op>
+void inner_block::apply_lanes(integer lanes,
+                              std::span<const real> x,
+                              std::span<real> b,
+                              Op op) const
+{
+    left_boundary.apply_lanes(lanes, x, b, op);
+    interior.apply_lanes(lanes, x, b, op);
+    right_boundary.apply_lanes(lanes, x, b, op);
+}
+
+template <typename Op>
+void inner_block::apply_rows(integer first,
+                             integer last,
+                             integer lanes,
+                             std::span<const real> x,
+                             std::span<real> b,
+                             Op op) const
+{
+    // split the row range between the component matrices
+    auto sub = [&](const auto& mat, integer shift) {
+        const auto n = mat.rows();
+        mat.apply_rows(std::clamp(first - shift, integer{0}, n),
+                       std::clamp(last - shift, integer{0}, n),
+                       lanes,
+                       x,
+                       b,
+                       op);
+    };
+
+    sub(left_boundary, 0);
+    sub(interior, left_boundary.rows());
+    sub(right_boundary, left_boundary.rows() + interior.rows());
+}
+
+bool inner_block::same_structure(const inner_block& o) const
+{
+    return rows() == o.rows() && columns() == o.columns() && stride() == o.stride() &&
+           left_boundary.same_structure(o.left_boundary) &&
+           interior.same_structure(o.interior) &&
+           right_boundary.same_structure(o.right_boundary);
+}
+
 template void
 inner_block::operator()<eq_t>(std::span<const real>, std::span<real>, eq_t) const;
 
@@ -54,4 +99,20 @@ template void inner_block::operator()<plus_eq_t>(std::span<const real>,
                                                  std::span<real>,
                                                  plus_eq_t) const;
 
+template void inner_block::apply_lanes<eq_t>(integer,
+                                             std::span<const real>,
+                                             std::span<real>,
+                                             eq_t) const;
+
+template void inner_block::apply_lanes<plus_eq_t>(integer,
+                                                  std::span<const real>,
+                                                  std::span<real>,
+                                                  plus_eq_t) const;
+
+template void inner_block::apply_rows<eq_t>(
+    integer, integer, integer, std::span<const real>, std::span<real>, eq_t) const;
+
+template void inner_block::apply_rows<plus_eq_t>(
+    integer, integer, integer, std::span<const real>, std::span<real>, plus_eq_t) const;
+
 } // namespace ccs::matrix
\ No newline at end of file
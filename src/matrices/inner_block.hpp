@@ -40,6 +40,40 @@ public:
     template <typename Op = eq_t>
     void operator()(std::span<const real> x, std::span<real> b, Op op = {}) const;
 
+    // apply to `lanes` adjacent lines sharing this block's structure.  Line `l` starts at
+    // row_offset() + l and col_offset() + l
+    template <typename Op = eq_t>
+    void apply_lanes(integer lanes,
+                     std::span<const real> x,
+                     std::span<real> b,
+                     Op op = {}) const;
+
+    // apply rows [first, last) of the block to `lanes` adjacent lines
+    template <typename Op = eq_t>
+    void apply_rows(integer first,
+                    integer last,
+                    integer lanes,
+                    std::span<const real> x,
+                    std::span<real> b,
+                    Op op = {}) const;
+
+    // overwrite the coefficients of the boundary matrices.  The interior coefficients
+    // are not owned by the block
+    template <rs::input_range R>
+    void assign_left(R&& rng)
+    {
+        left_boundary.assign(FWD(rng));
+    }
+
+    template <rs::input_range R>
+    void assign_right(R&& rng)
+    {
+        right_boundary.assign(FWD(rng));
+    }
+
+    // true if `o` differs from this block only in its offsets
+    bool same_structure(const inner_block& o) const;
+
     void visit(visitor& v) const
     {
         v.visit(left_boundary);
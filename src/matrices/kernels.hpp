@@ -0,0 +1,275 @@
+#pragma once
+
+#include "types.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+
+#if defined(__AVX2__) || defined(__AVX512F__)
+#include <immintrin.h>
+#endif
+
+// Hand vectorized kernels for applying the matrices that make up a `block`.
+//
+// Circulant interior kernels:  The width of
+// the stencil is a template parameter so the inner product is fully unrolled and the
+// coefficients live in registers.  Vectorization is across rows: each lane computes one
+// row of the product.  AVX-512 and AVX2 paths are chosen at compile time with a scalar
+// fallback.  Every row, whether computed in a vector lane or in the scalar remainder, is
+// evaluated with the same sequence of (fused) multiply-adds so results do not depend on
+// how the rows are split up.
+//
+// Lane kernels:
+// Lines in the x and y directions have large strides but neighbouring lines in the fast
+// direction are adjacent in memory.  The lane kernels apply the same matrix to `lanes`
+// such lines at once, turning the strided access into unit stride loops over the lanes.
+// They use the same multiply-add sequence as the single line kernels.
+namespace ccs::matrix::detail
+{
+
+// multiply-add matching the rounding of the vector lanes
+inline real madd(real a, real b, real c)
+{
+#if defined(__FMA__) || defined(__AVX512F__)
+    return std::fma(a, b, c);
+#else
+    return a * b + c;
+#endif
+}
+
+template <typename Op>
+inline void apply_op(real& y, real z)
+{
+    if constexpr (std::same_as<Op, plus_eq_t>)
+        y += z;
+    else
+        y = z;
+}
+
+// inner product of a width N stencil with x[0], x[st], ..., x[(N-1) st]
+template <int N>
+inline real row_product(const real* v, const real* x, integer st)
+{
+    real acc = v[0] * x[0];
+    for (int k = 1; k < N; k++) acc = madd(v[k], x[k * st], acc);
+    return acc;
+}
+
+inline real row_product(const real* v, integer n, const real* x, integer st)
+{
+    real acc = v[0] * x[0];
+    for (integer k = 1; k < n; k++) acc = madd(v[k], x[k * st], acc);
+    return acc;
+}
+
+#if defined(__AVX512F__)
+constexpr int simd_width = 8;
+#elif defined(__AVX2__)
+constexpr int simd_width = 4;
+#else
+constexpr int simd_width = 1;
+#endif
+
+//
+// b[i] op sum_k v[k] x[i + k] for 0 <= i < rows
+//
+template <int N, typename Op>
+void circulant_unit_stride(const real* v, const real* x, real* b, integer rows)
+{
+    integer i = 0;
+#if defined(__AVX512F__)
+    __m512d c[N];
+    for (int k = 0; k < N; k++) c[k] = _mm512_set1_pd(v[k]);
+
+    for (; i + 8 <= rows; i += 8) {
+        __m512d acc = _mm512_mul_pd(c[0], _mm512_loadu_pd(x + i));
+        for (int k = 1; k < N; k++)
+            acc = _mm512_fmadd_pd(c[k], _mm512_loadu_pd(x + i + k), acc);
+        if constexpr (std::same_as<Op, plus_eq_t>)
+            acc = _mm512_add_pd(_mm512_loadu_pd(b + i), acc);
+        _mm512_storeu_pd(b + i, acc);
+    }
+#elif defined(__AVX2__)
+    __m256d c[N];
+    for (int k = 0; k < N; k++) c[k] = _mm256_set1_pd(v[k]);
+
+    for (; i + 4 <= rows; i += 4) {
+        __m256d acc = _mm256_mul_pd(c[0], _mm256_loadu_pd(x + i));
+        for (int k = 1; k < N; k++) {
+#if defined(__FMA__)
+            acc = _mm256_fmadd_pd(c[k], _mm256_loadu_pd(x + i + k), acc);
+#else
+            acc = _mm256_add_pd(_mm256_mul_pd(c[k], _mm256_loadu_pd(x + i + k)), acc);
+#endif
+        }
+        if constexpr (std::same_as<Op, plus_eq_t>)
+            acc = _mm256_add_pd(_mm256_loadu_pd(b + i), acc);
+        _mm256_storeu_pd(b + i, acc);
+    }
+#endif
+    for (; i < rows; i++) apply_op<Op>(b[i], row_product<N>(v, x + i, 1));
+}
+
+//
+// b[i st] op sum_k v[k] x[(i + k) st] for 0 <= i < rows
+//
+template <int N, typename Op>
+void circulant_strided(const real* v, const real* x, real* b, integer rows, integer st)
+{
+    integer i = 0;
+#if defined(__AVX512F__)
+    __m512d c[N];
+    for (int k = 0; k < N; k++) c[k] = _mm512_set1_pd(v[k]);
+    const __m512i idx = _mm512_set_epi64(
+        7 * st, 6 * st, 5 * st, 4 * st, 3 * st, 2 * st, st, 0);
+
+    for (; i + 8 <= rows; i += 8) {
+        const real* xi = x + i * st;
+        __m512d acc = _mm512_mul_pd(c[0], _mm512_i64gather_pd(idx, xi, 8));
+        for (int k = 1; k < N; k++)
+            acc = _mm512_fmadd_pd(c[k], _mm512_i64gather_pd(idx, xi + k * st, 8), acc);
+        if constexpr (std::same_as<Op, plus_eq_t>)
+            acc = _mm512_add_pd(_mm512_i64gather_pd(idx, b + i * st, 8), acc);
+        _mm512_i64scatter_pd(b + i * st, idx, acc, 8);
+    }
+#elif defined(__AVX2__)
+    __m256d c[N];
+    for (int k = 0; k < N; k++) c[k] = _mm256_set1_pd(v[k]);
+    const __m256i idx = _mm256_set_epi64x(3 * st, 2 * st, st, 0);
+    alignas(32) real out[4];
+
+    for (; i + 4 <= rows; i += 4) {
+        const real* xi = x + i * st;
+        __m256d acc = _mm256_mul_pd(c[0], _mm256_i64gather_pd(xi, idx, 8));
+        for (int k = 1; k < N; k++) {
+#if defined(__FMA__)
+            acc = _mm256_fmadd_pd(c[k], _mm256_i64gather_pd(xi + k * st, idx, 8), acc);
+#else
+            acc = _mm256_add_pd(
+                _mm256_mul_pd(c[k], _mm256_i64gather_pd(xi + k * st, idx, 8)), acc);
+#endif
+        }
+        // no scatter in avx2
+        _mm256_store_pd(out, acc);
+        for (int l = 0; l < 4; l++) apply_op<Op>(b[(i + l) * st], out[l]);
+    }
+#endif
+    for (; i < rows; i++) apply_op<Op>(b[i * st], row_product<N>(v, x + i * st, st));
+}
+
+// runtime width fallback for stencils without a specialized kernel
+template <typename Op>
+void circulant_generic(const real* v, integer n, const real* x, real* b, integer rows, integer st)
+{
+    for (integer i = 0; i < rows; i++)
+        apply_op<Op>(b[i * st], row_product(v, n, x + i * st, st));
+}
+
+// number of lanes processed together in the lane kernels.  Large enough to fill the
+// vector registers several times over while keeping the accumulators in L1
+constexpr integer lane_block = 64;
+
+//
+// b[i st + l] op sum_k v[k] x[(i + k) st + l] for 0 <= i < rows, 0 <= l < lanes
+//
+template <int N, typename Op>
+void circulant_lanes(
+    const real* v, const real* x, real* b, integer rows, integer st, integer lanes)
+{
+    real acc[lane_block];
+
+    for (integer i = 0; i < rows; i++) {
+        const real* xi = x + i * st;
+        real* bi = b + i * st;
+
+        for (integer l0 = 0; l0 < lanes; l0 += lane_block) {
+            const integer nl = std::min(lane_block, lanes - l0);
+            const real* xl = xi + l0;
+
+            for (integer l = 0; l < nl; l++) acc[l] = v[0] * xl[l];
+            for (int k = 1; k < N; k++) {
+                const real* xk = xl + k * st;
+                for (integer l = 0; l < nl; l++) acc[l] = madd(v[k], xk[l], acc[l]);
+            }
+            for (integer l = 0; l < nl; l++) apply_op<Op>(bi[l0 + l], acc[l]);
+        }
+    }
+}
+
+template <typename Op>
+void circulant_generic_lanes(const real* v,
+                             integer n,
+                             const real* x,
+                             real* b,
+                             integer rows,
+                             integer st,
+                             integer lanes)
+{
+    real acc[lane_block];
+
+    for (integer i = 0; i < rows; i++) {
+        const real* xi = x + i * st;
+        real* bi = b + i * st;
+
+        for (integer l0 = 0; l0 < lanes; l0 += lane_block) {
+            const integer nl = std::min(lane_block, lanes - l0);
+            const real* xl = xi + l0;
+
+            for (integer l = 0; l < nl; l++) acc[l] = v[0] * xl[l];
+            for (integer k = 1; k < n; k++) {
+                const real* xk = xl + k * st;
+                for (integer l = 0; l < nl; l++) acc[l] = madd(v[k], xk[l], acc[l]);
+            }
+            for (integer l = 0; l < nl; l++) apply_op<Op>(bi[l0 + l], acc[l]);
+        }
+    }
+}
+
+//
+// Row major rows x cols dense matrix `a` applied to `lanes` adjacent lines:
+// b[r st + l] op sum_c a[r, c] x[c st + l]
+// A single line is just lanes == 1
+//
+template <typename Op>
+void dense_lanes(const real* a,
+                 integer rows,
+                 integer cols,
+                 const real* x,
+                 real* b,
+                 integer st,
+                 integer lanes)
+{
+    if (cols == 0) {
+        for (integer r = 0; r < rows; r++)
+            for (integer l = 0; l < lanes; l++) apply_op<Op>(b[r * st + l], 0.0);
+        return;
+    }
+
+    if (lanes == 1) {
+        for (integer r = 0; r < rows; r++)
+            apply_op<Op>(b[r * st], row_product(a + r * cols, cols, x, st));
+        return;
+    }
+
+    real acc[lane_block];
+
+    for (integer r = 0; r < rows; r++) {
+        const real* ar = a + r * cols;
+        real* br = b + r * st;
+
+        for (integer l0 = 0; l0 < lanes; l0 += lane_block) {
+            const integer nl = std::min(lane_block, lanes - l0);
+            const real* xl = x + l0;
+
+            for (integer l = 0; l < nl; l++) acc[l] = ar[0] * xl[l];
+            for (integer c = 1; c < cols; c++) {
+                const real* xc = xl + c * st;
+                for (integer l = 0; l < nl; l++) acc[l] = madd(ar[c], xc[l], acc[l]);
+            }
+            for (integer l = 0; l < nl; l++) apply_op<Op>(br[l0 + l], acc[l]);
+        }
+    }
+}
+
+} // namespace ccs::matrix::detail
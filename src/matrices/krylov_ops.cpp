@@ -0,0 +1,60 @@
+#include "krylov_ops.hpp"
+#include "parallel/thread_pool.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace ccs::matrix
+{
+
+void dots(
+    integer n, int j, const real* V, const real* x, real* h, std::vector<real>& partial)
+{
+    constexpr integer rows = reduction_block_rows;
+    const integer nb = (n + rows - 1) / rows;
+    partial.resize(nb * j);
+
+    parallel_for(nb, min_parallel_rows / rows, [&](integer b0, integer b1) {
+        for (integer b = b0; b < b1; b++) {
+            const integer first = b * rows;
+            const integer last = std::min(n, first + rows);
+            for (int l = 0; l < j; l++) {
+                const real* v = V + l * n;
+                real s = 0.0;
+                for (integer i = first; i < last; i++) s += v[i] * x[i];
+                partial[b * j + l] = s;
+            }
+        }
+    });
+
+    for (int l = 0; l < j; l++) {
+        real s = 0.0;
+        for (integer b = 0; b < nb; b++) s += partial[b * j + l];
+        h[l] = s;
+    }
+}
+
+real norm(integer n, const real* x, std::vector<real>& partial)
+{
+    real s;
+    dots(n, 1, x, x, &s, partial);
+    return std::sqrt(s);
+}
+
+void subtract(integer n, int j, const real* V, const real* h, real* x)
+{
+    parallel_for(n, min_parallel_rows, [&](integer first, integer last) {
+        for (int l = 0; l < j; l++) {
+            const real* v = V + l * n;
+            for (integer i = first; i < last; i++) x[i] -= h[l] * v[i];
+        }
+    });
+}
+
+void scale(integer n, real a, real* x)
+{
+    parallel_for(n, min_parallel_rows, [&](integer first, integer last) {
+        for (integer i = first; i < last; i++) x[i] *= a;
+    });
+}
+} // namespace ccs::matrix
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "common.hpp"
+
+#include <vector>
+
+// Vector operations shared by the Krylov methods.  Vectors of length n are stored
+// contiguously and a basis of them with a stride of n.  Long vectors are split across
+// the thread pool.  The reductions are summed over blocks of rows that do not depend on
+// the thread count so the results are reproducible.  `partial` holds the block sums.
+namespace ccs::matrix
+{
+// avoid waking the thread pool for short vectors
+constexpr integer min_parallel_rows = 1 << 14;
+// rows per block of the reductions.  Fixed so the sums do not depend on the thread count
+constexpr integer reduction_block_rows = 1 << 12;
+
+// h[l] = <V_l, x> for the first j columns of V
+void dots(
+    integer n, int j, const real* V, const real* x, real* h, std::vector<real>& partial);
+
+real norm(integer n, const real* x, std::vector<real>& partial);
+
+// x -= V h for the first j columns of V
+void subtract(integer n, int j, const real* V, const real* h, real* x);
+
+void scale(integer n, real a, real* x);
+} // namespace ccs::matrix
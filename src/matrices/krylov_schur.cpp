@@ -0,0 +1,194 @@
+#include "krylov_schur.hpp"
+#include "krylov_ops.hpp"
+#include "parallel/thread_pool.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <memory>
+
+#include <lapack.hh>
+
+namespace ccs::matrix
+{
+
+namespace
+{
+// the first p columns of V are replaced by V Z where V has s columns and Z is s x p
+void rotate(integer n, int s, int p, real* V, const real* Z)
+{
+    constexpr integer rows = 256;
+
+    parallel_for(n, min_parallel_rows, [&](integer first, integer last) {
+        std::vector<real> r(rows * p);
+        for (integer i0 = first; i0 < last; i0 += rows) {
+            const integer i1 = std::min(last, i0 + rows);
+            std::fill(r.begin(), r.end(), 0.0);
+
+            for (int l = 0; l < p; l++) {
+                real* t = r.data() + l * rows - i0;
+                for (int j = 0; j < s; j++) {
+                    const real z = Z[j + l * s];
+                    const real* v = V + j * n;
+                    for (integer i = i0; i < i1; i++) t[i] += z * v[i];
+                }
+            }
+
+            for (int l = 0; l < p; l++)
+                std::copy(r.data() + l * rows,
+                          r.data() + l * rows + (i1 - i0),
+                          V + l * n + i0);
+        }
+    });
+}
+} // namespace
+
+krylov_schur::krylov_schur(int nev, int ncv, real tol, int max_restarts, order which)
+    : nev{nev}, ncv{ncv}, tol{tol}, max_restarts{max_restarts}, which{which}
+{
+}
+
+krylov_schur::result krylov_schur::operator()(integer n,
+                                              const linear_operator& A,
+                                              std::span<const real> v0) const
+{
+    constexpr real eps = std::numeric_limits<real>::epsilon();
+
+    // basis size, leaving room to extend it after keeping `keep` vectors at a restart
+    const int m = (int)std::min<integer>(
+        std::max(ncv > 0 ? ncv : std::max(2 * nev + 1, 20), nev + 2), n);
+    const int keep = std::max(std::min(nev + (m - nev) / 2, m - 2), 1);
+
+    std::vector<real> V(n * (m + 1));
+    // Krylov decomposition A V_s = V_s H_s + v_s b^T with b^T stored as row s of H
+    std::vector<real> H((m + 1) * m);
+    std::vector<real> T(m * m);
+    std::vector<real> Z(m * m);
+    std::vector<real> b(m);
+    std::vector<real> h(m + 1);
+    std::vector<real> partial;
+    std::vector<std::complex<real>> w(m);
+    auto select = std::make_unique<bool[]>(m);
+
+    auto col = [&V, n](int j) { return V.data() + j * n; };
+    auto Hij = [&H, m](int i, int j) -> real& { return H[i + j * (m + 1)]; };
+
+    std::copy(v0.begin(), v0.end(), V.begin());
+    if (const real nrm = norm(n, col(0), partial); nrm > 0.0)
+        scale(n, 1.0 / nrm, col(0));
+    else
+        return {{}, 0, true};
+
+    int p = 0;
+    for (int restart = 0;; restart++) {
+        // extend the decomposition from p to m vectors with arnoldi steps
+        int s = m;
+        bool invariant = false;
+        for (int j = p; j < m; j++) {
+            real* x = col(j + 1);
+            A(std::span<const real>(col(j), n), std::span<real>(x, n));
+            const real anorm = norm(n, x, partial);
+
+            // classical gram-schmidt with one reorthogonalization.  If the second pass
+            // removes a sizeable part of what is left the new vector is numerically in
+            // the span of the basis
+            std::array<real, 2> beta{};
+            for (int pass = 0; pass < 2; pass++) {
+                dots(n, j + 1, V.data(), x, h.data(), partial);
+                subtract(n, j + 1, V.data(), h.data(), x);
+                for (int l = 0; l <= j; l++) Hij(l, j) += h[l];
+                beta[pass] = norm(n, x, partial);
+            }
+
+            if (j + 1 == n || beta[1] <= eps * anorm || beta[1] < 0.717 * beta[0]) {
+                s = j + 1;
+                invariant = true;
+                break;
+            }
+            Hij(j + 1, j) = beta[1];
+            scale(n, 1.0 / beta[1], x);
+        }
+
+        // real Schur form of the projected matrix
+        for (int j = 0; j < s; j++)
+            for (int i = 0; i < s; i++) T[i + j * s] = Hij(i, j);
+
+        int64_t sdim = 0;
+        lapack::gees(lapack::Job::Vec,
+                     lapack::Sort::NotSorted,
+                     nullptr,
+                     s,
+                     T.data(),
+                     s,
+                     &sdim,
+                     w.data(),
+                     Z.data(),
+                     s);
+
+        // Order the leading Ritz values by decreasing real part or magnitude.  Each pass
+        // selects the values already in order along with the best of the rest.  trsen
+        // keeps the relative order of the selection so the new value is placed behind
+        // the others
+        auto key = [this](const std::complex<real>& z) {
+            return which == order::rightmost ? z.real() : std::abs(z);
+        };
+        const int want = invariant ? std::min(nev, s) : keep;
+        int64_t nsel = 0;
+        while (nsel < want) {
+            int best = nsel;
+            for (int i = nsel + 1; i < s; i++)
+                if (key(w[i]) > key(w[best])) best = i;
+            for (int i = 0; i < s; i++) select[i] = i < nsel || i == best;
+
+            lapack::trsen(lapack::Sense::None,
+                          lapack::Job::Vec,
+                          select.get(),
+                          s,
+                          T.data(),
+                          s,
+                          Z.data(),
+                          s,
+                          w.data(),
+                          &nsel,
+                          nullptr,
+                          nullptr);
+        }
+
+        // b in the Schur basis gives the residual of each Schur vector
+        for (int l = 0; l < s; l++) {
+            real sum = 0.0;
+            if (!invariant)
+                for (int j = 0; j < s; j++) sum += Hij(s, j) * Z[j + l * s];
+            b[l] = sum;
+        }
+
+        // residuals are measured against the size of the projected matrix so
+        // eigenvalues near zero can converge
+        real tnorm = 0.0;
+        for (int i = 0; i < s * s; i++) tnorm += T[i] * T[i];
+        tnorm = std::sqrt(tnorm);
+
+        const int k = std::min<int>(nev, nsel);
+        bool converged = true;
+        for (int i = 0; i < k; i++)
+            converged = converged && std::abs(b[i]) <= tol * tnorm;
+
+        if (invariant || converged || restart == max_restarts)
+            return {{w.begin(), w.begin() + k}, restart, invariant || converged};
+
+        // keep the leading Schur vectors and the residual vector
+        const int q = nsel;
+        rotate(n, s, q, V.data(), Z.data());
+        std::copy(col(s), col(s) + n, col(q));
+
+        std::fill(H.begin(), H.end(), 0.0);
+        for (int j = 0; j < q; j++) {
+            for (int i = 0; i < q; i++) Hij(i, j) = T[i + j * s];
+            Hij(q, j) = b[j];
+        }
+        p = q;
+    }
+}
+
+} // namespace ccs::matrix
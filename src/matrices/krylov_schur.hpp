@@ -0,0 +1,59 @@
+#pragma once
+
+#include "common.hpp"
+
+#include <complex>
+#include <functional>
+#include <span>
+#include <vector>
+
+namespace ccs::matrix
+{
+// Eigenvalues with the largest real part, or the largest magnitude, of a large and
+// possibly non-symmetric operator using the Krylov-Schur method, a restarted Arnoldi
+// iteration.  Only products with the operator are needed.  A basis of `ncv` vectors is
+// built, the projected matrix is reduced to a Schur form ordered by the wanted
+// eigenvalues first and the basis is truncated to the leading Schur vectors before
+// being extended again.  Storage is (ncv + 1) vectors of the operator size.
+//
+// The result is reproducible: the reductions are split into blocks that do not depend
+// on the thread count.
+class krylov_schur
+{
+public:
+    enum class order { rightmost, largest_magnitude };
+
+private:
+    int nev = 1;
+    int ncv = 0;
+    real tol = 1e-10;
+    int max_restarts = 1000;
+    order which = order::rightmost;
+
+public:
+    using linear_operator = std::function<void(std::span<const real>, std::span<real>)>;
+
+    struct result {
+        // sorted by decreasing real part or magnitude
+        std::vector<std::complex<real>> eigenvalues;
+        int restarts;
+        bool converged;
+    };
+
+    krylov_schur() = default;
+
+    // `nev` wanted eigenvalues from a basis of `ncv` vectors.  When `ncv` is zero
+    // max(2 nev + 1, 20) is used.  A Ritz value is accepted once its residual is below
+    // `tol` times the norm of the projected matrix
+    krylov_schur(int nev,
+                 int ncv = 0,
+                 real tol = 1e-10,
+                 int max_restarts = 1000,
+                 order which = order::rightmost);
+
+    // eigenvalues of the n x n operator A starting from `v0`.  Fewer than `nev` are
+    // returned if an invariant subspace of lower dimension is found
+    result
+    operator()(integer n, const linear_operator& A, std::span<const real> v0) const;
+};
+} // namespace ccs::matrix
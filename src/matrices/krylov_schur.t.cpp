@@ -0,0 +1,146 @@
+#include "krylov_schur.hpp"
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "parallel/thread_pool.hpp"
+#include "random/random.hpp"
+
+#include <algorithm>
+#include <vector>
+
+using namespace ccs;
+using T = std::vector<real>;
+
+TEST_CASE("diagonal")
+{
+    const integer n = 400;
+    // eigenvalues 1, 2, ..., n
+    auto A = [](std::span<const real> x, std::span<real> y) {
+        for (integer i = 0; i < (integer)x.size(); i++) y[i] = (i + 1) * x[i];
+    };
+
+    T v0(n);
+    std::ranges::generate(v0, []() { return pick(); });
+
+    const auto res = matrix::krylov_schur{4}(n, A, v0);
+    REQUIRE(res.converged);
+    REQUIRE(res.eigenvalues.size() == 4u);
+    for (int i = 0; i < 4; i++) {
+        REQUIRE(res.eigenvalues[i].real() == Catch::Approx(n - i));
+        REQUIRE(res.eigenvalues[i].imag() + 1.0 == Catch::Approx(1.0));
+    }
+}
+
+TEST_CASE("largest magnitude")
+{
+    const integer n = 400;
+    // eigenvalues -1, -2, ..., -n so the rightmost are the smallest in magnitude
+    auto A = [](std::span<const real> x, std::span<real> y) {
+        for (integer i = 0; i < (integer)x.size(); i++) y[i] = -(i + 1) * x[i];
+    };
+
+    T v0(n);
+    std::ranges::generate(v0, []() { return pick(); });
+
+    using order = matrix::krylov_schur::order;
+    const auto res =
+        matrix::krylov_schur{3, 0, 1e-10, 1000, order::largest_magnitude}(n, A, v0);
+    REQUIRE(res.converged);
+    REQUIRE(res.eigenvalues.size() == 3u);
+    for (int i = 0; i < 3; i++)
+        REQUIRE(res.eigenvalues[i].real() == Catch::Approx(-(n - i)));
+}
+
+TEST_CASE("complex pairs")
+{
+    // 2x2 blocks with eigenvalues a_j +- i b_j.  The rightmost real parts are
+    // a = -0.01 and a = -0.02 which sit among many eigenvalues with larger magnitude
+    const integer blocks = 300;
+    const integer n = 2 * blocks;
+    T a(blocks), b(blocks);
+    for (integer j = 0; j < blocks; j++) {
+        a[j] = -0.01 * (j + 1);
+        b[j] = 1.0 + j;
+    }
+
+    auto A = [&](std::span<const real> x, std::span<real> y) {
+        for (integer j = 0; j < blocks; j++) {
+            y[2 * j] = a[j] * x[2 * j] + b[j] * x[2 * j + 1];
+            y[2 * j + 1] = -b[j] * x[2 * j] + a[j] * x[2 * j + 1];
+        }
+    };
+
+    T v0(n);
+    std::ranges::generate(v0, []() { return pick(); });
+
+    const auto res = matrix::krylov_schur{4, 40}(n, A, v0);
+    REQUIRE(res.converged);
+    REQUIRE(res.eigenvalues.size() == 4u);
+
+    REQUIRE(res.eigenvalues[0].real() == Catch::Approx(-0.01));
+    REQUIRE(res.eigenvalues[1].real() == Catch::Approx(-0.01));
+    REQUIRE(std::abs(res.eigenvalues[0].imag()) == Catch::Approx(1.0));
+    REQUIRE(res.eigenvalues[0].imag() == Catch::Approx(-res.eigenvalues[1].imag()));
+    REQUIRE(res.eigenvalues[2].real() == Catch::Approx(-0.02));
+    REQUIRE(res.eigenvalues[3].real() == Catch::Approx(-0.02));
+}
+
+TEST_CASE("invariant subspace")
+{
+    // the identity leaves the starting vector unchanged
+    auto A = [](std::span<const real> x, std::span<real> y) {
+        std::ranges::copy(x, y.begin());
+    };
+
+    const T v0(50, 1.0);
+    const auto res = matrix::krylov_schur{3}(50, A, v0);
+    REQUIRE(res.converged);
+    REQUIRE(res.eigenvalues.size() == 1u);
+    REQUIRE(res.eigenvalues[0].real() == Catch::Approx(1.0));
+}
+
+TEST_CASE("non-normal")
+{
+    // upper bidiagonal so the eigenvalues are the diagonal.  The basis covers the
+    // whole space
+    const integer n = 12;
+    auto A = [](std::span<const real> x, std::span<real> y) {
+        const integer n = x.size();
+        for (integer i = 0; i < n; i++)
+            y[i] = 0.1 * (i + 1) * x[i] + (i + 1 < n ? x[i + 1] : 0.0);
+    };
+
+    T v0(n);
+    std::ranges::generate(v0, []() { return pick(); });
+
+    const auto res = matrix::krylov_schur{2, 20}(n, A, v0);
+    REQUIRE(res.converged);
+    REQUIRE(res.eigenvalues.size() == 2u);
+    REQUIRE(res.eigenvalues[0].real() == Catch::Approx(1.2));
+    REQUIRE(res.eigenvalues[1].real() == Catch::Approx(1.1));
+}
+
+TEST_CASE("threads")
+{
+    const integer n = 1 << 16;
+    auto A = [](std::span<const real> x, std::span<real> y) {
+        const integer n = x.size();
+        for (integer i = 0; i < n; i++)
+            y[i] = -2.0 * x[i] + x[(i + 1) % n] + 0.5 * x[(i + n - 1) % n];
+    };
+
+    T v0(n);
+    std::ranges::generate(v0, []() { return pick(); });
+
+    const auto solver = matrix::krylov_schur{2, 20, 1e-10, 5};
+    set_thread_count(1);
+    const auto res = solver(n, A, v0);
+
+    for (int threads : {2, 4}) {
+        set_thread_count(threads);
+        const auto r = solver(n, A, v0);
+        REQUIRE(r.eigenvalues == res.eigenvalues);
+    }
+    set_thread_count(1);
+}
@@ -2,8 +2,11 @@
 
 #include <sol/sol.hpp>
 
+#include <range/v3/algorithm/is_sorted.hpp>
 #include <spdlog/sinks/basic_file_sink.h>
 
+#include <cassert>
+
 namespace ccs
 {
 
@@ -94,6 +97,30 @@ void init_line(std::vector<line>& v, int3 extents, std::span<const mesh_object_i
     }
 }
 
+// index the intersections in `r` by the (slow, fast) line they lie on
+template <auto I>
+void init_r_lines(std::vector<integer>& v,
+                  int3 extents,
+                  std::span<const mesh_object_info> r)
+{
+    constexpr auto S = index::dir<I>::slow;
+    constexpr auto F = index::dir<I>::fast;
+
+    const integer nf = extents[F];
+    v.assign(extents[S] * nf + 1, 0);
+
+    for (auto&& info : r) {
+        const auto& ijk = info.solid_coord;
+        ++v[ijk[S] * nf + ijk[F] + 1];
+    }
+    for (integer i = 1; i < (integer)v.size(); i++) v[i] += v[i - 1];
+
+    // the intersections must be ordered by line for the offsets to be valid
+    assert(rs::is_sorted(r, std::less<>{}, [nf](auto&& info) {
+        return info.solid_coord[S] * nf + info.solid_coord[F];
+    }));
+}
+
 void init_slices(std::vector<index_slice>& fluid_slices,
                  std::span<const line> lines,
                  index_extents extents)
@@ -149,6 +176,10 @@ mesh::mesh(const index_extents& extents,
     init_line<1>(lines_[1], cart.extents(), geometry.R(1));
     init_line<2>(lines_[2], cart.extents(), geometry.R(2));
 
+    init_r_lines<0>(r_lines[0], cart.extents(), geometry.R(0));
+    init_r_lines<1>(r_lines[1], cart.extents(), geometry.R(1));
+    init_r_lines<2>(r_lines[2], cart.extents(), geometry.R(2));
+
     // setup fluid selector
     int i = extents[2] > 1 ? 2 : extents[1] > 1 ? 1 : 0;
     init_slices(fluid_slices, lines_[i], extents);
@@ -169,6 +200,58 @@ mesh::mesh(const index_extents& extents,
                    fmt::join(ijk, ", "));
 }
 
+mesh::mesh(const mesh& other)
+    : cart{other.cart},
+      geometry{other.geometry},
+      lines_{other.lines_},
+      r_lines{other.r_lines},
+      fluid_slices{other.fluid_slices},
+      bc_slices{other.bc_slices},
+      logger{other.logger},
+      xmin{other.xmin},
+      xmax{other.xmax},
+      ymin{other.ymin},
+      ymax{other.ymax},
+      zmin{other.zmin},
+      zmax{other.zmax},
+      fluid{sel::multi_slice(fluid_slices)},
+      xyz{cart.domain(), geometry.domain()},
+      vxyz{tuple{tuple{cart.domain(), geometry.domain()},
+                 tuple{cart.domain(), geometry.domain()},
+                 tuple{cart.domain(), geometry.domain()}}}
+{
+}
+
+mesh& mesh::operator=(const mesh& other)
+{
+    mesh tmp{other};
+    return *this = MOVE(tmp);
+}
+
+const mesh::object_bc_slices& mesh::object_slices(const bcs::Object& o) const
+{
+    std::lock_guard lock{bc_mutex.m};
+
+    for (auto&& s : bc_slices)
+        if (s.object_bcs == o) return s;
+
+    auto& s = bc_slices.emplace_back(object_bc_slices{.object_bcs = o});
+
+    for (int dir = 0; dir < 3; dir++)
+        for (integer i = 0; auto&& info : R(dir)) {
+            auto& v = o[info.shape_id] == bcs::Dirichlet ? s.dirichlet[dir]
+                                                          : s.non_dirichlet[dir];
+            // extend the last run when this point directly follows it
+            if (!v.empty() && v.back().last == i)
+                ++v.back().last;
+            else
+                v.emplace_back(i, i + 1);
+            ++i;
+        }
+
+    return s;
+}
+
 bool mesh::dirichlet_line(const int3& start, int dir, const bcs::Grid& cart_bcs) const
 {
     bool result = false;
@@ -197,11 +280,13 @@ line mesh::interp_line(int dir, int3 pt) const
 
     const auto [f, s] = index::dirs(dir);
 
-    for (integer i = -1; auto&& [psi, pos, n, ray_out, ijk, id] : R(dir)) {
-        ++i;
+    // only visit the intersections on the line through pt
+    const auto& offsets = r_lines[dir];
+    const integer key = pt[s] * extents()[f] + pt[f];
+    const auto r = R(dir);
 
-        if (ijk[s] > pt[s]) break;
-        if (ijk[s] != pt[s] || ijk[f] != pt[f]) continue;
+    for (integer i = offsets[key]; i < offsets[key + 1]; i++) {
+        auto&& [psi, pos, n, ray_out, ijk, id] = r[i];
 
         // check left/right  boundary
         if (n[dir] >= 0.0 && ijk[dir] <= pt[dir]) {
@@ -7,6 +7,9 @@
 #include "object_geometry.hpp"
 #include "operators/boundaries.hpp"
 
+#include <deque>
+#include <mutex>
+
 #include <sol/forward.hpp>
 
 namespace ccs
@@ -17,7 +20,27 @@ class mesh
     cartesian cart;
     object_geometry geometry;
     std::array<std::vector<line>, 3> lines_;
+    // R(dir) is ordered by (slow, fast) line.  The intersections on line (s, f) are
+    // R(dir)[k] for k in [r_lines[dir][s * n_fast + f], r_lines[dir][s * n_fast + f + 1])
+    std::array<std::vector<integer>, 3> r_lines;
     std::vector<index_slice> fluid_slices;
+    // Runs of R(dir) indices on dirichlet and non-dirichlet objects, built once for
+    // each set of object boundary conditions by add_object_bcs or on first use.  The
+    // deque keeps existing entries in place as others are added and bc_mutex guards it
+    struct object_bc_slices {
+        bcs::Object object_bcs;
+        std::array<std::vector<index_slice>, 3> dirichlet;
+        std::array<std::vector<index_slice>, 3> non_dirichlet;
+    };
+    // copies of the mesh get their own mutex
+    struct cache_mutex {
+        std::mutex m;
+        cache_mutex() = default;
+        cache_mutex(const cache_mutex&) {}
+        cache_mutex& operator=(const cache_mutex&) { return *this; }
+    };
+    mutable std::deque<object_bc_slices> bc_slices;
+    mutable cache_mutex bc_mutex;
     logs logger;
 
     template <bcs::type B, int I>
@@ -42,14 +65,13 @@ class mesh
         }
     }
 
-    template <typename Fn>
-    auto object_boundaries(Fn cmp) const
-    {
-        auto t = vs::transform([cmp = MOVE(cmp)](auto&& info) { return cmp(FWD(info)); });
+    const object_bc_slices& object_slices(const bcs::Object& o) const;
 
-        return tuple{sel::Rx, sel::Ry, sel::Rz} | tuple{sel::predicate(Rx() | t),
-                                                        sel::predicate(Ry() | t),
-                                                        sel::predicate(Rz() | t)};
+    auto object_boundaries(const std::array<std::vector<index_slice>, 3>& s) const
+    {
+        return tuple{sel::Rx, sel::Ry, sel::Rz} | tuple{sel::index_runs(s[0]),
+                                                        sel::index_runs(s[1]),
+                                                        sel::index_runs(s[2])};
     }
 
 public:
@@ -61,6 +83,17 @@ public:
          const std::vector<shape>& shapes,
          const logs& = {});
 
+    // the selectors and coordinate views refer to the storage of the mesh so copies
+    // must rebuild them
+    mesh(const mesh&);
+    mesh(mesh&&) = default;
+    mesh& operator=(const mesh&);
+    mesh& operator=(mesh&&) = default;
+
+    // build the boundary selections for `o` ahead of their use in dirichlet(o),
+    // non_dirichlet(o) and fluid_all(o)
+    void add_object_bcs(const bcs::Object& o) const { object_slices(o); }
+
     bool dirichlet_line(const int3& start, int dir, const bcs::Grid& cartesian_bcs) const;
 
     constexpr auto size() const { return cart.size(); }
@@ -137,14 +170,12 @@ public:
 
     auto dirichlet(const bcs::Object& o) const
     {
-        return object_boundaries(
-            [&o](auto&& info) { return o[info.shape_id] == bcs::Dirichlet; });
+        return object_boundaries(object_slices(o).dirichlet);
     }
 
     auto non_dirichlet(const bcs::Object& o) const
     {
-        return object_boundaries(
-            [&o](auto&& info) { return o[info.shape_id] != bcs::Dirichlet; });
+        return object_boundaries(object_slices(o).non_dirichlet);
     }
 
     template <int I = -1>
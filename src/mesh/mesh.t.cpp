@@ -292,6 +292,11 @@ TEST_CASE("selections with object")
         REQUIRE(rs::count(u | sel::Rx, -1) == 0);
         REQUIRE(rs::count(u | sel::Ry, -1) == 0);
         REQUIRE(rs::count(u | sel::Rz, -1) == 0);
+
+        u | m.non_dirichlet(obj_bcs) = 2;
+        REQUIRE(rs::count(u | sel::Rx, 2) == (integer)rs::size(u | sel::Rx));
+        REQUIRE(rs::count(u | sel::Ry, 2) == (integer)rs::size(u | sel::Ry));
+        REQUIRE(rs::count(u | sel::Rz, 2) == (integer)rs::size(u | sel::Rz));
     }
 
     {
@@ -300,6 +305,12 @@ TEST_CASE("selections with object")
         REQUIRE(rs::count(u | sel::Rx, -1) == (integer)rs::size(u | sel::Rx));
         REQUIRE(rs::count(u | sel::Ry, -1) == (integer)rs::size(u | sel::Ry));
         REQUIRE(rs::count(u | sel::Rz, -1) == (integer)rs::size(u | sel::Rz));
+
+        // every intersection is dirichlet so there is nothing left to select
+        u | m.non_dirichlet(obj_bcs) = 2;
+        REQUIRE(rs::count(u | sel::Rx, 2) == 0);
+        REQUIRE(rs::count(u | sel::Ry, 2) == 0);
+        REQUIRE(rs::count(u | sel::Rz, 2) == 0);
     }
 
     {
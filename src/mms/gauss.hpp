@@ -1,6 +1,8 @@
 #pragma once
 
 #include "types.hpp"
+#include <algorithm>
+#include <cmath>
 #include <span>
 #include <vector>
 
@@ -14,6 +16,8 @@ struct gauss {
     std::vector<real3> variance;
     std::vector<real> amplitude;
     std::vector<real> frequency;
+    // 1 / variance^2 so the evaluation loops only multiply
+    std::vector<real3> inv_variance2;
 
     gauss() = default;
 
@@ -26,6 +30,88 @@ struct gauss {
           amplitude{amplitude.begin(), amplitude.end()},
           frequency{frequency.begin(), frequency.end()}
     {
+        for (auto&& v : variance)
+            inv_variance2.push_back(
+                {1 / (v[0] * v[0]), 1 / (v[1] * v[1]), 1 / (v[2] * v[2])});
+    }
+
+protected:
+    // Batched evaluation of the sum of gaussians varying in the first N directions.  The
+    // time dependence is hoisted out of the loops over the locations, which only
+    // call exp and vectorize
+    template <int N>
+    real exponent(int i, const real3& x) const
+    {
+        real s = 0;
+        for (int k = 0; k < N; k++) {
+            const auto d = x[k] - center[i][k];
+            s += d * d * inv_variance2[i][k];
+        }
+        return -0.5 * s;
+    }
+
+    template <int N>
+    void eval(real time, std::span<const real3> loc, std::span<real> out) const
+    {
+        std::ranges::fill(out, 0.0);
+        for (int i = 0; i < static_cast<int>(center.size()); ++i) {
+            const real a = amplitude[i] * std::cos(time * frequency[i]);
+            for (std::size_t j = 0; j < loc.size(); j++)
+                out[j] += a * std::exp(exponent<N>(i, loc[j]));
+        }
+    }
+
+    template <int N>
+    void eval_ddt(real time, std::span<const real3> loc, std::span<real> out) const
+    {
+        std::ranges::fill(out, 0.0);
+        for (int i = 0; i < static_cast<int>(center.size()); ++i) {
+            const real a = -amplitude[i] * frequency[i] * std::sin(time * frequency[i]);
+            for (std::size_t j = 0; j < loc.size(); j++)
+                out[j] += a * std::exp(exponent<N>(i, loc[j]));
+        }
+    }
+
+    template <int N>
+    void eval_gradient(real time, std::span<const real3> loc, std::span<real3> out) const
+    {
+        std::ranges::fill(out, real3{});
+        for (int i = 0; i < static_cast<int>(center.size()); ++i) {
+            const real a = amplitude[i] * std::cos(time * frequency[i]);
+            for (std::size_t j = 0; j < loc.size(); j++) {
+                const real e = a * std::exp(exponent<N>(i, loc[j]));
+                for (int k = 0; k < N; k++)
+                    out[j][k] -= e * (loc[j][k] - center[i][k]) * inv_variance2[i][k];
+            }
+        }
+    }
+
+    template <int N>
+    void eval_laplacian(real time, std::span<const real3> loc, std::span<real> out) const
+    {
+        std::ranges::fill(out, 0.0);
+        for (int i = 0; i < static_cast<int>(center.size()); ++i) {
+            const real a = amplitude[i] * std::cos(time * frequency[i]);
+            for (std::size_t j = 0; j < loc.size(); j++) {
+                // d^2/dx_k^2 exp(-d_k^2 / (2 v_k^2)) = (d_k^2 / v_k^4 - 1 / v_k^2) exp()
+                real c = 0;
+                for (int k = 0; k < N; k++) {
+                    const auto d = loc[j][k] - center[i][k];
+                    const auto s = inv_variance2[i][k];
+                    c += d * d * s * s - s;
+                }
+                out[j] += a * c * std::exp(exponent<N>(i, loc[j]));
+            }
+        }
+    }
+
+    // pointwise evaluation in terms of the batched versions
+    template <typename T, typename F>
+    static T at(const real3& loc, F&& f)
+    {
+        T r{};
+        f(std::span<const real3>{&loc, 1}, std::span<T>{&r, 1});
+        return r;
     }
 };
 
@@ -45,4 +131,4 @@ manufactured_solution build_ms_gauss3d(std::span<const real3> center,
                                        std::span<const real> amplitude,
                                        std::span<const real> frequency);
 
-} // namespace ccs
\ No newline at end of file
+} // namespace ccs
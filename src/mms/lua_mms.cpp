@@ -2,10 +2,30 @@
 #include "manufactured_solutions.hpp"
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
+#include <limits>
+
 namespace ccs
 {
 
-lua_mms::lua_mms(const sol::table& tbl_) : tbl{tbl_}
+namespace
+{
+// coordinate k of the locations as a lua array
+sol::table coordinate(sol::state_view lua, std::span<const real3> loc, int k)
+{
+    auto t = lua.create_table(static_cast<int>(loc.size()), 0);
+    for (std::size_t i = 0; i < loc.size(); i++) t.raw_set(i + 1, loc[i][k]);
+    return t;
+}
+
+void copy_array(const sol::table& t, std::span<real> out)
+{
+    for (std::size_t i = 0; i < out.size(); i++) out[i] = t.raw_get<real>(i + 1);
+}
+} // namespace
+
+lua_mms::lua_mms(const sol::table& tbl_)
+    : tbl{tbl_}, batched{tbl_["batched"].get_or(false)}
 {
     if (tbl["call"].get_type() != sol::type::function) {
         spdlog::error("call function not defined for lua_mms");
@@ -35,6 +55,126 @@ lua_mms::lua_mms(const sol::table& tbl_) : tbl{tbl_}
     laplacian_ = tbl["lap"];
 }
 
+sol::protected_function_result
+lua_mms::call_batched(const char* name, real time, std::span<const real3> loc) const
+{
+    sol::state_view lua{tbl.lua_state()};
+    sol::protected_function f = tbl[name];
+
+    auto res = f(time,
+                 coordinate(lua, loc, 0),
+                 coordinate(lua, loc, 1),
+                 coordinate(lua, loc, 2));
+    if (!res.valid()) {
+        sol::error err = res;
+        spdlog::error("lua_mms {} failed: {}", name, err.what());
+    }
+    return res;
+}
+
+void lua_mms::batch(const char* name,
+                    real time,
+                    std::span<const real3> loc,
+                    std::span<real> out) const
+{
+    if (loc.empty()) return;
+
+    auto res = call_batched(name, time, loc);
+    if (res.valid())
+        copy_array(res.get<sol::table>(), out);
+    else
+        std::ranges::fill(out, std::numeric_limits<real>::quiet_NaN());
+}
+
+void lua_mms::operator()(real time, std::span<const real3> loc, std::span<real> out) const
+{
+    if (batched) return batch("call", time, loc, out);
+    for (std::size_t i = 0; i < loc.size(); i++) out[i] = call_(time, loc[i]);
+}
+
+void lua_mms::ddt(real time, std::span<const real3> loc, std::span<real> out) const
+{
+    if (batched) return batch("ddt", time, loc, out);
+    for (std::size_t i = 0; i < loc.size(); i++) out[i] = ddt_(time, loc[i]);
+}
+
+void lua_mms::gradient(real time, std::span<const real3> loc, std::span<real3> out) const
+{
+    if (!batched) {
+        for (std::size_t i = 0; i < loc.size(); i++) out[i] = gradient(time, loc[i]);
+        return;
+    }
+    if (loc.empty()) return;
+
+    auto res = call_batched("grad", time, loc);
+    if (!res.valid()) {
+        constexpr auto nan = std::numeric_limits<real>::quiet_NaN();
+        std::ranges::fill(out, real3{nan, nan, nan});
+        return;
+    }
+
+    auto [gx, gy, gz] = res.get<std::tuple<sol::table, sol::table, sol::table>>();
+    for (std::size_t i = 0; i < out.size(); i++)
+        out[i] = {
+            gx.raw_get<real>(i + 1), gy.raw_get<real>(i + 1), gz.raw_get<real>(i + 1)};
+}
+
+void lua_mms::divergence(real time, std::span<const real3> loc, std::span<real> out) const
+{
+    if (batched) return batch("div", time, loc, out);
+    for (std::size_t i = 0; i < loc.size(); i++) out[i] = divergence_(time, loc[i]);
+}
+
+void lua_mms::laplacian(real time, std::span<const real3> loc, std::span<real> out) const
+{
+    if (batched) return batch("lap", time, loc, out);
+    for (std::size_t i = 0; i < loc.size(); i++) out[i] = laplacian_(time, loc[i]);
+}
+
+// In batched mode the pointwise calls are batches of one
+real lua_mms::operator()(real time, const real3& loc) const
+{
+    if (!batched) return call_(time, loc);
+    real r;
+    (*this)(time, std::span{&loc, 1}, std::span{&r, 1});
+    return r;
+}
+
+real lua_mms::ddt(real time, const real3& loc) const
+{
+    if (!batched) return ddt_(time, loc);
+    real r;
+    ddt(time, std::span{&loc, 1}, std::span{&r, 1});
+    return r;
+}
+
+real3 lua_mms::gradient(real time, const real3& loc) const
+{
+    if (!batched) {
+        auto&& tp = gradient_(time, loc);
+        return {std::get<0>(tp), std::get<1>(tp), std::get<2>(tp)};
+    }
+    real3 r;
+    gradient(time, std::span{&loc, 1}, std::span{&r, 1});
+    return r;
+}
+
+real lua_mms::divergence(real time, const real3& loc) const
+{
+    if (!batched) return divergence_(time, loc);
+    real r;
+    divergence(time, std::span{&loc, 1}, std::span{&r, 1});
+    return r;
+}
+
+real lua_mms::laplacian(real time, const real3& loc) const
+{
+    if (!batched) return laplacian_(time, loc);
+    real r;
+    laplacian(time, std::span{&loc, 1}, std::span{&r, 1});
+    return r;
+}
+
 std::optional<manufactured_solution> lua_mms::from_lua(const sol::table& tbl)
 {
     return {lua_mms{tbl}};
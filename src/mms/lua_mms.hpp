@@ -3,14 +3,23 @@
 #include "types.hpp"
 #include <functional>
 #include <optional>
+#include <span>
 #include <sol/sol.hpp>
 
 namespace ccs
 {
 class manufactured_solution;
 
+// Manufactured solution defined by lua functions.  By default the functions are called
+// once per point as f(time, {x, y, z}).  With `batched = true` in the table they are
+// called once per batch of points as f(time, xs, ys, zs), where xs, ys and zs are arrays
+// of the coordinates, and return an array of values (three for `grad`).  Batching
+// avoids crossing into lua for every point of the mesh.  The pointwise calls then
+// become batches of one, which are slower than the unbatched functions, so anything
+// evaluated over many points should use the span overloads
 struct lua_mms {
     sol::table tbl;
+    bool batched = false;
 
     std::function<real(real, const real3&)> call_;
     std::function<real(real, const real3&)> ddt_;
@@ -23,6 +32,7 @@ struct lua_mms {
 
     lua_mms(const lua_mms& other)
         : tbl{other.tbl},
+          batched{other.batched},
           call_{tbl["call"]},
           ddt_{tbl["ddt"]},
           gradient_{tbl["grad"]},
@@ -33,6 +43,7 @@ struct lua_mms {
 
     lua_mms(lua_mms&& other)
         : tbl{MOVE(other.tbl)},
+          batched{other.batched},
           call_{tbl["call"]},
           ddt_{tbl["ddt"]},
           gradient_{tbl["grad"]},
@@ -44,6 +55,7 @@ struct lua_mms {
     lua_mms& operator=(const lua_mms& other)
     {
         tbl = other.tbl;
+        batched = other.batched;
         call_ = tbl["call"];
         ddt_ = tbl["ddt"];
         gradient_ = tbl["grad"];
@@ -55,6 +67,7 @@ struct lua_mms {
     lua_mms& operator=(lua_mms&& other)
     {
         tbl = MOVE(other.tbl);
+        batched = other.batched;
         call_ = tbl["call"];
         ddt_ = tbl["ddt"];
         gradient_ = tbl["grad"];
@@ -63,17 +76,29 @@ struct lua_mms {
         return *this;
     }
 
-    auto operator()(real time, const real3& loc) const { return call_(time, loc); }
-    auto ddt(real time, const real3& loc) const { return ddt_(time, loc); }
-    real3 gradient(real time, const real3& loc) const
-    {
-        auto&& tp = gradient_(time, loc);
-        return {std::get<0>(tp), std::get<1>(tp), std::get<2>(tp)};
-    }
-    auto divergence(real time, const real3& loc) const { return divergence_(time, loc); }
-    auto laplacian(real time, const real3& loc) const { return laplacian_(time, loc); }
+    real operator()(real time, const real3& loc) const;
+    real ddt(real time, const real3& loc) const;
+    real3 gradient(real time, const real3& loc) const;
+    real divergence(real time, const real3& loc) const;
+    real laplacian(real time, const real3& loc) const;
+
+    void operator()(real time, std::span<const real3> loc, std::span<real> out) const;
+    void ddt(real time, std::span<const real3> loc, std::span<real> out) const;
+    void gradient(real time, std::span<const real3> loc, std::span<real3> out) const;
+    void divergence(real time, std::span<const real3> loc, std::span<real> out) const;
+    void laplacian(real time, std::span<const real3> loc, std::span<real> out) const;
 
     static std::optional<manufactured_solution> from_lua(const sol::table& tbl);
+
+private:
+    // call the batched lua function `name` on the coordinates of `loc`
+    sol::protected_function_result
+    call_batched(const char* name, real time, std::span<const real3> loc) const;
+
+    void batch(const char* name,
+               real time,
+               std::span<const real3> loc,
+               std::span<real> out) const;
 };
 
 } // namespace ccs
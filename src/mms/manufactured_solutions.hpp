@@ -6,6 +6,7 @@
 #include <cassert>
 #include <concepts>
 #include <optional>
+#include <span>
 #include <range/v3/view/transform.hpp>
 
 #include <sol/forward.hpp>
@@ -13,14 +14,27 @@
 namespace ccs
 {
 
+// The batched forms fill `out[i]` with the value at `locs[i]`.  They avoid a virtual
+// call per point when evaluating over whole meshes
 // clang-format off
 template <typename M>
-concept ManufacturedSolution = requires(const M& ms, real time, const real3& loc, int dim) {
+concept ManufacturedSolution = requires(const M& ms,
+                                        real time,
+                                        const real3& loc,
+                                        int dim,
+                                        std::span<const real3> locs,
+                                        std::span<real> out,
+                                        std::span<real3> out3) {
     { ms(time, loc) } -> std::same_as<real>;
     { ms.ddt(time, loc) } -> std::same_as<real>;
     { ms.gradient(time, loc) } -> std::same_as<real3>;
     { ms.divergence(time, loc) } -> std::same_as<real>;
     { ms.laplacian(time, loc) } -> std::same_as<real>;
+    ms(time, locs, out);
+    ms.ddt(time, locs, out);
+    ms.gradient(time, locs, out3);
+    ms.divergence(time, locs, out);
+    ms.laplacian(time, locs, out);
 };
 // clang-format on
 
@@ -44,6 +58,22 @@ class manufactured_solution
         // laplacian of solution
         virtual real laplacian(real time, const real3& loc) const = 0;
 
+        // batched versions of the above
+        virtual void
+        operator()(real time, std::span<const real3> loc, std::span<real> out) const = 0;
+
+        virtual void
+        ddt(real time, std::span<const real3> loc, std::span<real> out) const = 0;
+
+        virtual void
+        gradient(real time, std::span<const real3> loc, std::span<real3> out) const = 0;
+
+        virtual void
+        divergence(real time, std::span<const real3> loc, std::span<real> out) const = 0;
+
+        virtual void
+        laplacian(real time, std::span<const real3> loc, std::span<real> out) const = 0;
+
         virtual ~any_sol() = default;
 
         virtual any_sol* clone() const = 0;
@@ -81,6 +111,40 @@ class manufactured_solution
         {
             return m.laplacian(time, loc);
         }
+
+        void operator()(real time,
+                        std::span<const real3> loc,
+                        std::span<real> out) const override
+        {
+            m(time, loc, out);
+        }
+
+        void
+        ddt(real time, std::span<const real3> loc, std::span<real> out) const override
+        {
+            m.ddt(time, loc, out);
+        }
+
+        void gradient(real time,
+                      std::span<const real3> loc,
+                      std::span<real3> out) const override
+        {
+            m.gradient(time, loc, out);
+        }
+
+        void divergence(real time,
+                        std::span<const real3> loc,
+                        std::span<real> out) const override
+        {
+            m.divergence(time, loc, out);
+        }
+
+        void laplacian(real time,
+                       std::span<const real3> loc,
+                       std::span<real> out) const override
+        {
+            m.laplacian(time, loc, out);
+        }
     };
 
     any_sol* s;
@@ -163,6 +227,36 @@ public:
             return s->laplacian(time, loc);
         }
 
+        void operator()(real time, std::span<const real3> loc, std::span<real> out) const
+        {
+            assert(s && loc.size() == out.size());
+            (*s)(time, loc, out);
+        }
+
+        void ddt(real time, std::span<const real3> loc, std::span<real> out) const
+        {
+            assert(s && loc.size() == out.size());
+            s->ddt(time, loc, out);
+        }
+
+        void gradient(real time, std::span<const real3> loc, std::span<real3> out) const
+        {
+            assert(s && loc.size() == out.size());
+            s->gradient(time, loc, out);
+        }
+
+        void divergence(real time, std::span<const real3> loc, std::span<real> out) const
+        {
+            assert(s && loc.size() == out.size());
+            s->divergence(time, loc, out);
+        }
+
+        void laplacian(real time, std::span<const real3> loc, std::span<real> out) const
+        {
+            assert(s && loc.size() == out.size());
+            s->laplacian(time, loc, out);
+        }
+
         template <TupleLike L>
         requires ArrayFromTuple<real3, L> real operator()(real time, L&& loc) const
         {
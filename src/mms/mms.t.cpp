@@ -144,6 +144,60 @@ TEST_CASE("gauss3d")
     REQUIRE(ms.laplacian(time, loc) == Catch::Approx(0.002412644784681726));
 }
 
+TEST_CASE("batched")
+{
+    sol::state lua;
+    lua.open_libraries(sol::lib::base, sol::lib::math);
+    lua.script(R"(
+            simulation = {
+                manufactured_solution = {
+                        type = "gaussian",
+
+                        {
+                                center = {1, 1.2, -3.5},
+                                variance = {0.5, 0.8, 2.0},
+                                amplitude = 2,
+                                frequency = 0.1
+                        },
+                        {
+                                center = {2, -1},
+                                variance = {0.3, 0.6, 0.1},
+                                amplitude = 1.2,
+                                frequency = 0.2
+                        }
+                }
+            }
+        )");
+
+    const std::vector<real3> locs{{3.0, -0.5, -2.0}, {0.1, 0.2, 0.3}, {1.5, 0.0, -0.1}};
+    const real time = 8.0;
+
+    for (int dims = 1; dims <= 3; dims++) {
+        auto ms_opt = manufactured_solution::from_lua(lua["simulation"], dims);
+        REQUIRE(!!ms_opt);
+        auto& ms = *ms_opt;
+
+        std::vector<real> out(locs.size());
+        std::vector<real3> out3(locs.size());
+
+        ms(time, locs, out);
+        for (std::size_t i = 0; i < locs.size(); i++)
+            REQUIRE(out[i] == Catch::Approx(ms(time, locs[i])));
+
+        ms.ddt(time, locs, out);
+        for (std::size_t i = 0; i < locs.size(); i++)
+            REQUIRE(out[i] == Catch::Approx(ms.ddt(time, locs[i])));
+
+        ms.gradient(time, locs, out3);
+        for (std::size_t i = 0; i < locs.size(); i++)
+            REQUIRE_THAT(out3[i], Approx(ms.gradient(time, locs[i])));
+
+        ms.laplacian(time, locs, out);
+        for (std::size_t i = 0; i < locs.size(); i++)
+            REQUIRE(out[i] == Catch::Approx(ms.laplacian(time, locs[i])));
+    }
+}
+
 TEST_CASE("lua")
 {
 
@@ -201,3 +255,117 @@ TEST_CASE("lua")
     REQUIRE_THAT(ms.gradient(time, loc), Approx(g));
     REQUIRE(ms.laplacian(time, loc) == Catch::Approx(t["lap"](time, loc)));
 }
+
+TEST_CASE("lua batched")
+{
+    sol::state lua;
+    lua.open_libraries(sol::lib::base, sol::lib::math);
+    lua.script(R"(
+            pointwise = {
+                manufactured_solution = {
+                        type = "lua",
+
+                        call = function (time, loc)
+                                return loc[3] * time + math.sin(loc[1]) * math.cos(loc[2])
+                        end,
+
+                        ddt = function (time, loc)
+                                return loc[3]
+                        end,
+
+                        grad = function (time, loc)
+                                return  math.sin(loc[1]*loc[2]),
+                                        math.cos(loc[1]*loc[3]),
+                                        math.sin(loc[2]*loc[3])
+                        end,
+
+                        div = function (time, loc)
+                                return loc[1] * loc[2] * loc[3]
+                        end,
+
+                        lap = function (time, loc)
+                                return loc[1] + loc[2] + loc[3]
+                        end
+                }
+            }
+
+            simulation = {
+                manufactured_solution = {
+                        type = "lua",
+                        batched = true,
+
+                        call = function (time, x, y, z)
+                                local u = {}
+                                for i = 1, #x do
+                                        u[i] = z[i] * time + math.sin(x[i]) * math.cos(y[i])
+                                end
+                                return u
+                        end,
+
+                        ddt = function (time, x, y, z)
+                                local u = {}
+                                for i = 1, #x do u[i] = z[i] end
+                                return u
+                        end,
+
+                        grad = function (time, x, y, z)
+                                local gx, gy, gz = {}, {}, {}
+                                for i = 1, #x do
+                                        gx[i] = math.sin(x[i] * y[i])
+                                        gy[i] = math.cos(x[i] * z[i])
+                                        gz[i] = math.sin(y[i] * z[i])
+                                end
+                                return gx, gy, gz
+                        end,
+
+                        div = function (time, x, y, z)
+                                local u = {}
+                                for i = 1, #x do u[i] = x[i] * y[i] * z[i] end
+                                return u
+                        end,
+
+                        lap = function (time, x, y, z)
+                                local u = {}
+                                for i = 1, #x do u[i] = x[i] + y[i] + z[i] end
+                                return u
+                        end
+                }
+            }
+        )");
+    auto ms_opt = manufactured_solution::from_lua(lua["simulation"]);
+    auto ref_opt = manufactured_solution::from_lua(lua["pointwise"]);
+    REQUIRE(!!ms_opt);
+    REQUIRE(!!ref_opt);
+    auto& ms = *ms_opt;
+    auto& ref = *ref_opt;
+
+    const std::vector<real3> locs{{3.0, -0.5, -2.0}, {0.1, 0.2, 0.3}, {1.5, 0.0, -0.1}};
+    const real time = 8.0;
+
+    std::vector<real> out(locs.size());
+    std::vector<real3> out3(locs.size());
+
+    ms(time, locs, out);
+    for (std::size_t i = 0; i < locs.size(); i++)
+        REQUIRE(out[i] == Catch::Approx(ref(time, locs[i])));
+
+    ms.ddt(time, locs, out);
+    for (std::size_t i = 0; i < locs.size(); i++)
+        REQUIRE(out[i] == Catch::Approx(ref.ddt(time, locs[i])));
+
+    ms.gradient(time, locs, out3);
+    for (std::size_t i = 0; i < locs.size(); i++)
+        REQUIRE_THAT(out3[i], Approx(ref.gradient(time, locs[i])));
+
+    ms.divergence(time, locs, out);
+    for (std::size_t i = 0; i < locs.size(); i++)
+        REQUIRE(out[i] == Catch::Approx(ref.divergence(time, locs[i])));
+
+    ms.laplacian(time, locs, out);
+    for (std::size_t i = 0; i < locs.size(); i++)
+        REQUIRE(out[i] == Catch::Approx(ref.laplacian(time, locs[i])));
+
+    // pointwise calls still work in batched mode
+    REQUIRE(ms(time, locs[0]) == Catch::Approx(ref(time, locs[0])));
+    REQUIRE_THAT(ms.gradient(time, locs[0]), Approx(ref.gradient(time, locs[0])));
+}
@@ -65,9 +65,35 @@ interp_deriv_info interp_deriv_coefficients(int dir,
     }
 }
 
+// The discretizations below visit every coefficient of the operator.  At construction
+// they add the points to builders which also record the structure.  A later refresh
+// visits the points in the same order with refills which overwrite the coefficients in
+// place
+
+// stencil coefficients for a single line
+struct scratch {
+    std::span<real> left, right, interp, extra;
+
+    static integer size(const stencil& st)
+    {
+        auto [p, rmax, tmax, ex_max] = st.query_max();
+        return 2 * rmax * tmax + tmax + ex_max;
+    }
+
+    scratch(const stencil& st, std::span<real> work)
+    {
+        auto [p, rmax, tmax, ex_max] = st.query_max();
+        left = work.subspan(0, rmax * tmax);
+        right = work.subspan(rmax * tmax, rmax * tmax);
+        interp = work.subspan(2 * rmax * tmax, tmax);
+        extra = work.subspan(2 * rmax * tmax + tmax, ex_max);
+    }
+};
+
+template <typename Points>
 struct OB_builder {
-    matrix::csr::builder O;
-    matrix::csr::builder B;
+    Points O;
+    Points B;
 
     template <rs::random_access_range R>
     void add_cut_row(integer shape_row, integer solid_ic, integer stride, R&& r)
@@ -130,10 +156,15 @@ struct OB_builder {
         }
     }
 
-    void to_csr(integer r, matrix::csr& O_matrix, matrix::csr& B_matrix, integer rows)
+    void to_csr(integer r,
+                matrix::csr& O_matrix,
+                matrix::csr& B_matrix,
+                integer rows,
+                std::vector<integer>& O_slots,
+                std::vector<integer>& B_slots)
     {
-        O_matrix = MOVE(O.to_csr(rows));
-        B_matrix = MOVE(B.to_csr(rows));
+        O_matrix = O.to_csr(rows, O_slots);
+        B_matrix = B.to_csr(rows, B_slots);
 
         // adjust row/col space flags
         // rowspace for both:
@@ -152,16 +183,36 @@ struct OB_builder {
     }
 };
 
-void cut_discretization(int r,
+// find the interpolation lines on the mesh and remember them for a refresh
+struct find_lines {
+    const mesh& m;
+    std::vector<line>& lines;
+
+    const line& operator()(int r, const int3& cp) const
+    {
+        return lines.emplace_back(m.interp_line(r, cp));
+    }
+};
+
+// reuse the lines found at construction
+struct recall_lines {
+    std::span<const line> lines;
+    integer n = 0;
+
+    const line& operator()(int, const int3&) { return lines[n++]; }
+};
+
+// returns false if there are no rows to update on R{r}
+template <typename Points, typename Lines>
+bool cut_discretization(int r,
                         int dir,
                         const mesh& m,
                         const stencil& st,
-                        const bcs::Grid& grid_bcs,
                         const bcs::Object& obj_bcs,
-                        matrix::csr& O,
-                        matrix::csr& B,
-                        std::span<const real> interior,
-                        const logs& logger)
+                        OB_builder<Points>& builder,
+                        Lines&& interp_line,
+                        scratch work,
+                        const logs& logger = {})
 {
     const auto shapes = m.R(r);
     const auto sz = shapes.size();
@@ -169,17 +220,13 @@ void cut_discretization(int r,
     if (sz == 0 || rs::accumulate(obj_bcs, true, [](auto&& acc, auto&& cur) {
             return acc && (cur == bcs::Dirichlet);
         }))
-        return; // quick exit'
+        return false; // quick exit'
 
-    auto [p, rmax, tmax, ex_max] = st.query_max();
     auto h = m.h(dir);
 
-    OB_builder builder{};
-
-    // allocate maximum amount of memory required by any boundary conditions
-    std::vector<real> c(rmax * tmax);
-    std::vector<real> interp_c(tmax);
-    std::vector<real> extra(ex_max);
+    auto c = work.left;
+    auto interp_c = work.interp;
+    auto extra = work.extra;
     auto stride = m.stride(dir);
 
     if (dir == r) {
@@ -234,7 +281,7 @@ void cut_discretization(int r,
                     builder.add_cut_point(shape_row, v);
                 } else {
                     // cp[dir] += cp_shift;
-                    auto&& [r_stride, left_bounds, right_bounds] = m.interp_line(r, cp);
+                    auto&& [r_stride, left_bounds, right_bounds] = interp_line(r, cp);
                     auto&& [interp_v, left, right] =
                         st.interp(r, cp, y, left_bounds, right_bounds, interp_c);
                     builder.add_interp_row(
@@ -247,8 +294,7 @@ void cut_discretization(int r,
         }
     }
 
-    // construct ray in 'dir` emanative from R(r)
-    builder.to_csr(r, O, B, sz);
+    return true;
 }
 
 struct submatrix_size {
@@ -297,28 +343,78 @@ struct submatrix_size {
     integer right_row(integer row = 0) const { return last_row + stride * row; }
 };
 
+// collects the matrices of the domain discretization, one line at a time
+struct domain_builder {
+    matrix::block::builder O;
+    matrix::csr::builder B;
+    matrix::csr::builder N;
+    matrix::dense left;
+    matrix::dense right;
+
+    template <rs::input_range R>
+    void left_boundary(integer rows, integer columns, R&& rng, flag f = 0)
+    {
+        left = matrix::dense{rows, columns, FWD(rng), f};
+    }
+
+    template <rs::input_range R>
+    void right_boundary(integer rows, integer columns, R&& rng, flag f = 0)
+    {
+        right = matrix::dense{rows, columns, FWD(rng), f};
+    }
+
+    integer boundary_rows() const { return left.rows() + right.rows(); }
+
+    void add_line(const submatrix_size& sub, std::span<const real> interior)
+    {
+        const integer n_interior = sub.rows - boundary_rows();
+
+        O.add_inner_block(sub.columns,
+                          sub.row_offset,
+                          sub.col_offset,
+                          sub.stride,
+                          MOVE(left),
+                          matrix::circulant{n_interior, interior},
+                          MOVE(right));
+    }
+};
+
+// overwrites the coefficients of the matrices built by a domain_builder
+struct domain_refill {
+    matrix::block::refill O;
+    matrix::csr::refill B;
+    matrix::csr::refill N;
+
+    template <rs::input_range R>
+    void left_boundary(integer, integer, R&& rng, flag = 0)
+    {
+        O.left(FWD(rng));
+    }
+
+    template <rs::input_range R>
+    void right_boundary(integer, integer, R&& rng, flag = 0)
+    {
+        O.right(FWD(rng));
+    }
+
+    void add_line(const submatrix_size&, std::span<const real>) { O.next(); }
+};
+
+template <typename Builder>
 void domain_discretization(int dir,
                            const mesh& m,
                            const stencil& st,
                            const bcs::Grid& grid_bcs,
                            const bcs::Object& obj_bcs,
-                           matrix::block& O,
-                           matrix::csr& B,
-                           matrix::csr& N,
-                           std::span<const real> interior)
+                           Builder& builder,
+                           std::span<const real> interior,
+                           scratch work)
 {
-    // query the stencil and allocate memory
-    auto [p, rmax, tmax, ex_max] = st.query_max();
     auto h = m.h(dir);
 
-    // allocate maximum amount of memory required by any boundary conditions
-    std::vector<real> left(rmax * tmax);
-    std::vector<real> right(rmax * tmax);
-    std::vector<real> extra(ex_max);
-
-    auto B_builder = matrix::csr::builder();
-    auto O_builder = matrix::block::builder();
-    auto N_builder = matrix::csr::builder();
+    auto left = work.left;
+    auto right = work.right;
+    auto extra = work.extra;
 
     for (auto [stride, start, end] : m.lines(dir)) {
         // assert(offset == m.ic(start.m_coordinate));
@@ -328,8 +424,6 @@ void domain_discretization(int dir,
         // start with assumption of square matrix and adjust based on boundary conditions
         auto sub = submatrix_size{dir, stride, start, end, m};
 
-        auto leftMat = matrix::dense{};
-
         if (const auto& obj = start.object; obj) {
             const auto id = obj->objectID;
             assert(id < (integer)obj_bcs.size());
@@ -344,35 +438,36 @@ void domain_discretization(int dir,
             int s = bc_t != bcs::Dirichlet;
             rLeft -= s;
             auto lc = left | vs::drop(s * tLeft);
-            leftMat = matrix::dense{
-                rLeft, tLeft - 1, lc | vs::chunk(tLeft) | vs::for_each(vs::drop(1))};
+            builder.left_boundary(
+                rLeft, tLeft - 1, lc | vs::chunk(tLeft) | vs::for_each(vs::drop(1)));
 
             sub.remove_left_row_col();
 
             // add points to B
             auto b_coeffs = lc | vs::stride(tLeft) | vs::take(rLeft);
             for (auto&& [row, val] : vs::enumerate(b_coeffs)) {
-                B_builder.add_point(sub.left_row(row), obj->object_coordinate, val);
+                builder.B.add_point(sub.left_row(row), obj->object_coordinate, val);
             }
 
         } else {
             auto&& [pLeft, rLeft, tLeft, exLeft] = st.query(grid_bcs[dir].left);
             st.nbs(h, grid_bcs[dir].left, 1.0, false, left, extra);
 
-            leftMat = matrix::dense{rLeft, tLeft, left};
             if (grid_bcs[dir].left == bcs::Dirichlet) {
+                builder.left_boundary(rLeft, tLeft, left, ldd);
                 sub.remove_left_row();
-                leftMat.flags(ldd);
-            } else if (grid_bcs[dir].left == bcs::Neumann) {
+            } else {
+                builder.left_boundary(rLeft, tLeft, left);
+            }
+
+            if (grid_bcs[dir].left == bcs::Neumann) {
                 // add data to N matrix
                 for (int row = 0; row < exLeft; row++) {
-                    N_builder.add_point(sub.left_row(row), sub.left_row(), extra[row]);
+                    builder.N.add_point(sub.left_row(row), sub.left_row(), extra[row]);
                 }
             }
         }
 
-        auto rightMat = matrix::dense{};
-
         if (const auto& obj = end.object; obj) {
             const auto id = obj->objectID;
             assert(id < (integer)obj_bcs.size());
@@ -385,17 +480,17 @@ void domain_discretization(int dir,
             rRight -= s;
             auto rc = right | vs::take_exactly(rRight * tRight);
 
-            rightMat = matrix::dense{rRight,
-                                     tRight - 1,
-                                     rc | vs::chunk(tRight) |
-                                         vs::for_each(vs::take(tRight - 1))};
+            builder.right_boundary(rRight,
+                                   tRight - 1,
+                                   rc | vs::chunk(tRight) |
+                                       vs::for_each(vs::take(tRight - 1)));
             sub.remove_right_row_col();
 
             // add points to B
             auto b_coeffs =
                 rc | vs::drop(tRight - 1) | vs::stride(tRight) | vs::take(rRight);
             for (auto&& [row, val] : vs::enumerate(b_coeffs)) {
-                B_builder.add_point(
+                builder.B.add_point(
                     sub.right_row(row - rRight), obj->object_coordinate, val);
             }
 
@@ -403,47 +498,41 @@ void domain_discretization(int dir,
             auto&& [pRight, rRight, tRight, exRight] = st.query(grid_bcs[dir].right);
             st.nbs(h, grid_bcs[dir].right, 1.0, true, right, extra);
 
-            rightMat = matrix::dense{rRight, tRight, right};
             if (grid_bcs[dir].right == bcs::Dirichlet) {
+                builder.right_boundary(rRight, tRight, right, rdd);
                 sub.remove_right_row();
-                rightMat.flags(rdd);
-            } else if (grid_bcs[dir].right == bcs::Neumann) {
+            } else {
+                builder.right_boundary(rRight, tRight, right);
+            }
+
+            if (grid_bcs[dir].right == bcs::Neumann) {
                 for (int row = 0; row < exRight; row++) {
-                    N_builder.add_point(
+                    builder.N.add_point(
                         sub.right_row(row - exRight + 1), sub.right_row(), extra[row]);
                 }
             }
         }
-        const integer n_interior = sub.rows - leftMat.rows() - rightMat.rows();
-
-        O_builder.add_inner_block(sub.columns,
-                                  sub.row_offset,
-                                  sub.col_offset,
-                                  stride,
-                                  MOVE(leftMat),
-                                  matrix::circulant{n_interior, interior},
-                                  MOVE(rightMat));
-    }
 
-    O = MOVE(O_builder).to_block();
-    B = MOVE(B_builder.to_csr(m.size()));
-    N = MOVE(N_builder.to_csr(m.size()));
-
-    // col_space of B is `R{dir}`
-    // 0 -> rx == 1
-    // 1 -> ry == 2
-    // 2 -> rz == 4
-    B.flags(1u << dir);
+        builder.add_line(sub, interior);
+    }
 }
 } // namespace
 
+std::array<stencils::info, 4> derivative::shapes(const stencil& st)
+{
+    return {st.query_max(),
+            st.query(bcs::Dirichlet),
+            st.query(bcs::Floating),
+            st.query(bcs::Neumann)};
+}
+
 derivative::derivative(int dir,
                        const mesh& m,
                        const stencil& st,
                        const bcs::Grid& grid_bcs,
                        const bcs::Object& obj_bcs,
                        const logs& logger)
-    : dir{dir}
+    : dir{dir}, pat{.shapes = shapes(st), .interp = st.query_interp()}
 {
     if (m.extents()[dir] < 2) return;
     // query the stencil and allocate memory
@@ -453,11 +542,71 @@ derivative::derivative(int dir,
     interior_c.resize(2 * p + 1);
     st.interior(h, interior_c);
 
-    domain_discretization(dir, m, st, grid_bcs, obj_bcs, O, B, N, interior_c);
+    work.resize(scratch::size(st));
+
+    auto domain = domain_builder{};
+    domain_discretization(
+        dir, m, st, grid_bcs, obj_bcs, domain, interior_c, scratch{st, work});
+
+    O = MOVE(domain.O).to_block();
+    B = domain.B.to_csr(m.size(), pat.B);
+    N = domain.N.to_csr(m.size(), pat.N);
+
+    // col_space of B is `R{dir}`
+    // 0 -> rx == 1
+    // 1 -> ry == 2
+    // 2 -> rz == 4
+    B.flags(1u << dir);
+
+    // construct ray in 'dir` emanative from R(r)
+    const std::array Bf{&Bfx, &Bfy, &Bfz};
+    const std::array Br{&Brx, &Bry, &Brz};
+    for (int r = 0; r < 3; r++) {
+        auto cut = OB_builder<matrix::csr::builder>{};
+        if (cut_discretization(r,
+                               dir,
+                               m,
+                               st,
+                               obj_bcs,
+                               cut,
+                               find_lines{m, pat.lines[r]},
+                               scratch{st, work},
+                               logger))
+            cut.to_csr(r, *Bf[r], *Br[r], m.R(r).size(), pat.Bf[r], pat.Br[r]);
+    }
+}
 
-    cut_discretization(0, dir, m, st, grid_bcs, obj_bcs, Bfx, Brx, interior_c, logger);
-    cut_discretization(1, dir, m, st, grid_bcs, obj_bcs, Bfy, Bry, interior_c, logger);
-    cut_discretization(2, dir, m, st, grid_bcs, obj_bcs, Bfz, Brz, interior_c, logger);
+bool derivative::same_structure(const stencil& st) const
+{
+    return pat.shapes == shapes(st) && pat.interp == st.query_interp();
+}
+
+bool derivative::refresh(const mesh& m,
+                         const stencil& st,
+                         const bcs::Grid& grid_bcs,
+                         const bcs::Object& obj_bcs)
+{
+    if (!same_structure(st)) return false;
+    if (m.extents()[dir] < 2) return true;
+
+    // the circulants of O refer to these coefficients
+    st.interior(m.h(dir), interior_c);
+
+    auto domain = domain_refill{{O}, {B, pat.B}, {N, pat.N}};
+    domain_discretization(
+        dir, m, st, grid_bcs, obj_bcs, domain, interior_c, scratch{st, work});
+    domain.O.finish();
+
+    const std::array Bf{&Bfx, &Bfy, &Bfz};
+    const std::array Br{&Brx, &Bry, &Brz};
+    for (int r = 0; r < 3; r++) {
+        auto cut = OB_builder<matrix::csr::refill>{{*Bf[r], pat.Bf[r]},
+                                                   {*Br[r], pat.Br[r]}};
+        cut_discretization(
+            r, dir, m, st, obj_bcs, cut, recall_lines{pat.lines[r]}, scratch{st, work});
+    }
+
+    return true;
 }
 
 template <typename Op>
@@ -466,6 +615,9 @@ void derivative::operator()(scalar_view u, scalar_span du, Op op) const
 {
     using namespace si;
 
+    // Each matrix splits its rows over the default thread pool.  The order of the
+    // applications is kept since Br* accumulates onto Bf* and B onto O
+
     // update points in R
     Bfx(get<D>(u), get<Rx>(du));
     Bfy(get<D>(u), get<Ry>(du));
@@ -500,6 +652,72 @@ void derivative::operator()(scalar_view u, scalar_view nu, scalar_span du, Op op
     N(get<D>(nu), get<D>(du));
 }
 
+template <typename Op>
+    requires(!Scalar<Op>)
+void derivative::interior_rows(
+    integer first, integer last, scalar_view u, scalar_span du, Op op) const
+{
+    using namespace si;
+
+    O.apply_rows(first, last, get<D>(u), get<D>(du), op);
+    switch (dir) {
+    case 0:
+        B.apply_rows(first, last, get<Rx>(u), get<D>(du));
+        break;
+    case 1:
+        B.apply_rows(first, last, get<Ry>(u), get<D>(du));
+        break;
+    default:
+        B.apply_rows(first, last, get<Rz>(u), get<D>(du));
+    }
+}
+
+template <typename Op>
+    requires(!Scalar<Op>)
+void derivative::interior_rows(integer first,
+                               integer last,
+                               scalar_view u,
+                               scalar_view nu,
+                               scalar_span du,
+                               Op op) const
+{
+    using namespace si;
+
+    interior_rows(first, last, u, du, op);
+    N.apply_rows(first, last, get<D>(nu), get<D>(du));
+}
+
+void derivative::boundary_rows(int r,
+                               std::span<const integer> rows,
+                               scalar_view u,
+                               scalar_span du) const
+{
+    using namespace si;
+
+    switch (r) {
+    case 0:
+        Bfx.apply_rows(rows, get<D>(u), get<Rx>(du));
+        Brx.apply_rows(rows, get<Rx>(u), get<Rx>(du));
+        break;
+    case 1:
+        Bfy.apply_rows(rows, get<D>(u), get<Ry>(du));
+        Bry.apply_rows(rows, get<Ry>(u), get<Ry>(du));
+        break;
+    default:
+        Bfz.apply_rows(rows, get<D>(u), get<Rz>(du));
+        Brz.apply_rows(rows, get<Rz>(u), get<Rz>(du));
+    }
+}
+
+integer derivative::boundary_reach(int r, integer row) const
+{
+    const auto& Bf = r == 0 ? Bfx : r == 1 ? Bfy : Bfz;
+    if (row >= Bf.rows()) return -1;
+
+    const auto cols = Bf.column_indices(row);
+    return cols.empty() ? -1 : rs::max(cols);
+}
+
 template void derivative::operator()<eq_t>(scalar_view, scalar_span, eq_t) const;
 
 template void
@@ -511,4 +729,16 @@ derivative::operator()<eq_t>(scalar_view, scalar_view, scalar_span, eq_t) const;
 template void
 derivative::operator()<plus_eq_t>(scalar_view, scalar_view, scalar_span, plus_eq_t) const;
 
+template void derivative::interior_rows<eq_t>(
+    integer, integer, scalar_view, scalar_span, eq_t) const;
+
+template void derivative::interior_rows<plus_eq_t>(
+    integer, integer, scalar_view, scalar_span, plus_eq_t) const;
+
+template void derivative::interior_rows<eq_t>(
+    integer, integer, scalar_view, scalar_view, scalar_span, eq_t) const;
+
+template void derivative::interior_rows<plus_eq_t>(
+    integer, integer, scalar_view, scalar_view, scalar_span, plus_eq_t) const;
+
 } // namespace ccs
@@ -27,6 +27,21 @@ class derivative
     matrix::csr Bfz, Brz;
     std::vector<real> interior_c;
 
+    // Structure recorded at construction so `refresh` can overwrite the coefficients in
+    // place: the shapes the stencil reported, the slot in each csr matrix of the points
+    // in the order they were added, and the interpolation lines used by cut cells
+    struct pattern {
+        std::array<stencils::info, 4> shapes{};
+        stencils::interp_info interp{};
+        std::vector<integer> B, N;
+        std::array<std::vector<integer>, 3> Bf, Br;
+        std::array<std::vector<line>, 3> lines;
+    } pat;
+    // stencil coefficients for a single line
+    std::vector<real> work;
+
+    static std::array<stencils::info, 4> shapes(const stencil&);
+
 public:
     derivative() = default;
 
@@ -37,6 +52,15 @@ public:
                const bcs::Object& object_bcs,
                const logs& = {});
 
+    // true if `st` leads to the same structure as the stencil used for construction
+    bool same_structure(const stencil& st) const;
+
+    // Overwrite the coefficients with those of `st` without rebuilding the structure.
+    // The mesh and boundary conditions must be those used for construction.  Runs in
+    // time proportional to the number of coefficients and returns false, leaving the
+    // operator unchanged, if the structure differs
+    bool refresh(const mesh&, const stencil& st, const bcs::Grid&, const bcs::Object&);
+
     void visit(matrix::visitor& v) const
     {
         // Assumes 1d
@@ -58,5 +82,36 @@ public:
                     scalar_view derivative_values,
                     scalar_span,
                     Op op = {}) const;
+
+    // The pieces of the operator above restricted to a subset of the output.  These
+    // let several derivatives be fused into a single sweep over the domain.
+    //
+    // rows [first, last) of the fluid domain
+    template <typename Op = eq_t>
+        requires(!Scalar<Op>)
+    void interior_rows(integer first,
+                       integer last,
+                       scalar_view field_values,
+                       scalar_span,
+                       Op op = {}) const;
+
+    // same as above but also applies the neumann data
+    template <typename Op = eq_t>
+        requires(!Scalar<Op>)
+    void interior_rows(integer first,
+                       integer last,
+                       scalar_view field_values,
+                       scalar_view derivative_values,
+                       scalar_span,
+                       Op op = {}) const;
+
+    // accumulate the listed rows of the boundary data on R{r}
+    void boundary_rows(int r,
+                       std::span<const integer> rows,
+                       scalar_view field_values,
+                       scalar_span) const;
+
+    // largest fluid domain index read by `row` of the boundary data on R{r} or -1
+    integer boundary_reach(int r, integer row) const;
 };
 } // namespace ccs
@@ -14,6 +14,8 @@
 #include <fmt/core.h>
 #include <fmt/ranges.h>
 
+#include <chrono>
+
 using namespace ccs;
 using Catch::Matchers::Approx;
 
@@ -404,3 +406,74 @@ TEST_CASE("E2 with Objects")
     dz(u, du);
     approx<si::D, si::Rx, si::Ry, si::Rz>(du, du_z);
 }
+
+TEST_CASE("Refresh")
+{
+    using T = std::vector<real>;
+
+    const auto extents = int3{21, 22, 23};
+
+    auto m = mesh{index_extents{extents},
+                  domain_extents{.min = {0.1, 0.2, 0.3}, .max = {1, 2, 2.2}},
+                  std::vector<shape>{make_sphere(0, real3{0.45, 1.011, 1.31}, 0.25)}};
+
+    const auto gridBcs = bcs::Grid{bcs::dd, bcs::ff, bcs::fd};
+    const auto objectBcs = bcs::Object{bcs::Floating};
+
+    const std::vector<real> alpha0{
+        -1.47956280234494, 0.261900367793859, -0.145072532538541, -0.224665713988644};
+    const std::vector<real> alpha1{-1.25, 0.125, -0.0625, -0.3125};
+    const auto st0 = stencils::make_E2_1(alpha0);
+    const auto st1 = stencils::make_E2_1(alpha1);
+
+    randomize();
+    scalar<T> u{m.ss()};
+    u | sel::D = vs::generate_n(g, m.size());
+    u | sel::Rx = vs::generate_n(g, m.Rx().size());
+    u | sel::Ry = vs::generate_n(g, m.Ry().size());
+    u | sel::Rz = vs::generate_n(g, m.Rz().size());
+
+    for (int i = 0; i < 3; i++) {
+        auto d = derivative{i, m, st0, gridBcs, objectBcs};
+        const auto fresh = derivative{i, m, st1, gridBcs, objectBcs};
+
+        REQUIRE(d.same_structure(st1));
+        REQUIRE(d.refresh(m, st1, gridBcs, objectBcs));
+
+        scalar<T> du{m.ss()}, ex{m.ss()};
+        d(u, du);
+        fresh(u, ex);
+        approx<si::D, si::Rx, si::Ry, si::Rz>(du, ex);
+
+        // a stencil of a different size cannot reuse the structure
+        REQUIRE(!d.same_structure(stencils::second::E4));
+        REQUIRE(!d.refresh(m, stencils::second::E4, gridBcs, objectBcs));
+        d(u, du);
+        approx<si::D, si::Rx, si::Ry, si::Rz>(du, ex);
+    }
+}
+
+TEST_CASE("Construction Scaling", "[.][benchmark]")
+{
+    // time the operator construction as the number of object intersections grows.
+    // Should scale roughly linearly with |R|
+    const auto gridBcs = bcs::Grid{bcs::dd, bcs::dd, bcs::dd};
+    const auto objectBcs = bcs::Object{bcs::Dirichlet};
+
+    for (int n : {32, 64, 128}) {
+        auto m = mesh{index_extents{int3{n, n, n}},
+                      domain_extents{.min = {0, 0, 0}, .max = {1, 1, 1}},
+                      std::vector<shape>{make_sphere(0, real3{0.5, 0.5, 0.5}, 0.3)}};
+
+        const auto start = std::chrono::steady_clock::now();
+        auto dx = derivative{0, m, stencils::second::E2, gridBcs, objectBcs};
+        auto dy = derivative{1, m, stencils::second::E2, gridBcs, objectBcs};
+        auto dz = derivative{2, m, stencils::second::E2, gridBcs, objectBcs};
+        const auto stop = std::chrono::steady_clock::now();
+
+        fmt::print("n = {:4d}, |R| = {:8d}, construction: {:10.3f} ms\n",
+                   n,
+                   m.Rx().size() + m.Ry().size() + m.Rz().size(),
+                   std::chrono::duration<double, std::milli>(stop - start).count());
+    }
+}
@@ -1,48 +1,62 @@
 #include "eigenvalue_visitor.hpp"
 #include "gradient.hpp"
+#include "parallel/thread_pool.hpp"
 
+#include <complex>
 #include <cstdint>
+#include <limits>
 #include <lapack.hh>
 
 
 namespace ccs
 {
+namespace
+{
+// eigenvalues of the dense n x n matrix `a`, which is overwritten
+int64_t eigenvalues(integer rows, real* a, std::vector<std::complex<real>>& W)
+{
+    real vl, vr;
+    int64_t lda = rows;
+    int64_t n = rows;
+    // according to the docs I should be able to leave ldvl and ldvr as 1 since
+    // jobl=jobr='N', but then I get an error in the dgeev_work routine.
+    int64_t ldvl = n;
+    int64_t ldvr = n;
+
+    W.resize(rows);
+
+    return lapack::geev(lapack::Job::NoVec,
+                        lapack::Job::NoVec,
+                        n,
+                        a,
+                        lda,
+                        W.data(),
+                        &vl,
+                        ldvl,
+                        &vr,
+                        ldvr);
+}
+} // namespace
+
 void eigenvalue_visitor::visit(const derivative& d)
 {
-    // build a map of where to put the coefficients by first utilizing the
-    // unit_stride_visitor
-    d.visit(u);
+    // build a map of where to put the coefficients by first utilizing a copy of the
+    // unit_stride_visitor so the visitor may be used again
+    auto map = u;
+    d.visit(map);
 
-    auto [rows, cols] = u.mapped_dims();
+    auto [rows, cols] = map.mapped_dims();
     assert(rows == cols);
     eigs_real.resize(rows);
     eigs_imag.resize(rows);
 
     // canabalize the unit_stride_visitor to construct our coefficient_visitor
-    v = matrix::coefficient_visitor{MOVE(u)};
+    v = matrix::coefficient_visitor{MOVE(map)};
     d.visit(v);
 
     // compute eigenvalues given our now dense matrix
-    real vl, vr;
-    int64_t lda = rows;
-    int64_t n = rows;
-    // according to the docs I should be able to leave ldvl and ldvr as 1 since
-    // jobl=jobr='N', but then I get an error in the dgeev_work routine.
-    int64_t ldvl = n;
-    int64_t ldvr = n;
-
-    std::vector<std::complex<double>> W(eigs_real.size());
-
-    auto ret = lapack::geev(lapack::Job::NoVec,
-                            lapack::Job::NoVec,
-                            n,
-                            v.data(),
-                            lda,
-                            W.data(),
-                            &vl,
-                            ldvl,
-                            &vr,
-                            ldvr);
+    std::vector<std::complex<double>> W;
+    [[maybe_unused]] auto ret = eigenvalues(rows, v.data(), W);
     assert(ret == 0);
 
     for (int i = 0; i < (int)W.size(); i++) {
@@ -53,4 +67,131 @@ void eigenvalue_visitor::visit(const derivative& d)
 
 std::span<const real> eigenvalue_visitor::eigenvalues_real() const { return eigs_real; }
 std::span<const real> eigenvalue_visitor::eigenvalues_imag() const { return eigs_imag; }
+
+std::vector<real>
+eigenvalue_visitor::spectral_abscissae(const mesh& m,
+                                       std::span<const stencil> candidates,
+                                       const bcs::Grid& grid_bcs,
+                                       const bcs::Object& object_bcs,
+                                       real scale) const
+{
+    std::vector<real> abscissae(candidates.size());
+
+    // one candidate is enough work to wake a thread
+    parallel_for((integer)candidates.size(), 1, [&](integer first, integer last) {
+        derivative d;
+        matrix::coefficient_visitor coeffs;
+        std::vector<std::complex<real>> W;
+        integer rows = 0;
+
+        for (integer i = first; i < last; i++) {
+            const auto& st = candidates[i];
+
+            if (i > first && d.refresh(m, st, grid_bcs, object_bcs)) {
+                coeffs.clear();
+            } else {
+                d = derivative{0, m, st, grid_bcs, object_bcs};
+                auto map = u;
+                d.visit(map);
+                rows = map.mapped_dims()[0];
+                coeffs = matrix::coefficient_visitor{MOVE(map)};
+            }
+            d.visit(coeffs);
+
+            if (eigenvalues(rows, coeffs.data(), W) != 0) {
+                abscissae[i] = std::numeric_limits<real>::quiet_NaN();
+                continue;
+            }
+
+            real a = std::numeric_limits<real>::lowest();
+            for (auto&& w : W) a = std::max(a, scale * w.real());
+            abscissae[i] = a;
+        }
+    });
+
+    return abscissae;
+}
+
+eigenvalue_visitor::sensitivity
+eigenvalue_visitor::rightmost_sensitivity(const mesh& m,
+                                          const stencil& st,
+                                          const bcs::Grid& grid_bcs,
+                                          const bcs::Object& object_bcs,
+                                          real scale) const
+{
+    const auto d = derivative{0, m, st, grid_bcs, object_bcs};
+    auto map = u;
+    d.visit(map);
+    const integer rows = map.mapped_dims()[0];
+
+    auto coeffs = matrix::coefficient_visitor{matrix::unit_stride_visitor{map}};
+    d.visit(coeffs);
+    for (integer i = 0; i < rows * rows; i++) coeffs.data()[i] *= scale;
+
+    // lapack reads the row major coefficients as the transpose of the operator.  The
+    // derivatives below are read the same way so the result is unchanged
+    const int64_t n = rows;
+    std::vector<std::complex<real>> W(rows);
+    std::vector<real> VL(rows * rows), VR(rows * rows);
+    [[maybe_unused]] auto ret = lapack::geev(lapack::Job::Vec,
+                                             lapack::Job::Vec,
+                                             n,
+                                             coeffs.data(),
+                                             n,
+                                             W.data(),
+                                             VL.data(),
+                                             n,
+                                             VR.data(),
+                                             n);
+    assert(ret == 0);
+
+    // the rightmost eigenvalue, taking the one with positive imaginary part of a pair
+    integer j = 0;
+    for (integer i = 1; i < rows; i++)
+        if (W[i].real() > W[j].real() ||
+            (W[i].real() == W[j].real() && W[i].imag() > W[j].imag()))
+            j = i;
+
+    // a complex pair of eigenvectors is stored as the real and imaginary parts in
+    // consecutive columns
+    auto eigenvector = [&](const std::vector<real>& V) {
+        std::vector<std::complex<real>> x(rows);
+        for (integer i = 0; i < rows; i++) {
+            if (W[j].imag() > 0)
+                x[i] = {V[i + j * rows], V[i + (j + 1) * rows]};
+            else if (W[j].imag() < 0)
+                x[i] = {V[i + (j - 1) * rows], -V[i + j * rows]};
+            else
+                x[i] = V[i + j * rows];
+        }
+        return x;
+    };
+    const auto x = eigenvector(VR);
+    const auto y = eigenvector(VL);
+
+    std::complex<real> yx{};
+    for (integer i = 0; i < rows; i++) yx += std::conj(y[i]) * x[i];
+
+    // one operator per parameter, built concurrently
+    std::vector<std::complex<real>> gradient(st.parameters());
+    parallel_for((integer)gradient.size(), 1, [&](integer first, integer last) {
+        for (integer k = first; k < last; k++) {
+            const auto dd =
+                derivative{0, m, st.parameter_derivative((int)k), grid_bcs, object_bcs};
+            auto dA = matrix::coefficient_visitor{matrix::unit_stride_visitor{map}};
+            dd.visit(dA);
+
+            std::complex<real> s{};
+            for (integer c = 0; c < rows; c++) {
+                std::complex<real> col{};
+                for (integer r = 0; r < rows; r++)
+                    col += std::conj(y[r]) * dA.data()[r + c * rows];
+                s += col * x[c];
+            }
+            gradient[k] = scale * s / yx;
+        }
+    });
+
+    return {W[j], MOVE(gradient)};
+}
 } // namespace ccs
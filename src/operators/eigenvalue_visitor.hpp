@@ -1,7 +1,12 @@
 #pragma once
 
+#include "boundaries.hpp"
 #include "matrices/coefficient_visitor.hpp"
+#include "mesh/mesh.hpp"
 #include "operator_visitor.hpp"
+#include "stencils/stencil.hpp"
+
+#include <complex>
 
 namespace ccs
 {
@@ -26,5 +31,34 @@ public:
 
     std::span<const real> eigenvalues_real() const;
     std::span<const real> eigenvalues_imag() const;
+
+    // Largest real part of the eigenvalues of `scale` times the x derivative for each
+    // candidate stencil on the 1D mesh the visitor was built for.  The candidates are
+    // split across the default thread pool.  Every thread keeps its own derivative,
+    // dense matrix and eigenvalue storage.  When a candidate has the structure of the
+    // previous one on that thread only the coefficients are refreshed and the unit
+    // stride map is reused
+    std::vector<real> spectral_abscissae(const mesh&,
+                                         std::span<const stencil> candidates,
+                                         const bcs::Grid&,
+                                         const bcs::Object&,
+                                         real scale = 1.0) const;
+
+    struct sensitivity {
+        std::complex<real> eigenvalue;
+        // derivative of the eigenvalue with respect to each free parameter of the stencil
+        std::vector<std::complex<real>> gradient;
+    };
+
+    // The rightmost eigenvalue of `scale` times the x derivative built from `st` along
+    // with its gradient with respect to the stencil parameters.  With left and right
+    // eigenvectors y and x each derivative is y^H dA x / y^H x so one eigensolve gives
+    // the whole gradient.  dA is built from the stencil's coefficient derivatives, see
+    // stencil::parameter_derivative.  The eigenvalue is assumed to be simple
+    sensitivity rightmost_sensitivity(const mesh&,
+                                      const stencil& st,
+                                      const bcs::Grid&,
+                                      const bcs::Object&,
+                                      real scale = 1.0) const;
 };
 } // namespace ccs
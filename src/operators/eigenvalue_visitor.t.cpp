@@ -7,6 +7,7 @@
 
 #include "fields/tuple_utils.hpp"
 #include "identity_stencil.hpp"
+#include "parallel/thread_pool.hpp"
 #include "stencils/stencil.hpp"
 
 #include <sol/sol.hpp>
@@ -113,3 +114,81 @@ TEST_CASE("e2-poly")
 
     REQUIRE(rs::max(eigs) == Catch::Approx(0.19628372852526094));
 }
+
+TEST_CASE("spectral abscissae")
+{
+    auto m = mesh{index_extents{int3{31, 1, 1}},
+                  domain_extents{.min = {0, 0, 0}, .max = {1, 1, 1}},
+                  std::vector<shape>{
+                      make_yz_rect(0, real3{0.0011, -1, -1}, real3{0.0011, 2, 2}, 1),
+                      make_yz_rect(1, real3{0.9731, -1, -1}, real3{0.9731, 2, 2}, -1)}};
+    const auto gridBcs = bcs::Grid{bcs::ff, bcs::ff, bcs::ff};
+    const auto objectBcs = bcs::Object{bcs::Dirichlet, bcs::Floating};
+
+    // a family of E2_1 schemes with a scheme of another structure in the middle
+    std::vector<stencil> candidates;
+    for (int i = 0; i < 12; i++) {
+        const real t = i / 11.0;
+        candidates.push_back(stencils::make_E2_1(T{-1.47956280234494 + 0.25 * t,
+                                                   0.261900367793859 - 0.1 * t,
+                                                   -0.145072532538541,
+                                                   -0.224665713988644 - 0.05 * t}));
+        if (i == 5) candidates.push_back(stencils::identity);
+    }
+
+    auto v = eigenvalue_visitor{m.extents(), B{true, false}, B{}, B{}};
+
+    T exact;
+    for (auto&& st : candidates) {
+        v.visit(derivative{0, m, st, gridBcs, objectBcs});
+        exact.push_back(-rs::min(v.eigenvalues_real()));
+    }
+
+    for (int threads : {1, 4}) {
+        set_thread_count(threads);
+        auto res = v.spectral_abscissae(m, candidates, gridBcs, objectBcs, -1.0);
+        REQUIRE_THAT(res, Approx(exact));
+    }
+    set_thread_count(1);
+}
+
+TEST_CASE("sensitivity")
+{
+    auto m = mesh{index_extents{int3{31, 1, 1}},
+                  domain_extents{.min = {0, 0, 0}, .max = {1, 1, 1}},
+                  std::vector<shape>{
+                      make_yz_rect(0, real3{0.0011, -1, -1}, real3{0.0011, 2, 2}, 1),
+                      make_yz_rect(1, real3{0.9731, -1, -1}, real3{0.9731, 2, 2}, -1)}};
+    const auto gridBcs = bcs::Grid{bcs::ff, bcs::ff, bcs::ff};
+    const auto objectBcs = bcs::Object{bcs::Dirichlet, bcs::Floating};
+
+    const T alpha{
+        -1.47956280234494, 0.261900367793859, -0.145072532538541, -0.224665713988644};
+    const auto st = stencils::make_E2_1(alpha);
+
+    auto v = eigenvalue_visitor{m.extents(), B{true, false}, B{}, B{}};
+    const auto s = v.rightmost_sensitivity(m, st, gridBcs, objectBcs, -1.0);
+    REQUIRE(s.gradient.size() == 4u);
+
+    // the eigenvalue is the spectral abscissa
+    const std::vector<stencil> base{st};
+    const auto a = v.spectral_abscissae(m, base, gridBcs, objectBcs, -1.0);
+    REQUIRE(s.eigenvalue.real() == Catch::Approx(a[0]));
+
+    // central differences of the spectral abscissa
+    const real eps = 1e-6;
+    std::vector<stencil> candidates;
+    for (int k = 0; k < 4; k++) {
+        T ap{alpha}, am{alpha};
+        ap[k] += eps;
+        am[k] -= eps;
+        candidates.push_back(stencils::make_E2_1(ap));
+        candidates.push_back(stencils::make_E2_1(am));
+    }
+    const auto fd = v.spectral_abscissae(m, candidates, gridBcs, objectBcs, -1.0);
+
+    for (int k = 0; k < 4; k++) {
+        const real exact = (fd[2 * k] - fd[2 * k + 1]) / (2 * eps);
+        REQUIRE(s.gradient[k].real() == Catch::Approx(exact).epsilon(1e-4).margin(1e-6));
+    }
+}
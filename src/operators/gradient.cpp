@@ -1,6 +1,9 @@
 #include "gradient.hpp"
 
 #include "io/logging.hpp"
+#include "parallel/thread_pool.hpp"
+
+#include <range/v3/algorithm/fill.hpp>
 
 namespace ccs
 {
@@ -8,7 +11,8 @@ gradient::gradient(const mesh& m,
                    const stencil& st,
                    const bcs::Grid& grid_bcs,
                    const bcs::Object& obj_bcs,
-                   const logs& build_logger)
+                   const logs& build_logger,
+                   integer tile_size)
 {
     logs logger{build_logger, "gradient", "gradient.csv"};
     logger.set_pattern("%v");
@@ -22,6 +26,23 @@ gradient::gradient(const mesh& m,
     dy = derivative{1, m, st, grid_bcs, obj_bcs, logger};
     dz = derivative{2, m, st, grid_bcs, obj_bcs, logger};
     ex = m.extents();
+
+    tiles = tiling{m, {&dx, &dy, &dz}, tile_size};
+}
+
+bool gradient::refresh(const mesh& m,
+                       const stencil& st,
+                       const bcs::Grid& grid_bcs,
+                       const bcs::Object& obj_bcs)
+{
+    // the tiles only depend on the structure so are kept
+    if (!(dx.same_structure(st) && dy.same_structure(st) && dz.same_structure(st)))
+        return false;
+
+    dx.refresh(m, st, grid_bcs, obj_bcs);
+    dy.refresh(m, st, grid_bcs, obj_bcs);
+    dz.refresh(m, st, grid_bcs, obj_bcs);
+    return true;
 }
 
 std::function<void(vector_span)> gradient::operator()(scalar_view u) const
@@ -33,4 +54,78 @@ std::function<void(vector_span)> gradient::operator()(scalar_view u) const
         if (ex[2] > 1) dz(u, get<vi::Z>(du));
     }};
 }
+
+std::function<void(scalar_span)> gradient::dot(vector_view G, scalar_view u) const
+{
+    return [this, G, u](scalar_span out) {
+        scalar_real du{u};
+        dot(G, u, du)(out);
+    };
+}
+
+std::function<void(scalar_span)>
+gradient::dot(vector_view G, scalar_view u, scalar_span du) const
+{
+    return [this, G, u, du](scalar_span out) {
+        using namespace si;
+
+        const std::array<const derivative*, 3> ds{&dx, &dy, &dz};
+        const std::array<scalar_view, 3> g{get<vi::X>(G), get<vi::Y>(G), get<vi::Z>(G)};
+
+        // out = g * du for the first direction and out += g * du for the rest
+        auto accumulate = [](bool first, real& o, real c, real d) {
+            o = first ? c * d : o + c * d;
+        };
+
+        // tiles write disjoint rows of both `out` and `du` so they may be spread
+        // across threads
+        parallel_for(tiles.bounds(), tiling::default_size, [&](integer t0, integer t1) {
+            for (integer t = t0; t < t1; t++) {
+                const integer first = tiles.first(t);
+                const integer last = tiles.last(t);
+
+                bool first_dir = true;
+                for (int i = 0; i < 3; i++) {
+                    if (ex[i] < 2) continue;
+
+                    rs::fill(get<D>(du).subspan(first, last - first), 0.0);
+                    ds[i]->interior_rows(first, last, u, du);
+
+                    const auto& gi = get<D>(g[i]);
+                    for (integer row = first; row < last; row++)
+                        accumulate(first_dir, get<D>(out)[row], gi[row], get<D>(du)[row]);
+                    first_dir = false;
+                }
+                if (first_dir) rs::fill(get<D>(out).subspan(first, last - first), 0.0);
+
+                for (int r = 0; r < 3; r++) {
+                    const auto rows = tiles.boundary_rows(r, t);
+                    if (rows.empty()) continue;
+
+                    auto&& o = r == 0   ? get<Rx>(out)
+                               : r == 1 ? get<Ry>(out)
+                                        : get<Rz>(out);
+                    auto&& d = r == 0 ? get<Rx>(du) : r == 1 ? get<Ry>(du) : get<Rz>(du);
+
+                    first_dir = true;
+                    for (int i = 0; i < 3; i++) {
+                        if (ex[i] < 2) continue;
+
+                        for (auto row : rows) d[row] = 0;
+                        ds[i]->boundary_rows(r, rows, u, du);
+
+                        const auto& gi = r == 0 ? get<Rx>(g[i])
+                                         : r == 1 ? get<Ry>(g[i])
+                                                  : get<Rz>(g[i]);
+                        for (auto row : rows)
+                            accumulate(first_dir, o[row], gi[row], d[row]);
+                        first_dir = false;
+                    }
+                    if (first_dir)
+                        for (auto row : rows) o[row] = 0;
+                }
+            }
+        });
+    };
+}
 } // namespace ccs
@@ -3,6 +3,7 @@
 #include "derivative.hpp"
 #include "fields/vector.hpp"
 #include "operator_visitor.hpp"
+#include "tiling.hpp"
 
 namespace ccs
 {
@@ -14,6 +15,8 @@ class gradient
     derivative dz;
     index_extents ex;
 
+    tiling tiles;
+
 public:
     gradient() = default;
 
@@ -21,10 +24,23 @@ public:
              const stencil&,
              const bcs::Grid&,
              const bcs::Object&,
-             const logs& = {});
+             const logs& = {},
+             integer tile_size = tiling::default_size);
+
+    // overwrite the coefficients of every direction with those of `st` keeping the
+    // structure.  See derivative::refresh
+    bool refresh(const mesh&, const stencil& st, const bcs::Grid&, const bcs::Object&);
 
     std::function<void(vector_span)> operator()(scalar_view) const;
 
+    // G . grad(u) computed tile by tile without forming grad(u).  Each direction of the
+    // gradient is formed a tile at a time in `du`, which must be sized like `u`
+    std::function<void(scalar_span)>
+    dot(vector_view G, scalar_view u, scalar_span du) const;
+
+    // as above with a scratch scalar allocated for each evaluation
+    std::function<void(scalar_span)> dot(vector_view G, scalar_view u) const;
+
     void visit(operator_visitor& v) const { return v.visit(dx); }
 };
 } // namespace ccs
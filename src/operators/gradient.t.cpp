@@ -1,6 +1,8 @@
 #include "gradient.hpp"
 
+#include "fields/algorithms.hpp"
 #include "fields/selector.hpp"
+#include "parallel/thread_pool.hpp"
 #include "stencils/stencil.hpp"
 
 #include <catch2/catch_approx.hpp>
@@ -328,3 +330,87 @@ TEST_CASE("E2 with Objects - Floating")
     REQUIRE_THAT(get<vi::zRy>(ex), Approx(get<vi::zRy>(du)));
     REQUIRE_THAT(get<vi::zRz>(ex), Approx(get<vi::zRz>(du)));
 }
+
+TEST_CASE("Dot")
+{
+    sol::state lua;
+    lua.script(R"(
+        simulation = {
+            mesh = {
+                index_extents = {31, 32, 33},
+                domain_bounds = {
+                    min = {0.1, 0.2, 0.3},
+                    max = {1, 2, 2.2}
+                }
+            },
+            domain_boundaries = {
+                xmin = "dirichlet",
+                zmax = "dirichlet"
+            },
+            shapes = {
+                {
+                    type = "sphere",
+                    center = {0.45, 1.011, 1.31},
+                    radius = 0.141,
+                    boundary_condition = "floating"
+                }
+            },
+            scheme = {
+                order = 1,
+                type = "E2",
+                alpha = {-1.47956280234494, 0.261900367793859, -0.145072532538541, -0.224665713988644}
+            }
+        }
+    )");
+    auto m_opt = mesh::from_lua(lua["simulation"]);
+    REQUIRE(!!m_opt);
+    const mesh& m = *m_opt;
+
+    auto bc_opt = bcs::from_lua(lua["simulation"], m.extents());
+    REQUIRE(!!bc_opt);
+    auto&& [gridBcs, objectBcs] = *bc_opt;
+
+    auto scheme_opt = stencil::from_lua(lua["simulation"]);
+    REQUIRE(!!scheme_opt);
+    stencil st = *scheme_opt;
+
+    const auto loc = m.xyz;
+    scalar_real u{loc | f2};
+
+    // some spatially varying coefficients
+    vector_real G{m.vs()};
+    G | m.fluid = tuple{loc | f2_dy, loc | f2_dz, loc | f2_dx};
+    G | sel::xR = m.vxyz | f2_dy;
+    G | sel::yR = m.vxyz | f2_dz;
+    G | sel::zR = m.vxyz | f2_dx;
+
+    // reference forms the full gradient
+    vector_real du{m.vs()};
+    du = gradient{m, st, gridBcs, objectBcs}(u);
+    scalar_real ex{m.ss()};
+    ex = dot(G, du);
+
+    for (integer tile_size : {integer{50}, integer{32 * 33}, tiling::default_size}) {
+        auto grad = gradient{m, st, gridBcs, objectBcs, {}, tile_size};
+
+        for (int threads : {1, 3}) {
+            set_thread_count(threads);
+            scalar_real v{m.ss()};
+            v = -1;
+            v = grad.dot(G, u);
+
+            REQUIRE_THAT(get<si::D>(ex), Approx(get<si::D>(v)));
+            REQUIRE_THAT(get<si::Rx>(ex), Approx(get<si::Rx>(v)));
+            REQUIRE_THAT(get<si::Ry>(ex), Approx(get<si::Ry>(v)));
+            REQUIRE_THAT(get<si::Rz>(ex), Approx(get<si::Rz>(v)));
+
+            // with the scratch supplied by the caller
+            scalar_real scratch{m.ss()};
+            v = -1;
+            v = grad.dot(G, u, scratch);
+            REQUIRE_THAT(get<si::D>(ex), Approx(get<si::D>(v)));
+            REQUIRE_THAT(get<si::Rx>(ex), Approx(get<si::Rx>(v)));
+        }
+        set_thread_count(1);
+    }
+}
@@ -1,7 +1,9 @@
 #include "laplacian.hpp"
 
 #include "io/logging.hpp"
+#include "parallel/thread_pool.hpp"
 #include <fmt/ranges.h>
+#include <range/v3/algorithm/fill.hpp>
 #include <range/v3/view/repeat_n.hpp>
 
 namespace ccs
@@ -11,7 +13,8 @@ laplacian::laplacian(const mesh& m,
                      const stencil& st,
                      const bcs::Grid& grid_bcs,
                      const bcs::Object& obj_bcs,
-                     const logs& build_logger)
+                     const logs& build_logger,
+                     integer tile_size)
 
 {
     logs logger{build_logger, "laplacian", "laplacian.csv"};
@@ -26,29 +29,69 @@ laplacian::laplacian(const mesh& m,
     dy = derivative{1, m, st, grid_bcs, obj_bcs, logger};
     dz = derivative{2, m, st, grid_bcs, obj_bcs, logger};
     ex = m.extents();
+
+    tiles = tiling{m, {&dx, &dy, &dz}, tile_size};
+}
+
+bool laplacian::refresh(const mesh& m,
+                        const stencil& st,
+                        const bcs::Grid& grid_bcs,
+                        const bcs::Object& obj_bcs)
+{
+    // the tiles only depend on the structure so are kept
+    if (!(dx.same_structure(st) && dy.same_structure(st) && dz.same_structure(st)))
+        return false;
+
+    dx.refresh(m, st, grid_bcs, obj_bcs);
+    dy.refresh(m, st, grid_bcs, obj_bcs);
+    dz.refresh(m, st, grid_bcs, obj_bcs);
+    return true;
+}
+
+void laplacian::sweep(scalar_view u, const scalar_view* nu, scalar_span du) const
+{
+    using namespace si;
+
+    const std::array<const derivative*, 3> ds{&dx, &dy, &dz};
+
+    // tiles write disjoint rows so they may be spread across threads
+    parallel_for(tiles.bounds(), tiling::default_size, [&](integer t0, integer t1) {
+        for (integer t = t0; t < t1; t++) {
+            const integer first = tiles.first(t);
+            const integer last = tiles.last(t);
+
+            rs::fill(get<D>(du).subspan(first, last - first), 0.0);
+            for (int i = 0; i < 3; i++) {
+                if (ex[i] < 2) continue;
+                if (nu)
+                    ds[i]->interior_rows(first, last, u, *nu, du, plus_eq);
+                else
+                    ds[i]->interior_rows(first, last, u, du, plus_eq);
+            }
+
+            for (int r = 0; r < 3; r++) {
+                const auto rows = tiles.boundary_rows(r, t);
+                if (rows.empty()) continue;
+
+                auto&& out = r == 0 ? get<Rx>(du) : r == 1 ? get<Ry>(du) : get<Rz>(du);
+                for (auto row : rows) out[row] = 0;
+
+                for (int i = 0; i < 3; i++)
+                    if (ex[i] > 1) ds[i]->boundary_rows(r, rows, u, du);
+            }
+        }
+    });
 }
 
 // when there are no neumann conditions in the problem
 std::function<void(scalar_span)> laplacian::operator()(scalar_view u) const
 {
-    return [this, u](scalar_span du) {
-        du = 0;
-        // accumulate results into du * WRONG * The block matrix does not accumulate
-        if (ex[0] > 1) dx(u, du, plus_eq);
-        if (ex[1] > 1) dy(u, du, plus_eq);
-        if (ex[2] > 1) dz(u, du, plus_eq);
-    };
+    return [this, u](scalar_span du) { sweep(u, nullptr, du); };
 }
 
 std::function<void(scalar_span)> laplacian::operator()(scalar_view u,
                                                        scalar_view nu) const
 {
-    return [this, u, nu](scalar_span du) {
-        du = 0;
-        // accumulate results into du
-        if (ex[0] > 1) dx(u, nu, du, plus_eq);
-        if (ex[1] > 1) dy(u, nu, du, plus_eq);
-        if (ex[2] > 1) dz(u, nu, du, plus_eq);
-    };
+    return [this, u, nu](scalar_span du) { sweep(u, &nu, du); };
 }
 } // namespace ccs
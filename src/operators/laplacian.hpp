@@ -1,9 +1,14 @@
 #pragma once
 
 #include "derivative.hpp"
+#include "tiling.hpp"
 
 namespace ccs
 {
+// The laplacian is applied in a single sweep over the fluid domain.  All three second
+// derivatives, along with the boundary data on Rx/Ry/Rz that reads from a tile, are
+// accumulated while the tile is in cache.  Each output is accumulated in the same
+// order as applying dx, dy and dz one after another.
 class laplacian
 {
     std::shared_ptr<spdlog::logger> logger;
@@ -12,6 +17,10 @@ class laplacian
     derivative dz;
     index_extents ex;
 
+    tiling tiles;
+
+    void sweep(scalar_view, const scalar_view*, scalar_span) const;
+
 public:
     laplacian() = default;
 
@@ -19,7 +28,12 @@ public:
               const stencil&,
               const bcs::Grid&,
               const bcs::Object&,
-              const logs& logger = {});
+              const logs& logger = {},
+              integer tile_size = tiling::default_size);
+
+    // overwrite the coefficients of every direction with those of `st` keeping the
+    // structure.  See derivative::refresh
+    bool refresh(const mesh&, const stencil& st, const bcs::Grid&, const bcs::Object&);
 
     // when there are no neumann conditions in the problem
     std::function<void(scalar_span)> operator()(scalar_view) const;
@@ -9,6 +9,7 @@
 
 #include "fields/selector.hpp"
 #include "identity_stencil.hpp"
+#include "parallel/thread_pool.hpp"
 #include "random/random.hpp"
 #include "stencils/stencil.hpp"
 
@@ -369,3 +370,81 @@ TEST_CASE("2D E2 with Floating Objects")
     REQUIRE_THAT(get<si::Rx>(ex), Approx(get<si::Rx>(du)));
     REQUIRE_THAT(get<si::Ry>(ex), Approx(get<si::Ry>(du)));
 }
+
+TEST_CASE("Fused Sweep")
+{
+    using T = std::vector<real>;
+
+    sol::state lua;
+    lua.script(R"(
+        simulation = {
+            mesh = {
+                index_extents = {25, 26, 27},
+                domain_bounds = {
+                    min = {0.1, 0.2, 0.3},
+                    max = {1, 2, 2.2}
+                }
+            },
+            domain_boundaries = {
+                xmin = "dirichlet",
+                ymin = "neumann",
+                ymax = "neumann",
+                zmax = "dirichlet"
+            },
+            shapes = {
+                {
+                    type = "sphere",
+                    center = {0.45, 1.011, 1.31},
+                    radius = 0.25,
+                    boundary_condition = "floating"
+                }
+            },
+            scheme = {
+                order = 2,
+                type = "E2"
+            }
+        }
+    )");
+    auto m_opt = mesh::from_lua(lua["simulation"]);
+    REQUIRE(!!m_opt);
+    const mesh& m = *m_opt;
+
+    auto bc_opt = bcs::from_lua(lua["simulation"], m.extents());
+    REQUIRE(!!bc_opt);
+    auto&& [gridBcs, objectBcs] = *bc_opt;
+
+    auto scheme_opt = stencil::from_lua(lua["simulation"]);
+    REQUIRE(!!scheme_opt);
+    stencil st = *scheme_opt;
+
+    const auto loc = m.xyz;
+    scalar<T> u{loc | f2};
+    scalar<T> nu{loc | f2_dy};
+
+    // reference: accumulate one direction at a time
+    scalar<T> ref{m.ss()};
+    ref = 0;
+    for (int i = 0; i < 3; i++) {
+        auto d = derivative{i, m, st, gridBcs, objectBcs};
+        d(u, nu, ref, plus_eq);
+    }
+
+    // tiles smaller than, equal to and larger than an x-plane
+    for (integer tile_size :
+         {integer{100}, integer{26 * 27}, integer{2000}, tiling::default_size}) {
+        auto lap = laplacian{m, st, gridBcs, objectBcs, {}, tile_size};
+
+        for (int threads : {1, 3}) {
+            set_thread_count(threads);
+            scalar<T> du{m.ss()};
+            du = -1;
+            du = lap(u, nu);
+
+            REQUIRE(rs::equal(get<si::D>(du), get<si::D>(ref)));
+            REQUIRE(rs::equal(get<si::Rx>(du), get<si::Rx>(ref)));
+            REQUIRE(rs::equal(get<si::Ry>(du), get<si::Ry>(ref)));
+            REQUIRE(rs::equal(get<si::Rz>(du), get<si::Rz>(ref)));
+        }
+        set_thread_count(1);
+    }
+}
@@ -0,0 +1,125 @@
+#include "sparse_eigenvalue_visitor.hpp"
+#include "derivative.hpp"
+
+#include <random>
+
+#include <spdlog/spdlog.h>
+
+namespace ccs
+{
+sparse_eigenvalue_visitor::sparse_eigenvalue_visitor(const mesh& m,
+                                                     const bcs::Grid& grid_bcs,
+                                                     const bcs::Object& object_bcs,
+                                                     real scale,
+                                                     matrix::krylov_schur solver)
+    : m{&m},
+      grid_bcs{grid_bcs},
+      object_bcs{object_bcs},
+      scale{scale},
+      solver{MOVE(solver)}
+{
+}
+
+namespace
+{
+std::array<std::span<real>, 4> parts(scalar_real& s)
+{
+    using namespace si;
+    return {get<D>(s), get<Rx>(s), get<Ry>(s), get<Rz>(s)};
+}
+} // namespace
+
+void sparse_eigenvalue_visitor::visit(const derivative& d)
+{
+    auto res = mesh_operator_eigenvalues(
+        *m,
+        grid_bcs,
+        object_bcs,
+        [&d](scalar_view x, scalar_span y) { d(x, y); },
+        solver,
+        scale);
+
+    conv = res.converged;
+    eigs_real.clear();
+    eigs_imag.clear();
+    for (auto&& e : res.eigenvalues) {
+        eigs_real.push_back(e.real());
+        eigs_imag.push_back(e.imag());
+    }
+}
+
+std::span<const real> sparse_eigenvalue_visitor::eigenvalues_real() const
+{
+    return eigs_real;
+}
+
+std::span<const real> sparse_eigenvalue_visitor::eigenvalues_imag() const
+{
+    return eigs_imag;
+}
+
+matrix::krylov_schur::result
+mesh_operator_eigenvalues(const mesh& m,
+                          const bcs::Grid& grid_bcs,
+                          const bcs::Object& object_bcs,
+                          const std::function<void(scalar_view, scalar_span)>& op,
+                          const matrix::krylov_schur& solver,
+                          real scale)
+{
+    // `active` is zero for the points without an equation and `scale` otherwise
+    scalar_real x{m.ss()}, y{m.ss()};
+    x = 0;
+    x | m.fluid_all(object_bcs) = scale;
+    x | m.dirichlet(grid_bcs, object_bcs) = 0;
+
+    integer n = 0;
+    for (auto p : parts(x)) n += p.size();
+
+    std::vector<real> active(n);
+    for (integer i = 0; auto p : parts(x))
+        for (auto v : p) active[i++] = v;
+
+    // flattened vectors are copied in and out of x and y in D, Rx, Ry, Rz order
+    auto A = [&](std::span<const real> in, std::span<real> out) {
+        for (integer i = 0; auto p : parts(x))
+            for (auto& v : p) v = in[i++];
+
+        y = 0;
+        op(x, y);
+
+        for (integer i = 0; auto p : parts(y))
+            for (auto v : p) {
+                out[i] = active[i] * v;
+                ++i;
+            }
+    };
+
+    // fixed seed so the result is reproducible
+    std::minstd_rand urng{};
+    std::uniform_real_distribution<real> dist{-1.0, 1.0};
+    std::vector<real> v0(n);
+    for (integer i = 0; i < n; i++) v0[i] = active[i] != 0.0 ? dist(urng) : 0.0;
+
+    return solver(n, A, v0);
+}
+
+std::vector<std::complex<real>>
+dominant_eigenvalues(const mesh& m,
+                     const bcs::Grid& grid_bcs,
+                     const bcs::Object& object_bcs,
+                     const std::function<void(scalar_view, scalar_span)>& op)
+{
+    // the extreme eigenvalues converge first so a few restarts of a small basis give
+    // the spectral radius to a few digits
+    const auto solver = matrix::krylov_schur{
+        6, 24, 1e-4, 30, matrix::krylov_schur::order::largest_magnitude};
+
+    auto res = mesh_operator_eigenvalues(m, grid_bcs, object_bcs, op, solver);
+    if (!res.converged) {
+        spdlog::warn("dominant eigenvalues did not converge after {} restarts",
+                     res.restarts);
+        return {};
+    }
+    return MOVE(res.eigenvalues);
+}
+} // namespace ccs
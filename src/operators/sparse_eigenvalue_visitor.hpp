@@ -0,0 +1,65 @@
+#pragma once
+
+#include "boundaries.hpp"
+#include "fields/scalar.hpp"
+#include "matrices/krylov_schur.hpp"
+#include "mesh/mesh.hpp"
+#include "operator_visitor.hpp"
+
+#include <functional>
+
+namespace ccs
+{
+// Eigenvalues with the largest real part of `scale` times a derivative operator.  The
+// matrix is never formed: the derivative is applied through its block and csr operators
+// inside a Krylov-Schur iteration.  The unknowns are the fluid points and the boundary
+// points without dirichlet conditions, the rest are held at zero.  Unlike the
+// eigenvalue_visitor any number of dimensions may be used.
+class sparse_eigenvalue_visitor : public operator_visitor
+{
+    const mesh* m = nullptr;
+    bcs::Grid grid_bcs;
+    bcs::Object object_bcs;
+    real scale = 1.0;
+    matrix::krylov_schur solver;
+
+    std::vector<real> eigs_real, eigs_imag;
+    bool conv = false;
+
+public:
+    sparse_eigenvalue_visitor() = default;
+
+    sparse_eigenvalue_visitor(const mesh&,
+                              const bcs::Grid&,
+                              const bcs::Object&,
+                              real scale = 1.0,
+                              matrix::krylov_schur = {});
+
+    void visit(const derivative&) override;
+
+    // sorted by decreasing real part
+    std::span<const real> eigenvalues_real() const;
+    std::span<const real> eigenvalues_imag() const;
+
+    bool converged() const { return conv; }
+};
+
+// Eigenvalues of `scale` times any linear operator on the scalars of the mesh using the
+// same unknowns as the visitor.  `op` computes y = A x with y zero on entry
+matrix::krylov_schur::result
+mesh_operator_eigenvalues(const mesh&,
+                          const bcs::Grid&,
+                          const bcs::Object&,
+                          const std::function<void(scalar_view, scalar_span)>& op,
+                          const matrix::krylov_schur&,
+                          real scale = 1.0);
+
+// A few eigenvalues of largest magnitude of `op`, accurate enough to bound the stable
+// step size of an explicit time integrator.  Uses a small basis and a loose tolerance,
+// and is empty if even that does not converge
+std::vector<std::complex<real>>
+dominant_eigenvalues(const mesh&,
+                     const bcs::Grid&,
+                     const bcs::Object&,
+                     const std::function<void(scalar_view, scalar_span)>& op);
+} // namespace ccs
@@ -0,0 +1,83 @@
+#include "sparse_eigenvalue_visitor.hpp"
+#include "derivative.hpp"
+#include "eigenvalue_visitor.hpp"
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "fields/tuple_utils.hpp"
+#include "identity_stencil.hpp"
+#include "stencils/stencil.hpp"
+
+#include <range/v3/algorithm/max.hpp>
+#include <range/v3/algorithm/min.hpp>
+
+using namespace ccs;
+using B = std::vector<bool>;
+
+const std::vector<real> alpha{
+    -1.47956280234494, 0.261900367793859, -0.145072532538541, -0.224665713988644};
+
+TEST_CASE("identity")
+{
+    auto m = mesh{index_extents{int3{11, 12, 1}},
+                  domain_extents{.min = {0, 0, 0}, .max = {1, 1, 1}}};
+    const auto gridBcs = bcs::Grid{bcs::df, bcs::ff, bcs::ff};
+    const auto objectBcs = bcs::Object{};
+
+    auto dx = derivative{0, m, stencils::identity, gridBcs, objectBcs};
+
+    auto v = sparse_eigenvalue_visitor{m, gridBcs, objectBcs, 1.0, {2}};
+    v.visit(dx);
+
+    REQUIRE(v.converged());
+    REQUIRE(v.eigenvalues_real().size() > 0u);
+    REQUIRE(v.eigenvalues_real()[0] == Catch::Approx(1.0));
+}
+
+TEST_CASE("dense 1d")
+{
+    auto m = mesh{index_extents{int3{41, 1, 1}},
+                  domain_extents{.min = {0, 0, 0}, .max = {1, 1, 1}}};
+    const auto gridBcs = bcs::Grid{bcs::df, bcs::ff, bcs::ff};
+    const auto objectBcs = bcs::Object{};
+    const auto st = stencils::make_E2_1(alpha);
+
+    auto dx = derivative{0, m, st, gridBcs, objectBcs};
+
+    auto dense = eigenvalue_visitor{m.extents(), B{}, B{}, B{}};
+    dense.visit(dx);
+
+    // the rightmost eigenvalue of -D is the leftmost of D
+    auto sparse = sparse_eigenvalue_visitor{m, gridBcs, objectBcs, -1.0, {3}};
+    sparse.visit(dx);
+
+    REQUIRE(sparse.converged());
+    REQUIRE(sparse.eigenvalues_real()[0] ==
+            Catch::Approx(-rs::min(dense.eigenvalues_real())));
+}
+
+TEST_CASE("2d lines")
+{
+    // every x-line of the 2d mesh matches the 1d mesh so the spectra agree
+    const auto gridBcs = bcs::Grid{bcs::df, bcs::ff, bcs::ff};
+    const auto objectBcs = bcs::Object{};
+    const auto st = stencils::make_E2_1(alpha);
+
+    auto m1 = mesh{index_extents{int3{41, 1, 1}},
+                   domain_extents{.min = {0, 0, 0}, .max = {1, 1, 1}}};
+    auto m2 = mesh{index_extents{int3{41, 9, 1}},
+                   domain_extents{.min = {0, 0, 0}, .max = {1, 1, 1}}};
+
+    auto d1 = derivative{0, m1, st, gridBcs, objectBcs};
+    auto d2 = derivative{0, m2, st, gridBcs, objectBcs};
+
+    auto v1 = sparse_eigenvalue_visitor{m1, gridBcs, objectBcs, -1.0, {1}};
+    auto v2 = sparse_eigenvalue_visitor{m2, gridBcs, objectBcs, -1.0, {1, 60}};
+    v1.visit(d1);
+    v2.visit(d2);
+
+    REQUIRE(v1.converged());
+    REQUIRE(v2.converged());
+    REQUIRE(v2.eigenvalues_real()[0] == Catch::Approx(v1.eigenvalues_real()[0]));
+}
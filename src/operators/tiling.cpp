@@ -0,0 +1,37 @@
+#include "tiling.hpp"
+
+#include <algorithm>
+
+namespace ccs
+{
+
+tiling::tiling(const mesh& m,
+               const std::array<const derivative*, 3>& ds,
+               integer tile_size)
+{
+    const auto ex = m.extents();
+    const integer plane = ex[1] * ex[2];
+    const integer unit = plane <= tile_size ? plane : ex[2];
+    const integer rows = std::max(unit, tile_size / unit * unit);
+
+    for (integer first = 0; first < m.size(); first += rows) tiles.push_back(first);
+    tiles.push_back(m.size());
+
+    for (int r = 0; r < 3; r++) {
+        std::vector<std::vector<integer>> by_tile(size());
+
+        for (integer row = 0; row < (integer)m.R(r).size(); row++) {
+            integer reach = -1;
+            for (auto d : ds) reach = std::max(reach, d->boundary_reach(r, row));
+            by_tile[reach < 0 ? 0 : reach / rows].push_back(row);
+        }
+
+        boundary_tiles[r].push_back(0);
+        for (auto&& t : by_tile) {
+            boundary[r].insert(boundary[r].end(), t.begin(), t.end());
+            boundary_tiles[r].push_back(boundary[r].size());
+        }
+    }
+}
+
+} // namespace ccs
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "derivative.hpp"
+
+#include <array>
+
+namespace ccs
+{
+// Cuts the fluid domain into tiles of consecutive rows so operators built from several
+// derivatives can be applied in one sweep, finishing each tile while it is in cache.
+// Tiles hold whole x-planes so no y or z line is split; planes too large for a tile are
+// split along whole z-lines instead.  Each row of the boundary data on Rx/Ry/Rz is
+// computed with the tile holding the last fluid point it reads.
+class tiling
+{
+    // tile t covers rows [tiles[t], tiles[t + 1]) of the fluid domain
+    std::vector<integer> tiles;
+    // rows of R{r} grouped by tile.  Those of tile t are
+    // [boundary_tiles[r][t], boundary_tiles[r][t + 1])
+    std::array<std::vector<integer>, 3> boundary;
+    std::array<std::vector<integer>, 3> boundary_tiles;
+
+public:
+    // about 128KB of a field per tile
+    static constexpr integer default_size = 1 << 14;
+
+    tiling() = default;
+
+    tiling(const mesh&,
+           const std::array<const derivative*, 3>&,
+           integer tile_size = default_size);
+
+    integer size() const { return tiles.size() ? tiles.size() - 1 : 0; }
+
+    // running count of rows for splitting tiles across threads
+    std::span<const integer> bounds() const { return tiles; }
+
+    integer first(integer t) const { return tiles[t]; }
+    integer last(integer t) const { return tiles[t + 1]; }
+
+    std::span<const integer> boundary_rows(int r, integer t) const
+    {
+        const auto& b = boundary_tiles[r];
+        return std::span(boundary[r]).subspan(b[t], b[t + 1] - b[t]);
+    }
+};
+} // namespace ccs
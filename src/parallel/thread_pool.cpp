@@ -0,0 +1,108 @@
+#include "thread_pool.hpp"
+
+#include <atomic>
+#include <memory>
+
+namespace ccs
+{
+
+namespace
+{
+// set on pool workers and on callers while they wait for their tasks
+thread_local bool inside_pool = false;
+
+std::unique_ptr<thread_pool>& global_pool()
+{
+    static auto pool = std::make_unique<thread_pool>();
+    return pool;
+}
+} // namespace
+
+thread_pool::thread_pool(int threads)
+{
+    for (int i = 1; i < threads; i++) workers.emplace_back([this] { work(); });
+}
+
+thread_pool::~thread_pool()
+{
+    {
+        std::scoped_lock lock{m};
+        stop = true;
+    }
+    work_cv.notify_all();
+    for (auto&& w : workers) w.join();
+}
+
+void thread_pool::work()
+{
+    inside_pool = true;
+
+    while (true) {
+        std::function<void()> task;
+        {
+            std::unique_lock lock{m};
+            work_cv.wait(lock, [this] { return stop || !tasks.empty(); });
+            if (stop && tasks.empty()) return;
+            task = MOVE(tasks.front());
+            tasks.pop_front();
+        }
+        task();
+    }
+}
+
+void thread_pool::run(integer n, const std::function<void(integer)>& f)
+{
+    if (n <= 0) return;
+
+    if (n == 1 || workers.empty() || inside_pool) {
+        for (integer i = 0; i < n; i++) f(i);
+        return;
+    }
+
+    std::atomic<integer> remaining{n - 1};
+
+    {
+        std::scoped_lock lock{m};
+        for (integer i = 1; i < n; i++)
+            tasks.emplace_back([this, &f, &remaining, i] {
+                f(i);
+                if (--remaining == 0) {
+                    // lock so the waiting caller cannot miss the notification
+                    std::scoped_lock lock{m};
+                    done_cv.notify_all();
+                }
+            });
+    }
+    work_cv.notify_all();
+
+    inside_pool = true;
+    f(0);
+
+    // help with queued work rather than idling until the workers finish our tasks
+    std::unique_lock lock{m};
+    while (remaining > 0) {
+        if (tasks.empty()) {
+            done_cv.wait(lock, [&] { return remaining == 0 || !tasks.empty(); });
+            continue;
+        }
+        auto task = MOVE(tasks.front());
+        tasks.pop_front();
+        lock.unlock();
+        task();
+        lock.lock();
+    }
+    inside_pool = false;
+}
+
+thread_pool& default_pool() { return *global_pool(); }
+
+void set_thread_count(int threads)
+{
+    threads = std::max(threads, 1);
+    if (auto& pool = global_pool(); pool->size() != threads)
+        pool = std::make_unique<thread_pool>(threads);
+}
+
+int thread_count() { return default_pool().size(); }
+
+} // namespace ccs
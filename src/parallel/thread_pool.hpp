@@ -0,0 +1,96 @@
+#pragma once
+
+#include "types.hpp"
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ccs
+{
+// Fixed size pool of worker threads.  The calling thread takes part in the work so a
+// pool of size n only spawns n - 1 threads.  Calls made from within a task run inline
+// so nested parallel regions never oversubscribe the machine or deadlock.
+class thread_pool
+{
+    std::vector<std::thread> workers;
+    std::deque<std::function<void()>> tasks;
+    std::mutex m;
+    std::condition_variable work_cv;
+    std::condition_variable done_cv;
+    bool stop = false;
+
+    void work();
+
+public:
+    explicit thread_pool(int threads = 1);
+    ~thread_pool();
+
+    thread_pool(const thread_pool&) = delete;
+    thread_pool& operator=(const thread_pool&) = delete;
+
+    int size() const { return (int)workers.size() + 1; }
+
+    // call f(i) for i in [0, n) and wait for all of them to finish
+    void run(integer n, const std::function<void(integer)>& f);
+};
+
+// Process wide pool used by the matrix operators and field assignment.  Defaults to a
+// single thread and should only be resized while no operators or assignments are running
+thread_pool& default_pool();
+void set_thread_count(int threads);
+int thread_count();
+
+// Split [0, n) into contiguous ranges of roughly equal work and call f(first, last) for
+// each on the default pool.  prefix[i] is the total work of items [0, i) and has size
+// n + 1.  No range is given less than min_work unless the total is smaller.  The split
+// only depends on the thread count so results are reproducible
+template <typename F>
+void parallel_for(std::span<const integer> prefix, integer min_work, F&& f)
+{
+    if (prefix.size() < 2) return;
+    const integer n = prefix.size() - 1;
+    const integer total = prefix.back() - prefix.front();
+    const integer chunks = std::clamp<integer>(
+        total / std::max<integer>(min_work, 1), 1, std::min<integer>(thread_count(), n));
+
+    if (chunks == 1) {
+        f(integer{0}, n);
+        return;
+    }
+
+    auto bound = [&](integer c) -> integer {
+        if (c == chunks) return n;
+        const integer target = prefix.front() + total * c / chunks;
+        return std::ranges::lower_bound(prefix, target) - prefix.begin();
+    };
+
+    default_pool().run(chunks, [&](integer c) {
+        const integer first = bound(c);
+        const integer last = bound(c + 1);
+        if (first < last) f(first, last);
+    });
+}
+
+// uniform work version of the above
+template <typename F>
+void parallel_for(integer n, integer min_items, F&& f)
+{
+    if (n <= 0) return;
+    const integer chunks = std::clamp<integer>(
+        n / std::max<integer>(min_items, 1), 1, std::min<integer>(thread_count(), n));
+
+    if (chunks == 1) {
+        f(integer{0}, n);
+        return;
+    }
+
+    default_pool().run(chunks,
+                       [&](integer c) { f(n * c / chunks, n * (c + 1) / chunks); });
+}
+
+} // namespace ccs
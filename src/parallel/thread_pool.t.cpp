@@ -0,0 +1,75 @@
+#include "thread_pool.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <atomic>
+#include <numeric>
+#include <vector>
+
+using namespace ccs;
+
+TEST_CASE("run")
+{
+    thread_pool pool{4};
+    REQUIRE(pool.size() == 4);
+
+    std::vector<int> hits(1000);
+    pool.run(hits.size(), [&](integer i) { ++hits[i]; });
+
+    REQUIRE(std::ranges::all_of(hits, [](int h) { return h == 1; }));
+}
+
+TEST_CASE("nested")
+{
+    thread_pool pool{3};
+
+    std::atomic<int> count{};
+    pool.run(5, [&](integer) { pool.run(7, [&](integer) { ++count; }); });
+
+    REQUIRE(count == 35);
+}
+
+TEST_CASE("parallel_for uniform")
+{
+    for (int threads : {1, 2, 5}) {
+        set_thread_count(threads);
+        REQUIRE(thread_count() == threads);
+
+        for (integer n : {0, 1, 3, 17, 1000}) {
+            std::vector<int> hits(n);
+            parallel_for(n, 1, [&](integer first, integer last) {
+                for (integer i = first; i < last; i++) ++hits[i];
+            });
+            REQUIRE(std::ranges::all_of(hits, [](int h) { return h == 1; }));
+        }
+    }
+    set_thread_count(1);
+}
+
+TEST_CASE("parallel_for weighted")
+{
+    // one heavy item followed by many light ones
+    std::vector<integer> work(101, 1);
+    work[0] = 500;
+    std::vector<integer> prefix(work.size() + 1);
+    std::partial_sum(work.begin(), work.end(), prefix.begin() + 1);
+
+    for (int threads : {1, 2, 4}) {
+        set_thread_count(threads);
+
+        std::vector<int> hits(work.size());
+        std::atomic<int> ranges{};
+        parallel_for(prefix, 1, [&](integer first, integer last) {
+            ++ranges;
+            for (integer i = first; i < last; i++) ++hits[i];
+        });
+        REQUIRE(std::ranges::all_of(hits, [](int h) { return h == 1; }));
+        REQUIRE(ranges <= threads);
+
+        // too little work to split
+        ranges = 0;
+        parallel_for(prefix, prefix.back(), [&](integer, integer) { ++ranges; });
+        REQUIRE(ranges == 1);
+    }
+    set_thread_count(1);
+}
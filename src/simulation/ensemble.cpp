@@ -0,0 +1,141 @@
+#include "ensemble.hpp"
+
+#include "mesh/mesh.hpp"
+#include "parallel/thread_pool.hpp"
+
+#include <sol/sol.hpp>
+
+#include <fmt/core.h>
+
+#include <algorithm>
+#include <cctype>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+
+using namespace std::string_literals;
+
+namespace ccs
+{
+
+namespace fs = std::filesystem;
+
+ensemble::ensemble(std::vector<simulation_cycle>&& cycles,
+                   std::string results_file,
+                   bool concurrent,
+                   const logs& build_logger)
+    : cycles{MOVE(cycles)},
+      results_file{MOVE(results_file)},
+      concurrent{concurrent},
+      logger{build_logger, "ensemble"}
+{
+}
+
+std::vector<real3> ensemble::run()
+{
+    logger(spdlog::level::info,
+           "running {} candidates {}",
+           cycles.size(),
+           concurrent ? "concurrently" : "one at a time");
+
+    std::vector<real3> results(cycles.size());
+    auto f = [&](integer i) { results[i] = cycles[i].run(); };
+
+    // the operators of a candidate run serially within their pool task
+    if (concurrent)
+        default_pool().run(cycles.size(), f);
+    else
+        for (integer i = 0; i < size(); i++) f(i);
+
+    std::ofstream o{results_file};
+    o << "candidate,s0,s1,s2\n";
+    for (integer i = 0; i < size(); i++) {
+        auto&& [a, b, c] = results[i];
+        o << fmt::format("{},{},{},{}\n", i + 1, a, b, c);
+    }
+    logger(spdlog::level::info, "wrote ensemble results to {}", results_file);
+
+    return results;
+}
+
+namespace
+{
+sol::table shallow_copy(sol::state_view lua, const sol::table& tbl)
+{
+    auto t = lua.create_table();
+    for (auto&& [k, v] : tbl) t.set(k, v);
+    return t;
+}
+} // namespace
+
+std::optional<ensemble> ensemble::from_lua(const sol::table& tbl)
+{
+    bool enable_logging = tbl["logging"].get_or(true);
+    std::string logging_dir = enable_logging ? tbl["logging_dir"].get_or("logs"s) : ""s;
+    logs l{logging_dir, enable_logging, "ensemble_builder"};
+
+    sol::optional<sol::table> candidates = tbl["ensemble"];
+    if (!candidates) {
+        l(spdlog::level::err, "simulation.ensemble must be a list of scheme tables");
+        return std::nullopt;
+    }
+
+    // ray casting the objects is the expensive part of building a mesh so only do it once
+    auto mesh_opt = mesh::from_lua(tbl, l);
+    if (!mesh_opt) return std::nullopt;
+
+    sol::state_view lua{tbl.lua_state()};
+    sol::optional<sol::table> io = tbl["io"];
+    std::string io_dir = io ? (*io)["dir"].get_or("io"s) : "io"s;
+
+    std::vector<simulation_cycle> cycles;
+    for (int i = 1; (*candidates)[i].valid(); i++) {
+        auto t = shallow_copy(lua, tbl);
+        t["ensemble"] = sol::lua_nil;
+        t["scheme"] = (*candidates)[i];
+
+        // keep the candidates from overwriting each other's logs and output
+        const auto sub = fmt::format("candidate_{}", i);
+        if (enable_logging) t["logging_dir"] = (fs::path{logging_dir} / sub).string();
+        if (io) {
+            auto io_t = shallow_copy(lua, *io);
+            io_t["dir"] = (fs::path{io_dir} / sub).string();
+            t["io"] = io_t;
+        }
+
+        auto cycle = simulation_cycle::from_lua(t, *mesh_opt);
+        if (!cycle) {
+            l(spdlog::level::err, "failed to build ensemble candidate {}", i);
+            return std::nullopt;
+        }
+        cycles.push_back(MOVE(*cycle));
+    }
+
+    if (cycles.empty()) {
+        l(spdlog::level::err, "simulation.ensemble has no scheme tables");
+        return std::nullopt;
+    }
+
+    std::string ms_type = tbl["manufactured_solution"]["type"].get_or(""s);
+    std::ranges::transform(ms_type, ms_type.begin(), [](unsigned char c) {
+        return std::tolower(c);
+    });
+    const bool concurrent = ms_type != "lua";
+    if (!concurrent)
+        l(spdlog::level::info,
+          "lua manufactured solutions are not thread safe.  Running candidates "
+          "one at a time");
+
+    // Each candidate sets the pool size while it is built.  The candidates are the
+    // parallel work here, so unless `threads` is given use every core
+    int threads = tbl["threads"].get_or(0);
+    if (threads <= 0) threads = std::max<int>(std::thread::hardware_concurrency(), 1);
+    set_thread_count(threads);
+    l(spdlog::level::info, "using {} thread(s)", threads);
+
+    std::string results = (*candidates)["results"].get_or("ensemble.csv"s);
+
+    return ensemble{MOVE(cycles), MOVE(results), concurrent, l};
+}
+
+} // namespace ccs
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "types.hpp"
+
+#include "simulation_cycle.hpp"
+
+#include <sol/forward.hpp>
+
+#include <string>
+#include <vector>
+
+namespace ccs
+{
+// A set of simulations that only differ in their scheme, as when sweeping the
+// parameters of a stencil.  The simulation table gains a list of scheme tables:
+//
+//   ensemble = { results = "ensemble.csv", {scheme 1}, {scheme 2}, ... }
+//
+// The mesh is built once and copied to each candidate.  Every candidate has its own
+// stencil, operators, logs and output directory, and the candidates run concurrently on
+// the default thread pool, which uses every core unless `threads` is set.  The summary
+// of each is written to the results file
+class ensemble
+{
+    std::vector<simulation_cycle> cycles;
+    std::string results_file;
+    // lua is not thread safe so candidates calling into it must run one at a time
+    bool concurrent;
+    logs logger;
+
+public:
+    ensemble() = default;
+
+    ensemble(std::vector<simulation_cycle>&& cycles,
+             std::string results_file,
+             bool concurrent,
+             const logs& = {});
+
+    integer size() const { return cycles.size(); }
+
+    std::vector<real3> run();
+
+    static std::optional<ensemble> from_lua(const sol::table&);
+};
+} // namespace ccs
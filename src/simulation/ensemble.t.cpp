@@ -0,0 +1,92 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <sol/sol.hpp>
+
+#include "ensemble.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+using namespace ccs;
+
+TEST_CASE("ensemble")
+{
+    sol::state lua;
+    lua.open_libraries(sol::lib::base, sol::lib::math);
+    lua.script(R"(
+        simulation = {
+            logging = false,
+            threads = 2,
+            mesh = {
+                index_extents = {21, 22},
+                domain_bounds = {
+                    min = {1, 1.1},
+                    max = {3, 3.3}
+                }
+            },
+            domain_boundaries = {
+                xmin = "dirichlet",
+                ymin = "neumann",
+                ymax = "neumann",
+            },
+            shapes = {
+                {
+                    type = "sphere",
+                    center = {2.0001, 2.5656565},
+                    radius = 0.25,
+                    boundary_condition = "floating"
+                }
+            },
+            scheme = {
+                order = 2,
+                type = "E2"
+            },
+            system = {
+                type = "heat",
+                diffusivity = 1.0
+            },
+            integrator = {
+                type = "rk4",
+            },
+            step_controller = {
+                max_step = 5,
+            },
+            manufactured_solution = {
+                type = "gaussian",
+                {
+                    center = {1.5, 2},
+                    variance = {0.5, 0.8},
+                    amplitude = 1,
+                    frequency = 1
+                }
+            }
+        }
+
+        simulation.ensemble = {
+            results = "ensemble_test.csv",
+            { order = 2, type = "E2" },
+            { order = 2, type = "E2" }
+        }
+    )");
+
+    auto e = ensemble::from_lua(lua["simulation"]);
+    REQUIRE(!!e);
+    REQUIRE(e->size() == 2);
+
+    auto res = e->run();
+    REQUIRE(res.size() == 2);
+
+    // concurrent candidates give the same result as a standalone run
+    REQUIRE(res[0] == res[1]);
+
+    auto cycle = simulation_cycle::from_lua(lua["simulation"]);
+    REQUIRE(!!cycle);
+    REQUIRE(cycle->run() == res[0]);
+
+    std::ifstream f{"ensemble_test.csv"};
+    REQUIRE(f);
+    int lines = 0;
+    for (std::string l; std::getline(f, l);) ++lines;
+    REQUIRE(lines == 3);
+}
@@ -1,8 +1,10 @@
 #include "simulation_cycle.hpp"
 
 #include "io/logging.hpp"
+#include "parallel/thread_pool.hpp"
 #include <sol/sol.hpp>
 
+#include <cmath>
 #include <iostream>
 #include <string>
 
@@ -26,15 +28,34 @@ simulation_cycle::simulation_cycle(system&& sys,
 
 real3 simulation_cycle::run()
 {
+    if (controller.spectral_timestep() && !controller.stable_timestep()) {
+        const auto eigs = sys.dominant_eigenvalues();
+        const real dt = integrate.max_stable_step(eigs);
+        // a zero step, e.g. euler with purely imaginary eigenvalues, is no estimate
+        if (!eigs.empty() && std::isfinite(dt) && dt > 0) {
+            controller.set_stable_timestep(dt);
+            logger(spdlog::level::info,
+                   "spectral radius {} gives a stable timestep of {}, using {}",
+                   std::abs(eigs.front()),
+                   dt,
+                   *controller.stable_timestep());
+        } else {
+            logger(spdlog::level::warn,
+                   "no stable timestep from the spectrum, using the cfl estimate");
+        }
+    }
+
     logger(spdlog::level::info, "begin time stepping");
     // a non-zero time would typically correspond to some kind of restart
     // functionality
     field u0{sys(controller)};
-    field u1{u0};
+    // integrators which update the solution in place do not need a second copy
+    field u1{integrate.in_place() ? field{} : u0};
+    field& next = integrate.in_place() ? u0 : u1;
 
     sys.update_boundary(u0, controller);
 
-    system_stats stats = sys.stats(u0, u1, controller);
+    system_stats stats = sys.stats(u0, next, controller);
 
     sys.log(stats, controller);
 
@@ -46,16 +67,27 @@ real3 simulation_cycle::run()
         const std::optional<real> dt = sys.timestep_size(u0, controller);
         if (!dt) {
             logger(spdlog::level::info, "required timestep too small");
+            io.flush();
             return {null_v<real>}; //{huge<double>, time};
         }
-        u1 = integrate(sys, u0, controller, *dt);
+        next = integrate(sys, u0, controller, *dt);
+
+        // integrators with an error estimate let the controller reject the step, which
+        // is then retried from u0 with a smaller timestep
+        if (auto err = integrate.error_estimate();
+            err && !controller.accept(*err, *dt, integrate.error_order())) {
+            logger(spdlog::level::info, "rejected dt={} with error {}", *dt, *err);
+            // the attempt left the boundary data at its end time
+            sys.update_boundary(u0, controller);
+            continue;
+        }
 
-        // update time and step to reflect u1 data
+        // update time and step to reflect the new data
         controller.advance(*dt);
 
         // compute statistics and handle io
-        stats = sys.stats(u0, u1, controller);
-        sys.write(io, u1, controller, *dt);
+        stats = sys.stats(u0, next, controller);
+        sys.write(io, next, controller, *dt);
         sys.log(stats, controller);
 
         logger(spdlog::level::info,
@@ -65,10 +97,15 @@ real3 simulation_cycle::run()
                *dt,
                stats.stats[0]);
         // prepare for next iteration to overwrite u0
-        using std::swap;
-        swap(u0, u1);
+        if (&next != &u0) {
+            using std::swap;
+            swap(u0, u1);
+        }
     }
 
+    // the dumps may still be in flight
+    io.flush();
+
     // only return Linf if system ends in a valid state
     if (controller) {
         logger(spdlog::level::info,
@@ -82,22 +119,43 @@ real3 simulation_cycle::run()
     }
 }
 
-std::optional<simulation_cycle> simulation_cycle::from_lua(const sol::table& tbl)
+namespace
+{
+template <typename... M>
+std::optional<simulation_cycle> build(const sol::table& tbl, const M&... m)
 {
     bool enable_logging = tbl["logging"].get_or(true);
     std::string logging_dir = enable_logging ? tbl["logging_dir"].get_or("logs"s) : ""s;
     logs l{logging_dir, enable_logging, "builder"};
 
-    auto sys_opt = system::from_lua(tbl, l);
+    // threads used for applying operators.  A non-positive count uses every core
+    int threads = tbl["threads"].get_or(1);
+    if (threads <= 0) threads = std::max<int>(std::thread::hardware_concurrency(), 1);
+    set_thread_count(threads);
+    l(spdlog::level::info, "using {} thread(s)", threads);
+
+    auto sys_opt = system::from_lua(tbl, m..., l);
     auto it_opt = integrator::from_lua(tbl, l);
     auto st_opt = step_controller::from_lua(tbl, l);
     auto io_opt = field_io::from_lua(tbl, l);
 
-    if (sys_opt && it_opt && st_opt && io_opt) {
+    if (sys_opt && it_opt && st_opt && io_opt && it_opt->prepare(*sys_opt, l)) {
         return simulation_cycle{
             MOVE(*sys_opt), MOVE(*st_opt), MOVE(*it_opt), MOVE(*io_opt), l};
     } else {
         return std::nullopt;
     }
 }
+} // namespace
+
+std::optional<simulation_cycle> simulation_cycle::from_lua(const sol::table& tbl)
+{
+    return build(tbl);
+}
+
+std::optional<simulation_cycle> simulation_cycle::from_lua(const sol::table& tbl,
+                                                           const mesh& m)
+{
+    return build(tbl, m);
+}
 } // namespace ccs
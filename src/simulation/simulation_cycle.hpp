@@ -30,6 +30,9 @@ public:
 
     static std::optional<simulation_cycle> from_lua(const sol::table&);
 
+    // build the system on a copy of `m` rather than the mesh described by the table
+    static std::optional<simulation_cycle> from_lua(const sol::table&, const mesh& m);
+
     real3 run();
 };
 } // namespace ccs
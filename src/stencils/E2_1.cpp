@@ -1,3 +1,4 @@
+#include "dual.hpp"
 #include "stencil.hpp"
 
 #include <range/v3/algorithm/copy.hpp>
@@ -127,402 +128,439 @@ struct E2_1 {
         }
     }
 
+    int parameters() const { return alpha.size(); }
+
+    // derivatives of the nbs coefficients with respect to alpha[k]
+    std::span<const real> nbs_derivative(int k,
+                                         real h,
+                                         bcs::type b,
+                                         real psi,
+                                         bool right,
+                                         std::span<real> c,
+                                         std::span<real>) const
+    {
+        const auto a = seed(alpha, k);
+        std::array<dual, R * T> work;
+        auto d = std::span<dual>(work);
+
+        switch (b) {
+        case bcs::Floating:
+            return derivatives(nbs_floating(a, h, psi, d, right), c);
+        case bcs::Dirichlet:
+            return derivatives(
+                nbs_dirichlet(a, h, psi, d.subspan(0, (R - 1) * T), right), c);
+        default:
+            return c;
+        }
+    }
+
+    // the coefficients are written for a generic value type so they can be evaluated
+    // with duals by nbs_derivative
     std::span<const real>
     nbs_floating(real h, real psi, std::span<real> c, bool right) const
     {
-        double t3 = alpha[0];
-        double t5 = alpha[2];
-        double t17 = -1 + psi;
-        double t11 = -psi;
-        double t22 = alpha[1];
-        double t9 = 2 * t5;
-        double t24 = alpha[3];
-        double t28 = 1 + psi;
-        double t29 = std::pow(t28, -1);
-        double t12 = -2 * t3;
-        double t36 = std::pow(psi, 2);
-        double t14 = -3 * t5;
-        double t18 = -(t17 * t3);
-        double t21 = -(t17 * t5);
-        double t53 = -6 * t3;
-        double t54 = -3 * t22;
-        double t55 = 5 * t22 * t3;
-        double t56 = -14 * t5;
-        double t57 = 10 * t22 * t5;
-        double t58 = -9 * t24;
-        double t59 = 15 * t24 * t3;
-        double t60 = 30 * t24 * t5;
-        double t61 = 4 + t53 + t54 + t55 + t56 + t57 + t58 + t59 + t60;
-        double t62 = std::pow(t61, -1);
-        double t37 = -t36;
-        double t73 = std::pow(t22, 2);
-        double t44 = 2 * t24 * t36;
-        double t100 = std::pow(t24, 2);
-        double t49 = 3 * t3;
-        double t50 = -1 + t49 + t9;
-        double t51 = 2 * t24;
-        double t52 = -1 + t22 + t51;
-        double t13 = 3 * psi * t3;
-        double t153 = std::pow(psi, 3);
-        double t161 = std::pow(t3, 2);
-        double t159 = std::pow(psi, 4);
-        double t167 = std::pow(t3, 3);
-        double t208 = std::pow(t22, 3);
-        double t266 = std::pow(t5, 2);
-        double t298 = std::pow(t5, 3);
-        double t491 = std::pow(t24, 3);
-        double t222 = -6 * t159 * t5;
-        double t237 = 6 * t159 * t22 * t5;
-        double t292 = -960 * psi * t266 * t3 * t73;
-        double t394 = -1920 * t24 * t3 * t36 * t5 * t73;
-        double t483 = 2160 * t100 * t153 * t266 * t3;
-        double t494 = -432 * t153 * t491;
-        double t508 = -4320 * t266 * t36 * t491;
-        double t151 = -27 * psi;
-        double t152 = 11 * t36;
-        double t154 = 6 * t153;
-        double t155 = 128 * t3;
-        double t156 = 36 * psi * t3;
-        double t157 = -31 * t3 * t36;
-        double t158 = -11 * t153 * t3;
-        double t160 = -2 * t159 * t3;
-        double t162 = -168 * t161;
-        double t163 = 71 * psi * t161;
-        double t164 = -3 * t161 * t36;
-        double t165 = 14 * t153 * t161;
-        double t166 = 8 * t159 * t161;
-        double t168 = 72 * t167;
-        double t169 = -96 * psi * t167;
-        double t170 = 39 * t167 * t36;
-        double t171 = -9 * t153 * t167;
-        double t172 = -6 * t159 * t167;
-        double t173 = 48 * t22;
-        double t174 = 102 * psi * t22;
-        double t175 = -48 * t22 * t36;
-        double t176 = -32 * t153 * t22;
-        double t177 = -200 * t22 * t3;
-        double t178 = -239 * psi * t22 * t3;
-        double t179 = 180 * t22 * t3 * t36;
-        double t180 = 57 * t153 * t22 * t3;
-        double t181 = 2 * t159 * t22 * t3;
-        double t182 = 272 * t161 * t22;
-        double t183 = 14 * psi * t161 * t22;
-        double t184 = -136 * t161 * t22 * t36;
-        double t185 = -12 * t153 * t161 * t22;
-        double t186 = -8 * t159 * t161 * t22;
-        double t187 = -120 * t167 * t22;
-        double t188 = 171 * psi * t167 * t22;
-        double t189 = -44 * t167 * t22 * t36;
-        double t190 = -13 * t153 * t167 * t22;
-        double t191 = 6 * t159 * t167 * t22;
-        double t192 = -18 * t73;
-        double t193 = -108 * psi * t73;
-        double t194 = 46 * t36 * t73;
-        double t195 = 52 * t153 * t73;
-        double t196 = 78 * t3 * t73;
-        double t197 = 312 * psi * t3 * t73;
-        double t198 = -194 * t3 * t36 * t73;
-        double t199 = -116 * t153 * t3 * t73;
-        double t200 = -110 * t161 * t73;
-        double t201 = -172 * psi * t161 * t73;
-        double t202 = 186 * t161 * t36 * t73;
-        double t203 = 44 * t153 * t161 * t73;
-        double t204 = 50 * t167 * t73;
-        double t205 = -80 * psi * t167 * t73;
-        double t206 = 10 * t167 * t36 * t73;
-        double t207 = 20 * t153 * t167 * t73;
-        double t209 = 36 * psi * t208;
-        double t210 = -12 * t208 * t36;
-        double t211 = -24 * t153 * t208;
-        double t212 = -120 * psi * t208 * t3;
-        double t213 = 56 * t208 * t3 * t36;
-        double t214 = 64 * t153 * t208 * t3;
-        double t215 = 100 * psi * t161 * t208;
-        double t216 = -60 * t161 * t208 * t36;
-        double t217 = -40 * t153 * t161 * t208;
-        double t218 = 288 * t5;
-        double t219 = 75 * psi * t5;
-        double t220 = -104 * t36 * t5;
-        double t221 = -37 * t153 * t5;
-        double t223 = -752 * t3 * t5;
-        double t224 = 340 * psi * t3 * t5;
-        double t225 = 42 * t3 * t36 * t5;
-        double t226 = 50 * t153 * t3 * t5;
-        double t227 = 32 * t159 * t3 * t5;
-        double t228 = 480 * t161 * t5;
-        double t229 = -667 * psi * t161 * t5;
-        double t230 = 258 * t161 * t36 * t5;
-        double t231 = -37 * t153 * t161 * t5;
-        double t232 = -34 * t159 * t161 * t5;
-        double t233 = -424 * t22 * t5;
-        double t234 = -539 * psi * t22 * t5;
-        double t235 = 440 * t22 * t36 * t5;
-        double t236 = 157 * t153 * t22 * t5;
-        double t238 = 1152 * t22 * t3 * t5;
-        double t239 = 104 * psi * t22 * t3 * t5;
-        double t240 = -678 * t22 * t3 * t36 * t5;
-        double t241 = -66 * t153 * t22 * t3 * t5;
-        double t242 = -32 * t159 * t22 * t3 * t5;
-        double t243 = -760 * t161 * t22 * t5;
-        double t244 = 1103 * psi * t161 * t22 * t5;
-        double t245 = -278 * t161 * t22 * t36 * t5;
-        double t246 = -99 * t153 * t161 * t22 * t5;
-        double t247 = 34 * t159 * t161 * t22 * t5;
-        double t248 = 156 * t5 * t73;
-        double t249 = 672 * psi * t5 * t73;
-        double t250 = -420 * t36 * t5 * t73;
-        double t251 = -264 * t153 * t5 * t73;
-        double t252 = -440 * t3 * t5 * t73;
-        double t253 = -768 * psi * t3 * t5 * t73;
-        double t254 = 808 * t3 * t36 * t5 * t73;
-        double t255 = 208 * t153 * t3 * t5 * t73;
-        double t256 = 300 * t161 * t5 * t73;
-        double t257 = -480 * psi * t161 * t5 * t73;
-        double t258 = 60 * t161 * t36 * t5 * t73;
-        double t259 = 120 * t153 * t161 * t5 * t73;
-        double t260 = -240 * psi * t208 * t5;
-        double t261 = 112 * t208 * t36 * t5;
-        double t262 = 128 * t153 * t208 * t5;
-        double t263 = 400 * psi * t208 * t3 * t5;
-        double t264 = -240 * t208 * t3 * t36 * t5;
-        double t265 = -160 * t153 * t208 * t3 * t5;
-        double t267 = -840 * t266;
-        double t268 = 408 * psi * t266;
-        double t269 = 112 * t266 * t36;
-        double t270 = 32 * t153 * t266;
-        double t271 = 24 * t159 * t266;
-        double t272 = 1064 * t266 * t3;
-        double t273 = -1544 * psi * t266 * t3;
-        double t274 = 556 * t266 * t3 * t36;
-        double t275 = -20 * t153 * t266 * t3;
-        double t276 = -56 * t159 * t266 * t3;
-        double t277 = 1216 * t22 * t266;
-        double t278 = 148 * psi * t22 * t266;
-        double t279 = -828 * t22 * t266 * t36;
-        double t280 = -72 * t153 * t22 * t266;
-        double t281 = -24 * t159 * t22 * t266;
-        double t282 = -1600 * t22 * t266 * t3;
-        double t283 = 2380 * psi * t22 * t266 * t3;
-        double t284 = -576 * t22 * t266 * t3 * t36;
-        double t285 = -260 * t153 * t22 * t266 * t3;
-        double t286 = 56 * t159 * t22 * t266 * t3;
-        double t287 = -440 * t266 * t73;
-        double t288 = -848 * psi * t266 * t73;
-        double t289 = 872 * t266 * t36 * t73;
-        double t290 = 240 * t153 * t266 * t73;
-        double t291 = 600 * t266 * t3 * t73;
-        double t293 = 120 * t266 * t3 * t36 * t73;
-        double t294 = 240 * t153 * t266 * t3 * t73;
-        double t295 = 400 * psi * t208 * t266;
-        double t296 = -240 * t208 * t266 * t36;
-        double t297 = -160 * t153 * t208 * t266;
-        double t299 = 784 * t298;
-        double t300 = -1188 * psi * t298;
-        double t301 = 392 * t298 * t36;
-        double t302 = 36 * t153 * t298;
-        double t303 = -24 * t159 * t298;
-        double t304 = -1120 * t22 * t298;
-        double t305 = 1716 * psi * t22 * t298;
-        double t306 = -392 * t22 * t298 * t36;
-        double t307 = -228 * t153 * t22 * t298;
-        double t308 = 24 * t159 * t22 * t298;
-        double t309 = 400 * t298 * t73;
-        double t310 = -640 * psi * t298 * t73;
-        double t311 = 80 * t298 * t36 * t73;
-        double t312 = 160 * t153 * t298 * t73;
-        double t313 = 144 * t24;
-        double t314 = 235 * psi * t24;
-        double t315 = -132 * t24 * t36;
-        double t316 = -81 * t153 * t24;
-        double t317 = 2 * t159 * t24;
-        double t318 = -600 * t24 * t3;
-        double t319 = -487 * psi * t24 * t3;
-        double t320 = 485 * t24 * t3 * t36;
-        double t321 = 126 * t153 * t24 * t3;
-        double t322 = -4 * t159 * t24 * t3;
-        double t323 = 816 * t161 * t24;
-        double t324 = -163 * psi * t161 * t24;
-        double t325 = -350 * t161 * t24 * t36;
-        double t326 = 19 * t153 * t161 * t24;
-        double t327 = -10 * t159 * t161 * t24;
-        double t328 = -360 * t167 * t24;
-        double t329 = 543 * psi * t167 * t24;
-        double t330 = -135 * t167 * t24 * t36;
-        double t331 = -60 * t153 * t167 * t24;
-        double t332 = 12 * t159 * t167 * t24;
-        double t333 = -108 * t22 * t24;
-        double t334 = -552 * psi * t22 * t24;
-        double t335 = 251 * t22 * t24 * t36;
-        double t336 = 271 * t153 * t22 * t24;
-        double t337 = -2 * t159 * t22 * t24;
-        double t338 = 468 * t22 * t24 * t3;
-        double t339 = 1568 * psi * t22 * t24 * t3;
-        double t340 = -1050 * t22 * t24 * t3 * t36;
-        double t341 = -594 * t153 * t22 * t24 * t3;
-        double t342 = 8 * t159 * t22 * t24 * t3;
-        double t343 = -660 * t161 * t22 * t24;
-        double t344 = -792 * psi * t161 * t22 * t24;
-        double t345 = 999 * t161 * t22 * t24 * t36;
-        double t346 = 199 * t153 * t161 * t22 * t24;
-        double t347 = -6 * t159 * t161 * t22 * t24;
-        double t348 = 300 * t167 * t22 * t24;
-        double t349 = -480 * psi * t167 * t22 * t24;
-        double t350 = 60 * t167 * t22 * t24 * t36;
-        double t351 = 120 * t153 * t167 * t22 * t24;
-        double t352 = 288 * psi * t24 * t73;
-        double t353 = -96 * t24 * t36 * t73;
-        double t354 = -192 * t153 * t24 * t73;
-        double t355 = -960 * psi * t24 * t3 * t73;
-        double t356 = 448 * t24 * t3 * t36 * t73;
-        double t357 = 512 * t153 * t24 * t3 * t73;
-        double t358 = 800 * psi * t161 * t24 * t73;
-        double t359 = -480 * t161 * t24 * t36 * t73;
-        double t360 = -320 * t153 * t161 * t24 * t73;
-        double t361 = -1272 * t24 * t5;
-        double t362 = -1116 * psi * t24 * t5;
-        double t363 = 1154 * t24 * t36 * t5;
-        double t364 = 366 * t153 * t24 * t5;
-        double t365 = 4 * t159 * t24 * t5;
-        double t366 = 3456 * t24 * t3 * t5;
-        double t367 = -556 * psi * t24 * t3 * t5;
-        double t368 = -1712 * t24 * t3 * t36 * t5;
-        double t369 = 12 * t153 * t24 * t3 * t5;
-        double t370 = -48 * t159 * t24 * t3 * t5;
-        double t371 = -2280 * t161 * t24 * t5;
-        double t372 = 3464 * psi * t161 * t24 * t5;
-        double t373 = -842 * t161 * t24 * t36 * t5;
-        double t374 = -410 * t153 * t161 * t24 * t5;
-        double t375 = 68 * t159 * t161 * t24 * t5;
-        double t376 = 936 * t22 * t24 * t5;
-        double t377 = 3376 * psi * t22 * t24 * t5;
-        double t378 = -2248 * t22 * t24 * t36 * t5;
-        double t379 = -1352 * t153 * t22 * t24 * t5;
-        double t380 = 8 * t159 * t22 * t24 * t5;
-        double t381 = -2640 * t22 * t24 * t3 * t5;
-        double t382 = -3568 * psi * t22 * t24 * t3 * t5;
-        double t383 = 4296 * t22 * t24 * t3 * t36 * t5;
-        double t384 = 968 * t153 * t22 * t24 * t3 * t5;
-        double t385 = -16 * t159 * t22 * t24 * t3 * t5;
-        double t386 = 1800 * t161 * t22 * t24 * t5;
-        double t387 = -2880 * psi * t161 * t22 * t24 * t5;
-        double t388 = 360 * t161 * t22 * t24 * t36 * t5;
-        double t389 = 720 * t153 * t161 * t22 * t24 * t5;
-        double t390 = -1920 * psi * t24 * t5 * t73;
-        double t391 = 896 * t24 * t36 * t5 * t73;
-        double t392 = 1024 * t153 * t24 * t5 * t73;
-        double t393 = 3200 * psi * t24 * t3 * t5 * t73;
-        double t395 = -1280 * t153 * t24 * t3 * t5 * t73;
-        double t396 = 3648 * t24 * t266;
-        double t397 = -468 * psi * t24 * t266;
-        double t398 = -2056 * t24 * t266 * t36;
-        double t399 = -28 * t153 * t24 * t266;
-        double t400 = -40 * t159 * t24 * t266;
-        double t401 = -4800 * t24 * t266 * t3;
-        double t402 = 7380 * psi * t24 * t266 * t3;
-        double t403 = -1732 * t24 * t266 * t3 * t36;
-        double t404 = -960 * t153 * t24 * t266 * t3;
-        double t405 = 112 * t159 * t24 * t266 * t3;
-        double t406 = -2640 * t22 * t24 * t266;
-        double t407 = -3968 * psi * t22 * t24 * t266;
-        double t408 = 4596 * t22 * t24 * t266 * t36;
-        double t409 = 1140 * t153 * t22 * t24 * t266;
-        double t410 = -8 * t159 * t22 * t24 * t266;
-        double t411 = 3600 * t22 * t24 * t266 * t3;
-        double t412 = -5760 * psi * t22 * t24 * t266 * t3;
-        double t413 = 720 * t22 * t24 * t266 * t3 * t36;
-        double t414 = 1440 * t153 * t22 * t24 * t266 * t3;
-        double t415 = 3200 * psi * t24 * t266 * t73;
-        double t416 = -1920 * t24 * t266 * t36 * t73;
-        double t417 = -1280 * t153 * t24 * t266 * t73;
-        double t418 = -3360 * t24 * t298;
-        double t419 = 5248 * psi * t24 * t298;
-        double t420 = -1176 * t24 * t298 * t36;
-        double t421 = -760 * t153 * t24 * t298;
-        double t422 = 48 * t159 * t24 * t298;
-        double t423 = 2400 * t22 * t24 * t298;
-        double t424 = -3840 * psi * t22 * t24 * t298;
-        double t425 = 480 * t22 * t24 * t298 * t36;
-        double t426 = 960 * t153 * t22 * t24 * t298;
-        double t427 = -162 * t100;
-        double t428 = -684 * psi * t100;
-        double t429 = 336 * t100 * t36;
-        double t430 = 346 * t100 * t153;
-        double t431 = -4 * t100 * t159;
-        double t432 = 702 * t100 * t3;
-        double t433 = 1896 * psi * t100 * t3;
-        double t434 = -1390 * t100 * t3 * t36;
-        double t435 = -744 * t100 * t153 * t3;
-        double t436 = 16 * t100 * t159 * t3;
-        double t437 = -990 * t100 * t161;
-        double t438 = -828 * psi * t100 * t161;
-        double t439 = 1308 * t100 * t161 * t36;
-        double t440 = 210 * t100 * t153 * t161;
-        double t441 = -12 * t100 * t159 * t161;
-        double t442 = 450 * t100 * t167;
-        double t443 = -720 * psi * t100 * t167;
-        double t444 = 90 * t100 * t167 * t36;
-        double t445 = 180 * t100 * t153 * t167;
-        double t446 = 756 * psi * t100 * t22;
-        double t447 = -252 * t100 * t22 * t36;
-        double t448 = -504 * t100 * t153 * t22;
-        double t449 = -2520 * psi * t100 * t22 * t3;
-        double t450 = 1176 * t100 * t22 * t3 * t36;
-        double t451 = 1344 * t100 * t153 * t22 * t3;
-        double t452 = 2100 * psi * t100 * t161 * t22;
-        double t453 = -1260 * t100 * t161 * t22 * t36;
-        double t454 = -840 * t100 * t153 * t161 * t22;
-        double t455 = 1404 * t100 * t5;
-        double t456 = 4080 * psi * t100 * t5;
-        double t457 = -2948 * t100 * t36 * t5;
-        double t458 = -1688 * t100 * t153 * t5;
-        double t459 = 16 * t100 * t159 * t5;
-        double t460 = -3960 * t100 * t3 * t5;
-        double t461 = -3792 * psi * t100 * t3 * t5;
-        double t462 = 5576 * t100 * t3 * t36 * t5;
-        double t463 = 1056 * t100 * t153 * t3 * t5;
-        double t464 = -32 * t100 * t159 * t3 * t5;
-        double t465 = 2700 * t100 * t161 * t5;
-        double t466 = -4320 * psi * t100 * t161 * t5;
-        double t467 = 540 * t100 * t161 * t36 * t5;
-        double t468 = 1080 * t100 * t153 * t161 * t5;
-        double t469 = -5040 * psi * t100 * t22 * t5;
-        double t470 = 2352 * t100 * t22 * t36 * t5;
-        double t471 = 2688 * t100 * t153 * t22 * t5;
-        double t472 = 8400 * psi * t100 * t22 * t3 * t5;
-        double t473 = -5040 * t100 * t22 * t3 * t36 * t5;
-        double t474 = -3360 * t100 * t153 * t22 * t3 * t5;
-        double t475 = -3960 * t100 * t266;
-        double t476 = -4272 * psi * t100 * t266;
-        double t477 = 5920 * t100 * t266 * t36;
-        double t478 = 1272 * t100 * t153 * t266;
-        double t479 = -16 * t100 * t159 * t266;
-        double t480 = 5400 * t100 * t266 * t3;
-        double t481 = -8640 * psi * t100 * t266 * t3;
-        double t482 = 1080 * t100 * t266 * t3 * t36;
-        double t484 = 8400 * psi * t100 * t22 * t266;
-        double t485 = -5040 * t100 * t22 * t266 * t36;
-        double t486 = -3360 * t100 * t153 * t22 * t266;
-        double t487 = 3600 * t100 * t298;
-        double t488 = -5760 * psi * t100 * t298;
-        double t489 = 720 * t100 * t298 * t36;
-        double t490 = 1440 * t100 * t153 * t298;
-        double t492 = 648 * psi * t491;
-        double t493 = -216 * t36 * t491;
-        double t495 = -2160 * psi * t3 * t491;
-        double t496 = 1008 * t3 * t36 * t491;
-        double t497 = 1152 * t153 * t3 * t491;
-        double t498 = 1800 * psi * t161 * t491;
-        double t499 = -1080 * t161 * t36 * t491;
-        double t500 = -720 * t153 * t161 * t491;
-        double t501 = -4320 * psi * t491 * t5;
-        double t502 = 2016 * t36 * t491 * t5;
-        double t503 = 2304 * t153 * t491 * t5;
-        double t504 = 7200 * psi * t3 * t491 * t5;
-        double t505 = -4320 * t3 * t36 * t491 * t5;
-        double t506 = -2880 * t153 * t3 * t491 * t5;
-        double t507 = 7200 * psi * t266 * t491;
-        double t509 = -2880 * t153 * t266 * t491;
-        double t510 =
+        return nbs_floating(alpha, h, psi, c, right);
+    }
+
+    template <typename V>
+    static std::span<const V> nbs_floating(
+        const std::array<V, 4>& alpha, real h, real psi, std::span<V> c, bool right)
+    {
+        using std::pow;
+
+        V t3 = alpha[0];
+        V t5 = alpha[2];
+        V t17 = -1 + psi;
+        V t11 = -psi;
+        V t22 = alpha[1];
+        V t9 = 2 * t5;
+        V t24 = alpha[3];
+        V t28 = 1 + psi;
+        V t29 = pow(t28, -1);
+        V t12 = -2 * t3;
+        V t36 = pow(psi, 2);
+        V t14 = -3 * t5;
+        V t18 = -(t17 * t3);
+        V t21 = -(t17 * t5);
+        V t53 = -6 * t3;
+        V t54 = -3 * t22;
+        V t55 = 5 * t22 * t3;
+        V t56 = -14 * t5;
+        V t57 = 10 * t22 * t5;
+        V t58 = -9 * t24;
+        V t59 = 15 * t24 * t3;
+        V t60 = 30 * t24 * t5;
+        V t61 = 4 + t53 + t54 + t55 + t56 + t57 + t58 + t59 + t60;
+        V t62 = pow(t61, -1);
+        V t37 = -t36;
+        V t73 = pow(t22, 2);
+        V t44 = 2 * t24 * t36;
+        V t100 = pow(t24, 2);
+        V t49 = 3 * t3;
+        V t50 = -1 + t49 + t9;
+        V t51 = 2 * t24;
+        V t52 = -1 + t22 + t51;
+        V t13 = 3 * psi * t3;
+        V t153 = pow(psi, 3);
+        V t161 = pow(t3, 2);
+        V t159 = pow(psi, 4);
+        V t167 = pow(t3, 3);
+        V t208 = pow(t22, 3);
+        V t266 = pow(t5, 2);
+        V t298 = pow(t5, 3);
+        V t491 = pow(t24, 3);
+        V t222 = -6 * t159 * t5;
+        V t237 = 6 * t159 * t22 * t5;
+        V t292 = -960 * psi * t266 * t3 * t73;
+        V t394 = -1920 * t24 * t3 * t36 * t5 * t73;
+        V t483 = 2160 * t100 * t153 * t266 * t3;
+        V t494 = -432 * t153 * t491;
+        V t508 = -4320 * t266 * t36 * t491;
+        V t151 = -27 * psi;
+        V t152 = 11 * t36;
+        V t154 = 6 * t153;
+        V t155 = 128 * t3;
+        V t156 = 36 * psi * t3;
+        V t157 = -31 * t3 * t36;
+        V t158 = -11 * t153 * t3;
+        V t160 = -2 * t159 * t3;
+        V t162 = -168 * t161;
+        V t163 = 71 * psi * t161;
+        V t164 = -3 * t161 * t36;
+        V t165 = 14 * t153 * t161;
+        V t166 = 8 * t159 * t161;
+        V t168 = 72 * t167;
+        V t169 = -96 * psi * t167;
+        V t170 = 39 * t167 * t36;
+        V t171 = -9 * t153 * t167;
+        V t172 = -6 * t159 * t167;
+        V t173 = 48 * t22;
+        V t174 = 102 * psi * t22;
+        V t175 = -48 * t22 * t36;
+        V t176 = -32 * t153 * t22;
+        V t177 = -200 * t22 * t3;
+        V t178 = -239 * psi * t22 * t3;
+        V t179 = 180 * t22 * t3 * t36;
+        V t180 = 57 * t153 * t22 * t3;
+        V t181 = 2 * t159 * t22 * t3;
+        V t182 = 272 * t161 * t22;
+        V t183 = 14 * psi * t161 * t22;
+        V t184 = -136 * t161 * t22 * t36;
+        V t185 = -12 * t153 * t161 * t22;
+        V t186 = -8 * t159 * t161 * t22;
+        V t187 = -120 * t167 * t22;
+        V t188 = 171 * psi * t167 * t22;
+        V t189 = -44 * t167 * t22 * t36;
+        V t190 = -13 * t153 * t167 * t22;
+        V t191 = 6 * t159 * t167 * t22;
+        V t192 = -18 * t73;
+        V t193 = -108 * psi * t73;
+        V t194 = 46 * t36 * t73;
+        V t195 = 52 * t153 * t73;
+        V t196 = 78 * t3 * t73;
+        V t197 = 312 * psi * t3 * t73;
+        V t198 = -194 * t3 * t36 * t73;
+        V t199 = -116 * t153 * t3 * t73;
+        V t200 = -110 * t161 * t73;
+        V t201 = -172 * psi * t161 * t73;
+        V t202 = 186 * t161 * t36 * t73;
+        V t203 = 44 * t153 * t161 * t73;
+        V t204 = 50 * t167 * t73;
+        V t205 = -80 * psi * t167 * t73;
+        V t206 = 10 * t167 * t36 * t73;
+        V t207 = 20 * t153 * t167 * t73;
+        V t209 = 36 * psi * t208;
+        V t210 = -12 * t208 * t36;
+        V t211 = -24 * t153 * t208;
+        V t212 = -120 * psi * t208 * t3;
+        V t213 = 56 * t208 * t3 * t36;
+        V t214 = 64 * t153 * t208 * t3;
+        V t215 = 100 * psi * t161 * t208;
+        V t216 = -60 * t161 * t208 * t36;
+        V t217 = -40 * t153 * t161 * t208;
+        V t218 = 288 * t5;
+        V t219 = 75 * psi * t5;
+        V t220 = -104 * t36 * t5;
+        V t221 = -37 * t153 * t5;
+        V t223 = -752 * t3 * t5;
+        V t224 = 340 * psi * t3 * t5;
+        V t225 = 42 * t3 * t36 * t5;
+        V t226 = 50 * t153 * t3 * t5;
+        V t227 = 32 * t159 * t3 * t5;
+        V t228 = 480 * t161 * t5;
+        V t229 = -667 * psi * t161 * t5;
+        V t230 = 258 * t161 * t36 * t5;
+        V t231 = -37 * t153 * t161 * t5;
+        V t232 = -34 * t159 * t161 * t5;
+        V t233 = -424 * t22 * t5;
+        V t234 = -539 * psi * t22 * t5;
+        V t235 = 440 * t22 * t36 * t5;
+        V t236 = 157 * t153 * t22 * t5;
+        V t238 = 1152 * t22 * t3 * t5;
+        V t239 = 104 * psi * t22 * t3 * t5;
+        V t240 = -678 * t22 * t3 * t36 * t5;
+        V t241 = -66 * t153 * t22 * t3 * t5;
+        V t242 = -32 * t159 * t22 * t3 * t5;
+        V t243 = -760 * t161 * t22 * t5;
+        V t244 = 1103 * psi * t161 * t22 * t5;
+        V t245 = -278 * t161 * t22 * t36 * t5;
+        V t246 = -99 * t153 * t161 * t22 * t5;
+        V t247 = 34 * t159 * t161 * t22 * t5;
+        V t248 = 156 * t5 * t73;
+        V t249 = 672 * psi * t5 * t73;
+        V t250 = -420 * t36 * t5 * t73;
+        V t251 = -264 * t153 * t5 * t73;
+        V t252 = -440 * t3 * t5 * t73;
+        V t253 = -768 * psi * t3 * t5 * t73;
+        V t254 = 808 * t3 * t36 * t5 * t73;
+        V t255 = 208 * t153 * t3 * t5 * t73;
+        V t256 = 300 * t161 * t5 * t73;
+        V t257 = -480 * psi * t161 * t5 * t73;
+        V t258 = 60 * t161 * t36 * t5 * t73;
+        V t259 = 120 * t153 * t161 * t5 * t73;
+        V t260 = -240 * psi * t208 * t5;
+        V t261 = 112 * t208 * t36 * t5;
+        V t262 = 128 * t153 * t208 * t5;
+        V t263 = 400 * psi * t208 * t3 * t5;
+        V t264 = -240 * t208 * t3 * t36 * t5;
+        V t265 = -160 * t153 * t208 * t3 * t5;
+        V t267 = -840 * t266;
+        V t268 = 408 * psi * t266;
+        V t269 = 112 * t266 * t36;
+        V t270 = 32 * t153 * t266;
+        V t271 = 24 * t159 * t266;
+        V t272 = 1064 * t266 * t3;
+        V t273 = -1544 * psi * t266 * t3;
+        V t274 = 556 * t266 * t3 * t36;
+        V t275 = -20 * t153 * t266 * t3;
+        V t276 = -56 * t159 * t266 * t3;
+        V t277 = 1216 * t22 * t266;
+        V t278 = 148 * psi * t22 * t266;
+        V t279 = -828 * t22 * t266 * t36;
+        V t280 = -72 * t153 * t22 * t266;
+        V t281 = -24 * t159 * t22 * t266;
+        V t282 = -1600 * t22 * t266 * t3;
+        V t283 = 2380 * psi * t22 * t266 * t3;
+        V t284 = -576 * t22 * t266 * t3 * t36;
+        V t285 = -260 * t153 * t22 * t266 * t3;
+        V t286 = 56 * t159 * t22 * t266 * t3;
+        V t287 = -440 * t266 * t73;
+        V t288 = -848 * psi * t266 * t73;
+        V t289 = 872 * t266 * t36 * t73;
+        V t290 = 240 * t153 * t266 * t73;
+        V t291 = 600 * t266 * t3 * t73;
+        V t293 = 120 * t266 * t3 * t36 * t73;
+        V t294 = 240 * t153 * t266 * t3 * t73;
+        V t295 = 400 * psi * t208 * t266;
+        V t296 = -240 * t208 * t266 * t36;
+        V t297 = -160 * t153 * t208 * t266;
+        V t299 = 784 * t298;
+        V t300 = -1188 * psi * t298;
+        V t301 = 392 * t298 * t36;
+        V t302 = 36 * t153 * t298;
+        V t303 = -24 * t159 * t298;
+        V t304 = -1120 * t22 * t298;
+        V t305 = 1716 * psi * t22 * t298;
+        V t306 = -392 * t22 * t298 * t36;
+        V t307 = -228 * t153 * t22 * t298;
+        V t308 = 24 * t159 * t22 * t298;
+        V t309 = 400 * t298 * t73;
+        V t310 = -640 * psi * t298 * t73;
+        V t311 = 80 * t298 * t36 * t73;
+        V t312 = 160 * t153 * t298 * t73;
+        V t313 = 144 * t24;
+        V t314 = 235 * psi * t24;
+        V t315 = -132 * t24 * t36;
+        V t316 = -81 * t153 * t24;
+        V t317 = 2 * t159 * t24;
+        V t318 = -600 * t24 * t3;
+        V t319 = -487 * psi * t24 * t3;
+        V t320 = 485 * t24 * t3 * t36;
+        V t321 = 126 * t153 * t24 * t3;
+        V t322 = -4 * t159 * t24 * t3;
+        V t323 = 816 * t161 * t24;
+        V t324 = -163 * psi * t161 * t24;
+        V t325 = -350 * t161 * t24 * t36;
+        V t326 = 19 * t153 * t161 * t24;
+        V t327 = -10 * t159 * t161 * t24;
+        V t328 = -360 * t167 * t24;
+        V t329 = 543 * psi * t167 * t24;
+        V t330 = -135 * t167 * t24 * t36;
+        V t331 = -60 * t153 * t167 * t24;
+        V t332 = 12 * t159 * t167 * t24;
+        V t333 = -108 * t22 * t24;
+        V t334 = -552 * psi * t22 * t24;
+        V t335 = 251 * t22 * t24 * t36;
+        V t336 = 271 * t153 * t22 * t24;
+        V t337 = -2 * t159 * t22 * t24;
+        V t338 = 468 * t22 * t24 * t3;
+        V t339 = 1568 * psi * t22 * t24 * t3;
+        V t340 = -1050 * t22 * t24 * t3 * t36;
+        V t341 = -594 * t153 * t22 * t24 * t3;
+        V t342 = 8 * t159 * t22 * t24 * t3;
+        V t343 = -660 * t161 * t22 * t24;
+        V t344 = -792 * psi * t161 * t22 * t24;
+        V t345 = 999 * t161 * t22 * t24 * t36;
+        V t346 = 199 * t153 * t161 * t22 * t24;
+        V t347 = -6 * t159 * t161 * t22 * t24;
+        V t348 = 300 * t167 * t22 * t24;
+        V t349 = -480 * psi * t167 * t22 * t24;
+        V t350 = 60 * t167 * t22 * t24 * t36;
+        V t351 = 120 * t153 * t167 * t22 * t24;
+        V t352 = 288 * psi * t24 * t73;
+        V t353 = -96 * t24 * t36 * t73;
+        V t354 = -192 * t153 * t24 * t73;
+        V t355 = -960 * psi * t24 * t3 * t73;
+        V t356 = 448 * t24 * t3 * t36 * t73;
+        V t357 = 512 * t153 * t24 * t3 * t73;
+        V t358 = 800 * psi * t161 * t24 * t73;
+        V t359 = -480 * t161 * t24 * t36 * t73;
+        V t360 = -320 * t153 * t161 * t24 * t73;
+        V t361 = -1272 * t24 * t5;
+        V t362 = -1116 * psi * t24 * t5;
+        V t363 = 1154 * t24 * t36 * t5;
+        V t364 = 366 * t153 * t24 * t5;
+        V t365 = 4 * t159 * t24 * t5;
+        V t366 = 3456 * t24 * t3 * t5;
+        V t367 = -556 * psi * t24 * t3 * t5;
+        V t368 = -1712 * t24 * t3 * t36 * t5;
+        V t369 = 12 * t153 * t24 * t3 * t5;
+        V t370 = -48 * t159 * t24 * t3 * t5;
+        V t371 = -2280 * t161 * t24 * t5;
+        V t372 = 3464 * psi * t161 * t24 * t5;
+        V t373 = -842 * t161 * t24 * t36 * t5;
+        V t374 = -410 * t153 * t161 * t24 * t5;
+        V t375 = 68 * t159 * t161 * t24 * t5;
+        V t376 = 936 * t22 * t24 * t5;
+        V t377 = 3376 * psi * t22 * t24 * t5;
+        V t378 = -2248 * t22 * t24 * t36 * t5;
+        V t379 = -1352 * t153 * t22 * t24 * t5;
+        V t380 = 8 * t159 * t22 * t24 * t5;
+        V t381 = -2640 * t22 * t24 * t3 * t5;
+        V t382 = -3568 * psi * t22 * t24 * t3 * t5;
+        V t383 = 4296 * t22 * t24 * t3 * t36 * t5;
+        V t384 = 968 * t153 * t22 * t24 * t3 * t5;
+        V t385 = -16 * t159 * t22 * t24 * t3 * t5;
+        V t386 = 1800 * t161 * t22 * t24 * t5;
+        V t387 = -2880 * psi * t161 * t22 * t24 * t5;
+        V t388 = 360 * t161 * t22 * t24 * t36 * t5;
+        V t389 = 720 * t153 * t161 * t22 * t24 * t5;
+        V t390 = -1920 * psi * t24 * t5 * t73;
+        V t391 = 896 * t24 * t36 * t5 * t73;
+        V t392 = 1024 * t153 * t24 * t5 * t73;
+        V t393 = 3200 * psi * t24 * t3 * t5 * t73;
+        V t395 = -1280 * t153 * t24 * t3 * t5 * t73;
+        V t396 = 3648 * t24 * t266;
+        V t397 = -468 * psi * t24 * t266;
+        V t398 = -2056 * t24 * t266 * t36;
+        V t399 = -28 * t153 * t24 * t266;
+        V t400 = -40 * t159 * t24 * t266;
+        V t401 = -4800 * t24 * t266 * t3;
+        V t402 = 7380 * psi * t24 * t266 * t3;
+        V t403 = -1732 * t24 * t266 * t3 * t36;
+        V t404 = -960 * t153 * t24 * t266 * t3;
+        V t405 = 112 * t159 * t24 * t266 * t3;
+        V t406 = -2640 * t22 * t24 * t266;
+        V t407 = -3968 * psi * t22 * t24 * t266;
+        V t408 = 4596 * t22 * t24 * t266 * t36;
+        V t409 = 1140 * t153 * t22 * t24 * t266;
+        V t410 = -8 * t159 * t22 * t24 * t266;
+        V t411 = 3600 * t22 * t24 * t266 * t3;
+        V t412 = -5760 * psi * t22 * t24 * t266 * t3;
+        V t413 = 720 * t22 * t24 * t266 * t3 * t36;
+        V t414 = 1440 * t153 * t22 * t24 * t266 * t3;
+        V t415 = 3200 * psi * t24 * t266 * t73;
+        V t416 = -1920 * t24 * t266 * t36 * t73;
+        V t417 = -1280 * t153 * t24 * t266 * t73;
+        V t418 = -3360 * t24 * t298;
+        V t419 = 5248 * psi * t24 * t298;
+        V t420 = -1176 * t24 * t298 * t36;
+        V t421 = -760 * t153 * t24 * t298;
+        V t422 = 48 * t159 * t24 * t298;
+        V t423 = 2400 * t22 * t24 * t298;
+        V t424 = -3840 * psi * t22 * t24 * t298;
+        V t425 = 480 * t22 * t24 * t298 * t36;
+        V t426 = 960 * t153 * t22 * t24 * t298;
+        V t427 = -162 * t100;
+        V t428 = -684 * psi * t100;
+        V t429 = 336 * t100 * t36;
+        V t430 = 346 * t100 * t153;
+        V t431 = -4 * t100 * t159;
+        V t432 = 702 * t100 * t3;
+        V t433 = 1896 * psi * t100 * t3;
+        V t434 = -1390 * t100 * t3 * t36;
+        V t435 = -744 * t100 * t153 * t3;
+        V t436 = 16 * t100 * t159 * t3;
+        V t437 = -990 * t100 * t161;
+        V t438 = -828 * psi * t100 * t161;
+        V t439 = 1308 * t100 * t161 * t36;
+        V t440 = 210 * t100 * t153 * t161;
+        V t441 = -12 * t100 * t159 * t161;
+        V t442 = 450 * t100 * t167;
+        V t443 = -720 * psi * t100 * t167;
+        V t444 = 90 * t100 * t167 * t36;
+        V t445 = 180 * t100 * t153 * t167;
+        V t446 = 756 * psi * t100 * t22;
+        V t447 = -252 * t100 * t22 * t36;
+        V t448 = -504 * t100 * t153 * t22;
+        V t449 = -2520 * psi * t100 * t22 * t3;
+        V t450 = 1176 * t100 * t22 * t3 * t36;
+        V t451 = 1344 * t100 * t153 * t22 * t3;
+        V t452 = 2100 * psi * t100 * t161 * t22;
+        V t453 = -1260 * t100 * t161 * t22 * t36;
+        V t454 = -840 * t100 * t153 * t161 * t22;
+        V t455 = 1404 * t100 * t5;
+        V t456 = 4080 * psi * t100 * t5;
+        V t457 = -2948 * t100 * t36 * t5;
+        V t458 = -1688 * t100 * t153 * t5;
+        V t459 = 16 * t100 * t159 * t5;
+        V t460 = -3960 * t100 * t3 * t5;
+        V t461 = -3792 * psi * t100 * t3 * t5;
+        V t462 = 5576 * t100 * t3 * t36 * t5;
+        V t463 = 1056 * t100 * t153 * t3 * t5;
+        V t464 = -32 * t100 * t159 * t3 * t5;
+        V t465 = 2700 * t100 * t161 * t5;
+        V t466 = -4320 * psi * t100 * t161 * t5;
+        V t467 = 540 * t100 * t161 * t36 * t5;
+        V t468 = 1080 * t100 * t153 * t161 * t5;
+        V t469 = -5040 * psi * t100 * t22 * t5;
+        V t470 = 2352 * t100 * t22 * t36 * t5;
+        V t471 = 2688 * t100 * t153 * t22 * t5;
+        V t472 = 8400 * psi * t100 * t22 * t3 * t5;
+        V t473 = -5040 * t100 * t22 * t3 * t36 * t5;
+        V t474 = -3360 * t100 * t153 * t22 * t3 * t5;
+        V t475 = -3960 * t100 * t266;
+        V t476 = -4272 * psi * t100 * t266;
+        V t477 = 5920 * t100 * t266 * t36;
+        V t478 = 1272 * t100 * t153 * t266;
+        V t479 = -16 * t100 * t159 * t266;
+        V t480 = 5400 * t100 * t266 * t3;
+        V t481 = -8640 * psi * t100 * t266 * t3;
+        V t482 = 1080 * t100 * t266 * t3 * t36;
+        V t484 = 8400 * psi * t100 * t22 * t266;
+        V t485 = -5040 * t100 * t22 * t266 * t36;
+        V t486 = -3360 * t100 * t153 * t22 * t266;
+        V t487 = 3600 * t100 * t298;
+        V t488 = -5760 * psi * t100 * t298;
+        V t489 = 720 * t100 * t298 * t36;
+        V t490 = 1440 * t100 * t153 * t298;
+        V t492 = 648 * psi * t491;
+        V t493 = -216 * t36 * t491;
+        V t495 = -2160 * psi * t3 * t491;
+        V t496 = 1008 * t3 * t36 * t491;
+        V t497 = 1152 * t153 * t3 * t491;
+        V t498 = 1800 * psi * t161 * t491;
+        V t499 = -1080 * t161 * t36 * t491;
+        V t500 = -720 * t153 * t161 * t491;
+        V t501 = -4320 * psi * t491 * t5;
+        V t502 = 2016 * t36 * t491 * t5;
+        V t503 = 2304 * t153 * t491 * t5;
+        V t504 = 7200 * psi * t3 * t491 * t5;
+        V t505 = -4320 * t3 * t36 * t491 * t5;
+        V t506 = -2880 * t153 * t3 * t491 * t5;
+        V t507 = 7200 * psi * t266 * t491;
+        V t509 = -2880 * t153 * t266 * t491;
+        V t510 =
             -32 + t151 + t152 + t154 + t155 + t156 + t157 + t158 + t160 + t162 + t163 +
             t164 + t165 + t166 + t168 + t169 + t170 + t171 + t172 + t173 + t174 + t175 +
             t176 + t177 + t178 + t179 + t180 + t181 + t182 + t183 + t184 + t185 + t186 +
@@ -555,332 +593,332 @@ struct E2_1 {
             t476 + t477 + t478 + t479 + t480 + t481 + t482 + t483 + t484 + t485 + t486 +
             t487 + t488 + t489 + t490 + t492 + t493 + t494 + t495 + t496 + t497 + t498 +
             t499 + t500 + t501 + t502 + t503 + t504 + t505 + t506 + t507 + t508 + t509;
-        double t511 = std::pow(t510, -1);
-        double t522 = 36 * t167;
-        double t67 = 14 * t22;
-        double t74 = -6 * t73;
-        double t551 = -40 * psi * t167 * t73;
-        double t86 = 34 * t24;
-        double t91 = -30 * t22 * t24;
-        double t677 = 150 * t167 * t22 * t24;
-        double t718 = 360 * t153 * t161 * t22 * t24 * t5;
-        double t101 = -36 * t100;
-        double t512 = -21 * psi;
-        double t513 = 3 * t36;
-        double t514 = 84 * t3;
-        double t515 = 32 * psi * t3;
-        double t516 = 6 * t3 * t36;
-        double t517 = -2 * t153 * t3;
-        double t518 = -96 * t161;
-        double t519 = 25 * psi * t161;
-        double t520 = -15 * t161 * t36;
-        double t521 = 8 * t153 * t161;
-        double t523 = -36 * psi * t167;
-        double t524 = 6 * t167 * t36;
-        double t525 = -6 * t153 * t167;
-        double t526 = 34 * t22;
-        double t527 = 65 * psi * t22;
-        double t528 = -29 * t22 * t36;
-        double t529 = -122 * t22 * t3;
-        double t530 = -120 * psi * t22 * t3;
-        double t531 = 40 * t22 * t3 * t36;
-        double t532 = 2 * t153 * t22 * t3;
-        double t533 = 142 * t161 * t22;
-        double t534 = -21 * psi * t161 * t22;
-        double t535 = 17 * t161 * t22 * t36;
-        double t536 = -8 * t153 * t161 * t22;
-        double t537 = -54 * t167 * t22;
-        double t538 = 76 * psi * t167 * t22;
-        double t539 = -28 * t167 * t22 * t36;
-        double t540 = 6 * t153 * t167 * t22;
-        double t541 = -12 * t73;
-        double t542 = -68 * psi * t73;
-        double t543 = 52 * t36 * t73;
-        double t544 = 44 * t3 * t73;
-        double t545 = 152 * psi * t3 * t73;
-        double t546 = -116 * t3 * t36 * t73;
-        double t547 = -52 * t161 * t73;
-        double t548 = -44 * psi * t161 * t73;
-        double t549 = 44 * t161 * t36 * t73;
-        double t550 = 20 * t167 * t73;
-        double t552 = 20 * t167 * t36 * t73;
-        double t553 = 24 * psi * t208;
-        double t554 = -24 * t208 * t36;
-        double t555 = -64 * psi * t208 * t3;
-        double t556 = 64 * t208 * t3 * t36;
-        double t557 = 40 * psi * t161 * t208;
-        double t558 = -40 * t161 * t208 * t36;
-        double t559 = 228 * t5;
-        double t560 = 49 * psi * t5;
-        double t561 = -54 * t36 * t5;
-        double t562 = -(t153 * t5);
-        double t563 = -528 * t3 * t5;
-        double t564 = 228 * psi * t3 * t5;
-        double t565 = -72 * t3 * t36 * t5;
-        double t566 = 60 * t153 * t3 * t5;
-        double t567 = 24 * t159 * t3 * t5;
-        double t568 = 300 * t161 * t5;
-        double t569 = -377 * psi * t161 * t5;
-        double t570 = 162 * t161 * t36 * t5;
-        double t571 = -67 * t153 * t161 * t5;
-        double t572 = -18 * t159 * t161 * t5;
-        double t573 = -320 * t22 * t5;
-        double t574 = -309 * psi * t22 * t5;
-        double t575 = 314 * t22 * t36 * t5;
-        double t576 = -51 * t153 * t22 * t5;
-        double t577 = 760 * t22 * t3 * t5;
-        double t578 = -164 * psi * t22 * t3 * t5;
-        double t579 = -72 * t22 * t3 * t36 * t5;
-        double t580 = -20 * t153 * t22 * t3 * t5;
-        double t581 = -24 * t159 * t22 * t3 * t5;
-        double t582 = -440 * t161 * t22 * t5;
-        double t583 = 733 * psi * t161 * t22 * t5;
-        double t584 = -422 * t161 * t22 * t36 * t5;
-        double t585 = 111 * t153 * t161 * t22 * t5;
-        double t586 = 18 * t159 * t161 * t22 * t5;
-        double t587 = 112 * t5 * t73;
-        double t588 = 432 * psi * t5 * t73;
-        double t589 = -504 * t36 * t5 * t73;
-        double t590 = 104 * t153 * t5 * t73;
-        double t591 = -272 * t3 * t5 * t73;
-        double t592 = -296 * psi * t3 * t5 * t73;
-        double t593 = 504 * t3 * t36 * t5 * t73;
-        double t594 = -128 * t153 * t3 * t5 * t73;
-        double t595 = 160 * t161 * t5 * t73;
-        double t596 = -360 * psi * t161 * t5 * t73;
-        double t597 = 240 * t161 * t36 * t5 * t73;
-        double t598 = -40 * t153 * t161 * t5 * t73;
-        double t599 = -176 * psi * t208 * t5;
-        double t600 = 224 * t208 * t36 * t5;
-        double t601 = -48 * t153 * t208 * t5;
-        double t602 = 240 * psi * t208 * t3 * t5;
-        double t603 = -320 * t208 * t3 * t36 * t5;
-        double t604 = 80 * t153 * t208 * t3 * t5;
-        double t605 = -696 * t266;
-        double t606 = 416 * psi * t266;
-        double t607 = -32 * t266 * t36;
-        double t608 = 28 * t153 * t266;
-        double t609 = 20 * t159 * t266;
-        double t610 = 792 * t266 * t3;
-        double t611 = -1184 * psi * t266 * t3;
-        double t612 = 612 * t266 * t3 * t36;
-        double t613 = -184 * t153 * t266 * t3;
-        double t614 = -36 * t159 * t266 * t3;
-        double t615 = 968 * t22 * t266;
-        double t616 = -264 * psi * t22 * t266;
-        double t617 = -352 * t22 * t266 * t36;
-        double t618 = 108 * t153 * t22 * t266;
-        double t619 = -20 * t159 * t22 * t266;
-        double t620 = -1128 * t22 * t266 * t3;
-        double t621 = 2120 * psi * t22 * t266 * t3;
-        double t622 = -1396 * t22 * t266 * t3 * t36;
-        double t623 = 368 * t153 * t22 * t266 * t3;
-        double t624 = 36 * t159 * t22 * t266 * t3;
-        double t625 = -336 * t266 * t73;
-        double t626 = -448 * psi * t266 * t73;
-        double t627 = 928 * t266 * t36 * t73;
-        double t628 = -320 * t153 * t266 * t73;
-        double t629 = 400 * t266 * t3 * t73;
-        double t630 = 720 * t266 * t3 * t36 * t73;
-        double t631 = -160 * t153 * t266 * t3 * t73;
-        double t632 = 320 * psi * t208 * t266;
-        double t633 = -480 * t208 * t266 * t36;
-        double t634 = 160 * t153 * t208 * t266;
-        double t635 = 672 * t298;
-        double t636 = -1148 * psi * t298;
-        double t637 = 640 * t298 * t36;
-        double t638 = -148 * t153 * t298;
-        double t639 = -16 * t159 * t298;
-        double t640 = -928 * t22 * t298;
-        double t641 = 1916 * psi * t22 * t298;
-        double t642 = -1344 * t22 * t298 * t36;
-        double t643 = 340 * t153 * t22 * t298;
-        double t644 = 16 * t159 * t22 * t298;
-        double t645 = 320 * t298 * t73;
-        double t646 = -800 * psi * t298 * t73;
-        double t647 = 640 * t298 * t36 * t73;
-        double t648 = -160 * t153 * t298 * t73;
-        double t649 = 110 * t24;
-        double t650 = 190 * psi * t24;
-        double t651 = -86 * t24 * t36;
-        double t652 = -46 * t153 * t24;
-        double t653 = -410 * t24 * t3;
-        double t654 = -400 * psi * t24 * t3;
-        double t655 = 230 * t24 * t3 * t36;
-        double t656 = 100 * t153 * t24 * t3;
-        double t657 = 498 * t161 * t24;
-        double t658 = 34 * psi * t161 * t24;
-        double t659 = -242 * t161 * t24 * t36;
-        double t660 = 22 * t153 * t161 * t24;
-        double t661 = -198 * t167 * t24;
-        double t662 = 192 * psi * t167 * t24;
-        double t663 = 114 * t167 * t24 * t36;
-        double t664 = -108 * t153 * t167 * t24;
-        double t665 = -78 * t22 * t24;
-        double t666 = -392 * psi * t22 * t24;
-        double t667 = 200 * t22 * t24 * t36;
-        double t668 = 130 * t153 * t22 * t24;
-        double t669 = 298 * t22 * t24 * t3;
-        double t670 = 952 * psi * t22 * t24 * t3;
-        double t671 = -470 * t22 * t24 * t3 * t36;
-        double t672 = -380 * t153 * t22 * t24 * t3;
-        double t673 = -370 * t161 * t22 * t24;
-        double t674 = -392 * psi * t161 * t22 * t24;
-        double t675 = 288 * t161 * t22 * t24 * t36;
-        double t676 = 214 * t153 * t161 * t22 * t24;
-        double t678 = -200 * psi * t167 * t22 * t24;
-        double t679 = -50 * t167 * t22 * t24 * t36;
-        double t680 = 100 * t153 * t167 * t22 * t24;
-        double t681 = 204 * psi * t24 * t73;
-        double t682 = -132 * t24 * t36 * t73;
-        double t683 = -72 * t153 * t24 * t73;
-        double t684 = -568 * psi * t24 * t3 * t73;
-        double t685 = 328 * t24 * t3 * t36 * t73;
-        double t686 = 240 * t153 * t24 * t3 * t73;
-        double t687 = 380 * psi * t161 * t24 * t73;
-        double t688 = -180 * t161 * t24 * t36 * t73;
-        double t689 = -200 * t153 * t161 * t24 * t73;
-        double t690 = -1020 * t24 * t5;
-        double t691 = -918 * psi * t24 * t5;
-        double t692 = 980 * t24 * t36 * t5;
-        double t693 = 78 * t153 * t24 * t5;
-        double t694 = 16 * t159 * t24 * t5;
-        double t695 = 2504 * t24 * t3 * t5;
-        double t696 = -168 * psi * t24 * t3 * t5;
-        double t697 = -1236 * t24 * t3 * t36 * t5;
-        double t698 = 112 * t153 * t24 * t3 * t5;
-        double t699 = -60 * t159 * t24 * t3 * t5;
-        double t700 = -1500 * t161 * t24 * t5;
-        double t701 = 1894 * psi * t161 * t24 * t5;
-        double t702 = 40 * t161 * t24 * t36 * t5;
-        double t703 = -470 * t153 * t161 * t24 * t5;
-        double t704 = 36 * t159 * t161 * t24 * t5;
-        double t705 = 716 * t22 * t24 * t5;
-        double t706 = 2464 * psi * t22 * t24 * t5;
-        double t707 = -2192 * t22 * t24 * t36 * t5;
-        double t708 = -264 * t153 * t22 * t24 * t5;
-        double t709 = -4 * t159 * t22 * t24 * t5;
-        double t710 = -1800 * t22 * t24 * t3 * t5;
-        double t711 = -2032 * psi * t22 * t24 * t3 * t5;
-        double t712 = 2596 * t22 * t24 * t3 * t36 * t5;
-        double t713 = 264 * t153 * t22 * t24 * t3 * t5;
-        double t714 = 12 * t159 * t22 * t24 * t3 * t5;
-        double t715 = 1100 * t161 * t22 * t24 * t5;
-        double t716 = -1840 * psi * t161 * t22 * t24 * t5;
-        double t717 = 380 * t161 * t22 * t24 * t36 * t5;
-        double t719 = -1472 * psi * t24 * t5 * t73;
-        double t720 = 1376 * t24 * t36 * t5 * t73;
-        double t721 = 96 * t153 * t24 * t5 * t73;
-        double t722 = 2080 * psi * t24 * t3 * t5 * t73;
-        double t723 = -160 * t153 * t24 * t3 * t5 * t73;
-        double t724 = 3048 * t24 * t266;
-        double t725 = -528 * psi * t24 * t266;
-        double t726 = -1800 * t24 * t266 * t36;
-        double t727 = 384 * t153 * t24 * t266;
-        double t728 = -48 * t159 * t24 * t266;
-        double t729 = -3656 * t24 * t266 * t3;
-        double t730 = 5488 * psi * t24 * t266 * t3;
-        double t731 = -1328 * t24 * t266 * t3 * t36;
-        double t732 = -576 * t153 * t24 * t266 * t3;
-        double t733 = 72 * t159 * t24 * t266 * t3;
-        double t734 = -2120 * t22 * t24 * t266;
-        double t735 = -2624 * psi * t22 * t24 * t266;
-        double t736 = 4472 * t22 * t24 * t266 * t36;
-        double t737 = -616 * t153 * t22 * t24 * t266;
-        double t738 = 8 * t159 * t22 * t24 * t266;
-        double t739 = 2600 * t22 * t24 * t266 * t3;
-        double t740 = -4960 * psi * t22 * t24 * t266 * t3;
-        double t741 = 2120 * t22 * t24 * t266 * t3 * t36;
-        double t742 = 240 * t153 * t22 * t24 * t266 * t3;
-        double t743 = 2640 * psi * t24 * t266 * t73;
-        double t744 = -3120 * t24 * t266 * t36 * t73;
-        double t745 = 480 * t153 * t24 * t266 * t73;
-        double t746 = -2896 * t24 * t298;
-        double t747 = 4936 * psi * t24 * t298;
-        double t748 = -1936 * t24 * t298 * t36;
-        double t749 = -136 * t153 * t24 * t298;
-        double t750 = 32 * t159 * t24 * t298;
-        double t751 = 2000 * t22 * t24 * t298;
-        double t752 = -4160 * psi * t22 * t24 * t298;
-        double t753 = 2320 * t22 * t24 * t298 * t36;
-        double t754 = -160 * t153 * t22 * t24 * t298;
-        double t755 = -126 * t100;
-        double t756 = -548 * psi * t100;
-        double t757 = 210 * t100 * t36;
-        double t758 = 296 * t100 * t153;
-        double t759 = 498 * t100 * t3;
-        double t760 = 1416 * psi * t100 * t3;
-        double t761 = -590 * t100 * t3 * t36;
-        double t762 = -844 * t100 * t153 * t3;
-        double t763 = -642 * t100 * t161;
-        double t764 = -708 * psi * t100 * t161;
-        double t765 = 630 * t100 * t161 * t36;
-        double t766 = 408 * t100 * t153 * t161;
-        double t767 = 270 * t100 * t167;
-        double t768 = -240 * psi * t100 * t167;
-        double t769 = -330 * t100 * t167 * t36;
-        double t770 = 300 * t100 * t153 * t167;
-        double t771 = 564 * psi * t100 * t22;
-        double t772 = -204 * t100 * t22 * t36;
-        double t773 = -360 * t100 * t153 * t22;
-        double t774 = -1624 * psi * t100 * t22 * t3;
-        double t775 = 424 * t100 * t22 * t3 * t36;
-        double t776 = 1200 * t100 * t153 * t22 * t3;
-        double t777 = 1140 * psi * t100 * t161 * t22;
-        double t778 = -140 * t100 * t161 * t22 * t36;
-        double t779 = -1000 * t100 * t153 * t161 * t22;
-        double t780 = 1140 * t100 * t5;
-        double t781 = 3416 * psi * t100 * t5;
-        double t782 = -2596 * t100 * t36 * t5;
-        double t783 = -1088 * t100 * t153 * t5;
-        double t784 = -8 * t100 * t159 * t5;
-        double t785 = -2952 * t100 * t3 * t5;
-        double t786 = -3216 * psi * t100 * t3 * t5;
-        double t787 = 4048 * t100 * t3 * t36 * t5;
-        double t788 = 944 * t100 * t153 * t3 * t5;
-        double t789 = 24 * t100 * t159 * t3 * t5;
-        double t790 = 1860 * t100 * t161 * t5;
-        double t791 = -2280 * psi * t100 * t161 * t5;
-        double t792 = -1020 * t100 * t161 * t36 * t5;
-        double t793 = 1440 * t100 * t153 * t161 * t5;
-        double t794 = -4016 * psi * t100 * t22 * t5;
-        double t795 = 2624 * t100 * t22 * t36 * t5;
-        double t796 = 1392 * t100 * t153 * t22 * t5;
-        double t797 = 5840 * psi * t100 * t22 * t3 * t5;
-        double t798 = -3520 * t100 * t22 * t3 * t36 * t5;
-        double t799 = -2320 * t100 * t153 * t22 * t3 * t5;
-        double t800 = -3336 * t100 * t266;
-        double t801 = -3728 * psi * t100 * t266;
-        double t802 = 6056 * t100 * t266 * t36;
-        double t803 = -64 * t100 * t153 * t266;
-        double t804 = 16 * t100 * t159 * t266;
-        double t805 = 4200 * t100 * t266 * t3;
-        double t806 = -6240 * psi * t100 * t266 * t3;
-        double t807 = -120 * t100 * t266 * t3 * t36;
-        double t808 = 7120 * psi * t100 * t22 * t266;
-        double t809 = -6480 * t100 * t22 * t266 * t36;
-        double t810 = -640 * t100 * t153 * t22 * t266;
-        double t811 = 3120 * t100 * t298;
-        double t812 = -5280 * psi * t100 * t298;
-        double t813 = 1200 * t100 * t298 * t36;
-        double t814 = 960 * t100 * t153 * t298;
-        double t815 = 504 * psi * t491;
-        double t816 = -72 * t36 * t491;
-        double t817 = -1488 * psi * t3 * t491;
-        double t818 = 48 * t3 * t36 * t491;
-        double t819 = 1440 * t153 * t3 * t491;
-        double t820 = 1080 * psi * t161 * t491;
-        double t821 = 120 * t161 * t36 * t491;
-        double t822 = -1200 * t153 * t161 * t491;
-        double t823 = -3552 * psi * t491 * t5;
-        double t824 = 1536 * t36 * t491 * t5;
-        double t825 = 2016 * t153 * t491 * t5;
-        double t826 = 5280 * psi * t3 * t491 * t5;
-        double t827 = -1920 * t3 * t36 * t491 * t5;
-        double t828 = -3360 * t153 * t3 * t491 * t5;
-        double t829 = 6240 * psi * t266 * t491;
-        double t830 = -1920 * t153 * t266 * t491;
-        double t831 =
+        V t511 = pow(t510, -1);
+        V t522 = 36 * t167;
+        V t67 = 14 * t22;
+        V t74 = -6 * t73;
+        V t551 = -40 * psi * t167 * t73;
+        V t86 = 34 * t24;
+        V t91 = -30 * t22 * t24;
+        V t677 = 150 * t167 * t22 * t24;
+        V t718 = 360 * t153 * t161 * t22 * t24 * t5;
+        V t101 = -36 * t100;
+        V t512 = -21 * psi;
+        V t513 = 3 * t36;
+        V t514 = 84 * t3;
+        V t515 = 32 * psi * t3;
+        V t516 = 6 * t3 * t36;
+        V t517 = -2 * t153 * t3;
+        V t518 = -96 * t161;
+        V t519 = 25 * psi * t161;
+        V t520 = -15 * t161 * t36;
+        V t521 = 8 * t153 * t161;
+        V t523 = -36 * psi * t167;
+        V t524 = 6 * t167 * t36;
+        V t525 = -6 * t153 * t167;
+        V t526 = 34 * t22;
+        V t527 = 65 * psi * t22;
+        V t528 = -29 * t22 * t36;
+        V t529 = -122 * t22 * t3;
+        V t530 = -120 * psi * t22 * t3;
+        V t531 = 40 * t22 * t3 * t36;
+        V t532 = 2 * t153 * t22 * t3;
+        V t533 = 142 * t161 * t22;
+        V t534 = -21 * psi * t161 * t22;
+        V t535 = 17 * t161 * t22 * t36;
+        V t536 = -8 * t153 * t161 * t22;
+        V t537 = -54 * t167 * t22;
+        V t538 = 76 * psi * t167 * t22;
+        V t539 = -28 * t167 * t22 * t36;
+        V t540 = 6 * t153 * t167 * t22;
+        V t541 = -12 * t73;
+        V t542 = -68 * psi * t73;
+        V t543 = 52 * t36 * t73;
+        V t544 = 44 * t3 * t73;
+        V t545 = 152 * psi * t3 * t73;
+        V t546 = -116 * t3 * t36 * t73;
+        V t547 = -52 * t161 * t73;
+        V t548 = -44 * psi * t161 * t73;
+        V t549 = 44 * t161 * t36 * t73;
+        V t550 = 20 * t167 * t73;
+        V t552 = 20 * t167 * t36 * t73;
+        V t553 = 24 * psi * t208;
+        V t554 = -24 * t208 * t36;
+        V t555 = -64 * psi * t208 * t3;
+        V t556 = 64 * t208 * t3 * t36;
+        V t557 = 40 * psi * t161 * t208;
+        V t558 = -40 * t161 * t208 * t36;
+        V t559 = 228 * t5;
+        V t560 = 49 * psi * t5;
+        V t561 = -54 * t36 * t5;
+        V t562 = -(t153 * t5);
+        V t563 = -528 * t3 * t5;
+        V t564 = 228 * psi * t3 * t5;
+        V t565 = -72 * t3 * t36 * t5;
+        V t566 = 60 * t153 * t3 * t5;
+        V t567 = 24 * t159 * t3 * t5;
+        V t568 = 300 * t161 * t5;
+        V t569 = -377 * psi * t161 * t5;
+        V t570 = 162 * t161 * t36 * t5;
+        V t571 = -67 * t153 * t161 * t5;
+        V t572 = -18 * t159 * t161 * t5;
+        V t573 = -320 * t22 * t5;
+        V t574 = -309 * psi * t22 * t5;
+        V t575 = 314 * t22 * t36 * t5;
+        V t576 = -51 * t153 * t22 * t5;
+        V t577 = 760 * t22 * t3 * t5;
+        V t578 = -164 * psi * t22 * t3 * t5;
+        V t579 = -72 * t22 * t3 * t36 * t5;
+        V t580 = -20 * t153 * t22 * t3 * t5;
+        V t581 = -24 * t159 * t22 * t3 * t5;
+        V t582 = -440 * t161 * t22 * t5;
+        V t583 = 733 * psi * t161 * t22 * t5;
+        V t584 = -422 * t161 * t22 * t36 * t5;
+        V t585 = 111 * t153 * t161 * t22 * t5;
+        V t586 = 18 * t159 * t161 * t22 * t5;
+        V t587 = 112 * t5 * t73;
+        V t588 = 432 * psi * t5 * t73;
+        V t589 = -504 * t36 * t5 * t73;
+        V t590 = 104 * t153 * t5 * t73;
+        V t591 = -272 * t3 * t5 * t73;
+        V t592 = -296 * psi * t3 * t5 * t73;
+        V t593 = 504 * t3 * t36 * t5 * t73;
+        V t594 = -128 * t153 * t3 * t5 * t73;
+        V t595 = 160 * t161 * t5 * t73;
+        V t596 = -360 * psi * t161 * t5 * t73;
+        V t597 = 240 * t161 * t36 * t5 * t73;
+        V t598 = -40 * t153 * t161 * t5 * t73;
+        V t599 = -176 * psi * t208 * t5;
+        V t600 = 224 * t208 * t36 * t5;
+        V t601 = -48 * t153 * t208 * t5;
+        V t602 = 240 * psi * t208 * t3 * t5;
+        V t603 = -320 * t208 * t3 * t36 * t5;
+        V t604 = 80 * t153 * t208 * t3 * t5;
+        V t605 = -696 * t266;
+        V t606 = 416 * psi * t266;
+        V t607 = -32 * t266 * t36;
+        V t608 = 28 * t153 * t266;
+        V t609 = 20 * t159 * t266;
+        V t610 = 792 * t266 * t3;
+        V t611 = -1184 * psi * t266 * t3;
+        V t612 = 612 * t266 * t3 * t36;
+        V t613 = -184 * t153 * t266 * t3;
+        V t614 = -36 * t159 * t266 * t3;
+        V t615 = 968 * t22 * t266;
+        V t616 = -264 * psi * t22 * t266;
+        V t617 = -352 * t22 * t266 * t36;
+        V t618 = 108 * t153 * t22 * t266;
+        V t619 = -20 * t159 * t22 * t266;
+        V t620 = -1128 * t22 * t266 * t3;
+        V t621 = 2120 * psi * t22 * t266 * t3;
+        V t622 = -1396 * t22 * t266 * t3 * t36;
+        V t623 = 368 * t153 * t22 * t266 * t3;
+        V t624 = 36 * t159 * t22 * t266 * t3;
+        V t625 = -336 * t266 * t73;
+        V t626 = -448 * psi * t266 * t73;
+        V t627 = 928 * t266 * t36 * t73;
+        V t628 = -320 * t153 * t266 * t73;
+        V t629 = 400 * t266 * t3 * t73;
+        V t630 = 720 * t266 * t3 * t36 * t73;
+        V t631 = -160 * t153 * t266 * t3 * t73;
+        V t632 = 320 * psi * t208 * t266;
+        V t633 = -480 * t208 * t266 * t36;
+        V t634 = 160 * t153 * t208 * t266;
+        V t635 = 672 * t298;
+        V t636 = -1148 * psi * t298;
+        V t637 = 640 * t298 * t36;
+        V t638 = -148 * t153 * t298;
+        V t639 = -16 * t159 * t298;
+        V t640 = -928 * t22 * t298;
+        V t641 = 1916 * psi * t22 * t298;
+        V t642 = -1344 * t22 * t298 * t36;
+        V t643 = 340 * t153 * t22 * t298;
+        V t644 = 16 * t159 * t22 * t298;
+        V t645 = 320 * t298 * t73;
+        V t646 = -800 * psi * t298 * t73;
+        V t647 = 640 * t298 * t36 * t73;
+        V t648 = -160 * t153 * t298 * t73;
+        V t649 = 110 * t24;
+        V t650 = 190 * psi * t24;
+        V t651 = -86 * t24 * t36;
+        V t652 = -46 * t153 * t24;
+        V t653 = -410 * t24 * t3;
+        V t654 = -400 * psi * t24 * t3;
+        V t655 = 230 * t24 * t3 * t36;
+        V t656 = 100 * t153 * t24 * t3;
+        V t657 = 498 * t161 * t24;
+        V t658 = 34 * psi * t161 * t24;
+        V t659 = -242 * t161 * t24 * t36;
+        V t660 = 22 * t153 * t161 * t24;
+        V t661 = -198 * t167 * t24;
+        V t662 = 192 * psi * t167 * t24;
+        V t663 = 114 * t167 * t24 * t36;
+        V t664 = -108 * t153 * t167 * t24;
+        V t665 = -78 * t22 * t24;
+        V t666 = -392 * psi * t22 * t24;
+        V t667 = 200 * t22 * t24 * t36;
+        V t668 = 130 * t153 * t22 * t24;
+        V t669 = 298 * t22 * t24 * t3;
+        V t670 = 952 * psi * t22 * t24 * t3;
+        V t671 = -470 * t22 * t24 * t3 * t36;
+        V t672 = -380 * t153 * t22 * t24 * t3;
+        V t673 = -370 * t161 * t22 * t24;
+        V t674 = -392 * psi * t161 * t22 * t24;
+        V t675 = 288 * t161 * t22 * t24 * t36;
+        V t676 = 214 * t153 * t161 * t22 * t24;
+        V t678 = -200 * psi * t167 * t22 * t24;
+        V t679 = -50 * t167 * t22 * t24 * t36;
+        V t680 = 100 * t153 * t167 * t22 * t24;
+        V t681 = 204 * psi * t24 * t73;
+        V t682 = -132 * t24 * t36 * t73;
+        V t683 = -72 * t153 * t24 * t73;
+        V t684 = -568 * psi * t24 * t3 * t73;
+        V t685 = 328 * t24 * t3 * t36 * t73;
+        V t686 = 240 * t153 * t24 * t3 * t73;
+        V t687 = 380 * psi * t161 * t24 * t73;
+        V t688 = -180 * t161 * t24 * t36 * t73;
+        V t689 = -200 * t153 * t161 * t24 * t73;
+        V t690 = -1020 * t24 * t5;
+        V t691 = -918 * psi * t24 * t5;
+        V t692 = 980 * t24 * t36 * t5;
+        V t693 = 78 * t153 * t24 * t5;
+        V t694 = 16 * t159 * t24 * t5;
+        V t695 = 2504 * t24 * t3 * t5;
+        V t696 = -168 * psi * t24 * t3 * t5;
+        V t697 = -1236 * t24 * t3 * t36 * t5;
+        V t698 = 112 * t153 * t24 * t3 * t5;
+        V t699 = -60 * t159 * t24 * t3 * t5;
+        V t700 = -1500 * t161 * t24 * t5;
+        V t701 = 1894 * psi * t161 * t24 * t5;
+        V t702 = 40 * t161 * t24 * t36 * t5;
+        V t703 = -470 * t153 * t161 * t24 * t5;
+        V t704 = 36 * t159 * t161 * t24 * t5;
+        V t705 = 716 * t22 * t24 * t5;
+        V t706 = 2464 * psi * t22 * t24 * t5;
+        V t707 = -2192 * t22 * t24 * t36 * t5;
+        V t708 = -264 * t153 * t22 * t24 * t5;
+        V t709 = -4 * t159 * t22 * t24 * t5;
+        V t710 = -1800 * t22 * t24 * t3 * t5;
+        V t711 = -2032 * psi * t22 * t24 * t3 * t5;
+        V t712 = 2596 * t22 * t24 * t3 * t36 * t5;
+        V t713 = 264 * t153 * t22 * t24 * t3 * t5;
+        V t714 = 12 * t159 * t22 * t24 * t3 * t5;
+        V t715 = 1100 * t161 * t22 * t24 * t5;
+        V t716 = -1840 * psi * t161 * t22 * t24 * t5;
+        V t717 = 380 * t161 * t22 * t24 * t36 * t5;
+        V t719 = -1472 * psi * t24 * t5 * t73;
+        V t720 = 1376 * t24 * t36 * t5 * t73;
+        V t721 = 96 * t153 * t24 * t5 * t73;
+        V t722 = 2080 * psi * t24 * t3 * t5 * t73;
+        V t723 = -160 * t153 * t24 * t3 * t5 * t73;
+        V t724 = 3048 * t24 * t266;
+        V t725 = -528 * psi * t24 * t266;
+        V t726 = -1800 * t24 * t266 * t36;
+        V t727 = 384 * t153 * t24 * t266;
+        V t728 = -48 * t159 * t24 * t266;
+        V t729 = -3656 * t24 * t266 * t3;
+        V t730 = 5488 * psi * t24 * t266 * t3;
+        V t731 = -1328 * t24 * t266 * t3 * t36;
+        V t732 = -576 * t153 * t24 * t266 * t3;
+        V t733 = 72 * t159 * t24 * t266 * t3;
+        V t734 = -2120 * t22 * t24 * t266;
+        V t735 = -2624 * psi * t22 * t24 * t266;
+        V t736 = 4472 * t22 * t24 * t266 * t36;
+        V t737 = -616 * t153 * t22 * t24 * t266;
+        V t738 = 8 * t159 * t22 * t24 * t266;
+        V t739 = 2600 * t22 * t24 * t266 * t3;
+        V t740 = -4960 * psi * t22 * t24 * t266 * t3;
+        V t741 = 2120 * t22 * t24 * t266 * t3 * t36;
+        V t742 = 240 * t153 * t22 * t24 * t266 * t3;
+        V t743 = 2640 * psi * t24 * t266 * t73;
+        V t744 = -3120 * t24 * t266 * t36 * t73;
+        V t745 = 480 * t153 * t24 * t266 * t73;
+        V t746 = -2896 * t24 * t298;
+        V t747 = 4936 * psi * t24 * t298;
+        V t748 = -1936 * t24 * t298 * t36;
+        V t749 = -136 * t153 * t24 * t298;
+        V t750 = 32 * t159 * t24 * t298;
+        V t751 = 2000 * t22 * t24 * t298;
+        V t752 = -4160 * psi * t22 * t24 * t298;
+        V t753 = 2320 * t22 * t24 * t298 * t36;
+        V t754 = -160 * t153 * t22 * t24 * t298;
+        V t755 = -126 * t100;
+        V t756 = -548 * psi * t100;
+        V t757 = 210 * t100 * t36;
+        V t758 = 296 * t100 * t153;
+        V t759 = 498 * t100 * t3;
+        V t760 = 1416 * psi * t100 * t3;
+        V t761 = -590 * t100 * t3 * t36;
+        V t762 = -844 * t100 * t153 * t3;
+        V t763 = -642 * t100 * t161;
+        V t764 = -708 * psi * t100 * t161;
+        V t765 = 630 * t100 * t161 * t36;
+        V t766 = 408 * t100 * t153 * t161;
+        V t767 = 270 * t100 * t167;
+        V t768 = -240 * psi * t100 * t167;
+        V t769 = -330 * t100 * t167 * t36;
+        V t770 = 300 * t100 * t153 * t167;
+        V t771 = 564 * psi * t100 * t22;
+        V t772 = -204 * t100 * t22 * t36;
+        V t773 = -360 * t100 * t153 * t22;
+        V t774 = -1624 * psi * t100 * t22 * t3;
+        V t775 = 424 * t100 * t22 * t3 * t36;
+        V t776 = 1200 * t100 * t153 * t22 * t3;
+        V t777 = 1140 * psi * t100 * t161 * t22;
+        V t778 = -140 * t100 * t161 * t22 * t36;
+        V t779 = -1000 * t100 * t153 * t161 * t22;
+        V t780 = 1140 * t100 * t5;
+        V t781 = 3416 * psi * t100 * t5;
+        V t782 = -2596 * t100 * t36 * t5;
+        V t783 = -1088 * t100 * t153 * t5;
+        V t784 = -8 * t100 * t159 * t5;
+        V t785 = -2952 * t100 * t3 * t5;
+        V t786 = -3216 * psi * t100 * t3 * t5;
+        V t787 = 4048 * t100 * t3 * t36 * t5;
+        V t788 = 944 * t100 * t153 * t3 * t5;
+        V t789 = 24 * t100 * t159 * t3 * t5;
+        V t790 = 1860 * t100 * t161 * t5;
+        V t791 = -2280 * psi * t100 * t161 * t5;
+        V t792 = -1020 * t100 * t161 * t36 * t5;
+        V t793 = 1440 * t100 * t153 * t161 * t5;
+        V t794 = -4016 * psi * t100 * t22 * t5;
+        V t795 = 2624 * t100 * t22 * t36 * t5;
+        V t796 = 1392 * t100 * t153 * t22 * t5;
+        V t797 = 5840 * psi * t100 * t22 * t3 * t5;
+        V t798 = -3520 * t100 * t22 * t3 * t36 * t5;
+        V t799 = -2320 * t100 * t153 * t22 * t3 * t5;
+        V t800 = -3336 * t100 * t266;
+        V t801 = -3728 * psi * t100 * t266;
+        V t802 = 6056 * t100 * t266 * t36;
+        V t803 = -64 * t100 * t153 * t266;
+        V t804 = 16 * t100 * t159 * t266;
+        V t805 = 4200 * t100 * t266 * t3;
+        V t806 = -6240 * psi * t100 * t266 * t3;
+        V t807 = -120 * t100 * t266 * t3 * t36;
+        V t808 = 7120 * psi * t100 * t22 * t266;
+        V t809 = -6480 * t100 * t22 * t266 * t36;
+        V t810 = -640 * t100 * t153 * t22 * t266;
+        V t811 = 3120 * t100 * t298;
+        V t812 = -5280 * psi * t100 * t298;
+        V t813 = 1200 * t100 * t298 * t36;
+        V t814 = 960 * t100 * t153 * t298;
+        V t815 = 504 * psi * t491;
+        V t816 = -72 * t36 * t491;
+        V t817 = -1488 * psi * t3 * t491;
+        V t818 = 48 * t3 * t36 * t491;
+        V t819 = 1440 * t153 * t3 * t491;
+        V t820 = 1080 * psi * t161 * t491;
+        V t821 = 120 * t161 * t36 * t491;
+        V t822 = -1200 * t153 * t161 * t491;
+        V t823 = -3552 * psi * t491 * t5;
+        V t824 = 1536 * t36 * t491 * t5;
+        V t825 = 2016 * t153 * t491 * t5;
+        V t826 = 5280 * psi * t3 * t491 * t5;
+        V t827 = -1920 * t3 * t36 * t491 * t5;
+        V t828 = -3360 * t153 * t3 * t491 * t5;
+        V t829 = 6240 * psi * t266 * t491;
+        V t830 = -1920 * t153 * t266 * t491;
+        V t831 =
             -24 + t222 + t237 + t292 + t394 + t483 + t494 + t508 + t512 + t513 + t514 +
             t515 + t516 + t517 + t518 + t519 + t520 + t521 + t522 + t523 + t524 + t525 +
             t526 + t527 + t528 + t529 + t530 + t531 + t532 + t533 + t534 + t535 + t536 +
@@ -911,317 +949,317 @@ struct E2_1 {
             t801 + t802 + t803 + t804 + t805 + t806 + t807 + t808 + t809 + t810 + t811 +
             t812 + t813 + t814 + t815 + t816 + t817 + t818 + t819 + t820 + t821 + t822 +
             t823 + t824 + t825 + t826 + t827 + t828 + t829 + t830;
-        double t833 = -6 * psi;
-        double t834 = 8 * t36;
-        double t835 = 44 * t3;
-        double t836 = 4 * psi * t3;
-        double t837 = -37 * t3 * t36;
-        double t838 = -9 * t153 * t3;
-        double t839 = -72 * t161;
-        double t840 = 46 * psi * t161;
-        double t841 = 12 * t161 * t36;
-        double t842 = 6 * t153 * t161;
-        double t843 = -60 * psi * t167;
-        double t844 = 33 * t167 * t36;
-        double t845 = -3 * t153 * t167;
-        double t846 = 37 * psi * t22;
-        double t847 = -19 * t22 * t36;
-        double t848 = -78 * t22 * t3;
-        double t849 = -119 * psi * t22 * t3;
-        double t850 = 140 * t22 * t3 * t36;
-        double t851 = 55 * t153 * t22 * t3;
-        double t852 = 130 * t161 * t22;
-        double t853 = 35 * psi * t161 * t22;
-        double t854 = -153 * t161 * t22 * t36;
-        double t855 = -4 * t153 * t161 * t22;
-        double t856 = -66 * t167 * t22;
-        double t857 = 95 * psi * t167 * t22;
-        double t858 = -16 * t167 * t22 * t36;
-        double t859 = -19 * t153 * t167 * t22;
-        double t860 = -40 * psi * t73;
-        double t861 = -6 * t36 * t73;
-        double t862 = 34 * t3 * t73;
-        double t863 = 160 * psi * t3 * t73;
-        double t864 = -78 * t3 * t36 * t73;
-        double t865 = -58 * t161 * t73;
-        double t866 = -128 * psi * t161 * t73;
-        double t867 = 142 * t161 * t36 * t73;
-        double t868 = 30 * t167 * t73;
-        double t869 = -10 * t167 * t36 * t73;
-        double t870 = 12 * psi * t208;
-        double t871 = 12 * t208 * t36;
-        double t872 = -56 * psi * t208 * t3;
-        double t873 = -8 * t208 * t3 * t36;
-        double t874 = 60 * psi * t161 * t208;
-        double t875 = -20 * t161 * t208 * t36;
-        double t876 = 60 * t5;
-        double t877 = 26 * psi * t5;
-        double t878 = -50 * t36 * t5;
-        double t879 = -36 * t153 * t5;
-        double t880 = -224 * t3 * t5;
-        double t881 = 112 * psi * t3 * t5;
-        double t882 = 114 * t3 * t36 * t5;
-        double t883 = -10 * t153 * t3 * t5;
-        double t884 = 8 * t159 * t3 * t5;
-        double t885 = 180 * t161 * t5;
-        double t886 = -290 * psi * t161 * t5;
-        double t887 = 96 * t161 * t36 * t5;
-        double t888 = 30 * t153 * t161 * t5;
-        double t889 = -16 * t159 * t161 * t5;
-        double t890 = -104 * t22 * t5;
-        double t891 = -230 * psi * t22 * t5;
-        double t892 = 126 * t22 * t36 * t5;
-        double t893 = 208 * t153 * t22 * t5;
-        double t894 = 392 * t22 * t3 * t5;
-        double t895 = 268 * psi * t22 * t3 * t5;
-        double t896 = -606 * t22 * t3 * t36 * t5;
-        double t897 = -46 * t153 * t22 * t3 * t5;
-        double t898 = -8 * t159 * t22 * t3 * t5;
-        double t899 = -320 * t161 * t22 * t5;
-        double t900 = 370 * psi * t161 * t22 * t5;
-        double t901 = 144 * t161 * t22 * t36 * t5;
-        double t902 = -210 * t153 * t161 * t22 * t5;
-        double t903 = 16 * t159 * t161 * t22 * t5;
-        double t904 = 44 * t5 * t73;
-        double t905 = 240 * psi * t5 * t73;
-        double t906 = 84 * t36 * t5 * t73;
-        double t907 = -368 * t153 * t5 * t73;
-        double t908 = -168 * t3 * t5 * t73;
-        double t909 = -472 * psi * t3 * t5 * t73;
-        double t910 = 304 * t3 * t36 * t5 * t73;
-        double t911 = 336 * t153 * t3 * t5 * t73;
-        double t912 = 140 * t161 * t5 * t73;
-        double t913 = -120 * psi * t161 * t5 * t73;
-        double t914 = -180 * t161 * t36 * t5 * t73;
-        double t915 = 160 * t153 * t161 * t5 * t73;
-        double t916 = -64 * psi * t208 * t5;
-        double t917 = -112 * t208 * t36 * t5;
-        double t918 = 176 * t153 * t208 * t5;
-        double t919 = 160 * psi * t208 * t3 * t5;
-        double t920 = 80 * t208 * t3 * t36 * t5;
-        double t921 = -240 * t153 * t208 * t3 * t5;
-        double t922 = -144 * t266;
-        double t923 = -8 * psi * t266;
-        double t924 = 144 * t266 * t36;
-        double t925 = 4 * t153 * t266;
-        double t926 = 4 * t159 * t266;
-        double t927 = 272 * t266 * t3;
-        double t928 = -360 * psi * t266 * t3;
-        double t929 = -56 * t266 * t3 * t36;
-        double t930 = 164 * t153 * t266 * t3;
-        double t931 = -20 * t159 * t266 * t3;
-        double t932 = 248 * t22 * t266;
-        double t933 = 412 * psi * t22 * t266;
-        double t934 = -476 * t22 * t266 * t36;
-        double t935 = -180 * t153 * t22 * t266;
-        double t936 = -4 * t159 * t22 * t266;
-        double t937 = -472 * t22 * t266 * t3;
-        double t938 = 260 * psi * t22 * t266 * t3;
-        double t939 = 820 * t22 * t266 * t3 * t36;
-        double t940 = -628 * t153 * t22 * t266 * t3;
-        double t941 = 20 * t159 * t22 * t266 * t3;
-        double t942 = -104 * t266 * t73;
-        double t943 = -400 * psi * t266 * t73;
-        double t944 = -56 * t266 * t36 * t73;
-        double t945 = 560 * t153 * t266 * t73;
-        double t946 = 200 * t266 * t3 * t73;
-        double t947 = -600 * t266 * t3 * t36 * t73;
-        double t948 = 400 * t153 * t266 * t3 * t73;
-        double t949 = 80 * psi * t208 * t266;
-        double t950 = 240 * t208 * t266 * t36;
-        double t951 = -320 * t153 * t208 * t266;
-        double t952 = 112 * t298;
-        double t953 = -40 * psi * t298;
-        double t954 = -248 * t298 * t36;
-        double t955 = 184 * t153 * t298;
-        double t956 = -8 * t159 * t298;
-        double t957 = -192 * t22 * t298;
-        double t958 = -200 * psi * t22 * t298;
-        double t959 = 952 * t22 * t298 * t36;
-        double t960 = -568 * t153 * t22 * t298;
-        double t961 = 8 * t159 * t22 * t298;
-        double t962 = 80 * t298 * t73;
-        double t963 = 160 * psi * t298 * t73;
-        double t964 = -560 * t298 * t36 * t73;
-        double t965 = 320 * t153 * t298 * t73;
-        double t966 = 45 * psi * t24;
-        double t967 = -46 * t24 * t36;
-        double t968 = -35 * t153 * t24;
-        double t969 = -190 * t24 * t3;
-        double t970 = -87 * psi * t24 * t3;
-        double t971 = 255 * t24 * t3 * t36;
-        double t972 = 26 * t153 * t24 * t3;
-        double t973 = 318 * t161 * t24;
-        double t974 = -197 * psi * t161 * t24;
-        double t975 = -108 * t161 * t24 * t36;
-        double t976 = -3 * t153 * t161 * t24;
-        double t977 = -162 * t167 * t24;
-        double t978 = 351 * psi * t167 * t24;
-        double t979 = -249 * t167 * t24 * t36;
-        double t980 = 48 * t153 * t167 * t24;
-        double t981 = -160 * psi * t22 * t24;
-        double t982 = 51 * t22 * t24 * t36;
-        double t983 = 141 * t153 * t22 * t24;
-        double t984 = 170 * t22 * t24 * t3;
-        double t985 = 616 * psi * t22 * t24 * t3;
-        double t986 = -580 * t22 * t24 * t3 * t36;
-        double t987 = -214 * t153 * t22 * t24 * t3;
-        double t988 = -290 * t161 * t22 * t24;
-        double t989 = -400 * psi * t161 * t22 * t24;
-        double t990 = 711 * t161 * t22 * t24 * t36;
-        double t991 = -15 * t153 * t161 * t22 * t24;
-        double t992 = -280 * psi * t167 * t22 * t24;
-        double t993 = 110 * t167 * t22 * t24 * t36;
-        double t994 = 20 * t153 * t167 * t22 * t24;
-        double t995 = 84 * psi * t24 * t73;
-        double t996 = 36 * t24 * t36 * t73;
-        double t997 = -120 * t153 * t24 * t73;
-        double t998 = -392 * psi * t24 * t3 * t73;
-        double t999 = 120 * t24 * t3 * t36 * t73;
-        double t1000 = 272 * t153 * t24 * t3 * t73;
-        double t1001 = 420 * psi * t161 * t24 * t73;
-        double t1002 = -300 * t161 * t24 * t36 * t73;
-        double t1003 = -120 * t153 * t161 * t24 * t73;
-        double t1004 = -252 * t24 * t5;
-        double t1005 = -198 * psi * t24 * t5;
-        double t1006 = 174 * t24 * t36 * t5;
-        double t1007 = 288 * t153 * t24 * t5;
-        double t1008 = -12 * t159 * t24 * t5;
-        double t1009 = 952 * t24 * t3 * t5;
-        double t1010 = -388 * psi * t24 * t3 * t5;
-        double t1011 = -476 * t24 * t3 * t36 * t5;
-        double t1012 = -100 * t153 * t24 * t3 * t5;
-        double t1013 = 12 * t159 * t24 * t3 * t5;
-        double t1014 = -780 * t161 * t24 * t5;
-        double t1015 = 1570 * psi * t161 * t24 * t5;
-        double t1016 = -882 * t161 * t24 * t36 * t5;
-        double t1017 = 60 * t153 * t161 * t24 * t5;
-        double t1018 = 32 * t159 * t161 * t24 * t5;
-        double t1019 = 220 * t22 * t24 * t5;
-        double t1020 = 912 * psi * t22 * t24 * t5;
-        double t1021 = -56 * t22 * t24 * t36 * t5;
-        double t1022 = -1088 * t153 * t22 * t24 * t5;
-        double t1023 = 12 * t159 * t22 * t24 * t5;
-        double t1024 = -840 * t22 * t24 * t3 * t5;
-        double t1025 = -1536 * psi * t22 * t24 * t3 * t5;
-        double t1026 = 1700 * t22 * t24 * t3 * t36 * t5;
-        double t1027 = 704 * t153 * t22 * t24 * t3 * t5;
-        double t1028 = -28 * t159 * t22 * t24 * t3 * t5;
-        double t1029 = 700 * t161 * t22 * t24 * t5;
-        double t1030 = -1040 * psi * t161 * t22 * t24 * t5;
-        double t1031 = -20 * t161 * t22 * t24 * t36 * t5;
-        double t1032 = -448 * psi * t24 * t5 * t73;
-        double t1033 = -480 * t24 * t36 * t5 * t73;
-        double t1034 = 928 * t153 * t24 * t5 * t73;
-        double t1035 = 1120 * psi * t24 * t3 * t5 * t73;
-        double t1036 = -1120 * t153 * t24 * t3 * t5 * t73;
-        double t1037 = 600 * t24 * t266;
-        double t1038 = 60 * psi * t24 * t266;
-        double t1039 = -256 * t24 * t266 * t36;
-        double t1040 = -412 * t153 * t24 * t266;
-        double t1041 = 8 * t159 * t24 * t266;
-        double t1042 = -1144 * t24 * t266 * t3;
-        double t1043 = 1892 * psi * t24 * t266 * t3;
-        double t1044 = -404 * t24 * t266 * t3 * t36;
-        double t1045 = -384 * t153 * t24 * t266 * t3;
-        double t1046 = 40 * t159 * t24 * t266 * t3;
-        double t1047 = -520 * t22 * t24 * t266;
-        double t1048 = -1344 * psi * t22 * t24 * t266;
-        double t1049 = 124 * t22 * t24 * t266 * t36;
-        double t1050 = 1756 * t153 * t22 * t24 * t266;
-        double t1051 = -16 * t159 * t22 * t24 * t266;
-        double t1052 = 1000 * t22 * t24 * t266 * t3;
-        double t1053 = -800 * psi * t22 * t24 * t266 * t3;
-        double t1054 = -1400 * t22 * t24 * t266 * t3 * t36;
-        double t1055 = 1200 * t153 * t22 * t24 * t266 * t3;
-        double t1056 = 560 * psi * t24 * t266 * t73;
-        double t1057 = 1200 * t24 * t266 * t36 * t73;
-        double t1058 = -1760 * t153 * t24 * t266 * t73;
-        double t1059 = -464 * t24 * t298;
-        double t1060 = 312 * psi * t24 * t298;
-        double t1061 = 760 * t24 * t298 * t36;
-        double t1062 = -624 * t153 * t24 * t298;
-        double t1063 = 16 * t159 * t24 * t298;
-        double t1064 = 400 * t22 * t24 * t298;
-        double t1065 = 320 * psi * t22 * t24 * t298;
-        double t1066 = -1840 * t22 * t24 * t298 * t36;
-        double t1067 = 1120 * t153 * t22 * t24 * t298;
-        double t1068 = -136 * psi * t100;
-        double t1069 = 126 * t100 * t36;
-        double t1070 = 50 * t100 * t153;
-        double t1071 = 204 * t100 * t3;
-        double t1072 = 480 * psi * t100 * t3;
-        double t1073 = -800 * t100 * t3 * t36;
-        double t1074 = 100 * t100 * t153 * t3;
-        double t1075 = -348 * t100 * t161;
-        double t1076 = -120 * psi * t100 * t161;
-        double t1077 = 678 * t100 * t161 * t36;
-        double t1078 = -198 * t100 * t153 * t161;
-        double t1079 = 180 * t100 * t167;
-        double t1080 = -480 * psi * t100 * t167;
-        double t1081 = 420 * t100 * t167 * t36;
-        double t1082 = -120 * t100 * t153 * t167;
-        double t1083 = 192 * psi * t100 * t22;
-        double t1084 = -48 * t100 * t22 * t36;
-        double t1085 = -144 * t100 * t153 * t22;
-        double t1086 = -896 * psi * t100 * t22 * t3;
-        double t1087 = 752 * t100 * t22 * t3 * t36;
-        double t1088 = 144 * t100 * t153 * t22 * t3;
-        double t1089 = 960 * psi * t100 * t161 * t22;
-        double t1090 = -1120 * t100 * t161 * t22 * t36;
-        double t1091 = 160 * t100 * t153 * t161 * t22;
-        double t1092 = 264 * t100 * t5;
-        double t1093 = 664 * psi * t100 * t5;
-        double t1094 = -352 * t100 * t36 * t5;
-        double t1095 = -600 * t100 * t153 * t5;
-        double t1096 = 24 * t100 * t159 * t5;
-        double t1097 = -1008 * t100 * t3 * t5;
-        double t1098 = -576 * psi * t100 * t3 * t5;
-        double t1099 = 1528 * t100 * t3 * t36 * t5;
-        double t1100 = 112 * t100 * t153 * t3 * t5;
-        double t1101 = -56 * t100 * t159 * t3 * t5;
-        double t1102 = 840 * t100 * t161 * t5;
-        double t1103 = -2040 * psi * t100 * t161 * t5;
-        double t1104 = 1560 * t100 * t161 * t36 * t5;
-        double t1105 = -360 * t100 * t153 * t161 * t5;
-        double t1106 = -1024 * psi * t100 * t22 * t5;
-        double t1107 = -272 * t100 * t22 * t36 * t5;
-        double t1108 = 1296 * t100 * t153 * t22 * t5;
-        double t1109 = 2560 * psi * t100 * t22 * t3 * t5;
-        double t1110 = -1520 * t100 * t22 * t3 * t36 * t5;
-        double t1111 = -1040 * t100 * t153 * t22 * t3 * t5;
-        double t1112 = -624 * t100 * t266;
-        double t1113 = -544 * psi * t100 * t266;
-        double t1114 = -136 * t100 * t266 * t36;
-        double t1115 = 1336 * t100 * t153 * t266;
-        double t1116 = -32 * t100 * t159 * t266;
-        double t1117 = 1200 * t100 * t266 * t3;
-        double t1118 = -2400 * psi * t100 * t266 * t3;
-        double t1119 = 1200 * t100 * t266 * t3 * t36;
-        double t1120 = 1280 * psi * t100 * t22 * t266;
-        double t1121 = 1440 * t100 * t22 * t266 * t36;
-        double t1122 = -2720 * t100 * t153 * t22 * t266;
-        double t1123 = 480 * t100 * t298;
-        double t1124 = -480 * psi * t100 * t298;
-        double t1125 = -480 * t100 * t298 * t36;
-        double t1126 = 480 * t100 * t153 * t298;
-        double t1127 = 144 * psi * t491;
-        double t1128 = -144 * t36 * t491;
-        double t1129 = -672 * psi * t3 * t491;
-        double t1130 = 960 * t3 * t36 * t491;
-        double t1131 = -288 * t153 * t3 * t491;
-        double t1132 = 720 * psi * t161 * t491;
-        double t1133 = -1200 * t161 * t36 * t491;
-        double t1134 = 480 * t153 * t161 * t491;
-        double t1135 = -768 * psi * t491 * t5;
-        double t1136 = 480 * t36 * t491 * t5;
-        double t1137 = 288 * t153 * t491 * t5;
-        double t1138 = 1920 * psi * t3 * t491 * t5;
-        double t1139 = -2400 * t3 * t36 * t491 * t5;
-        double t1140 = 480 * t153 * t3 * t491 * t5;
-        double t1141 = 960 * psi * t266 * t491;
-        double t1142 = -960 * t153 * t266 * t491;
-        double t1143 =
+        V t833 = -6 * psi;
+        V t834 = 8 * t36;
+        V t835 = 44 * t3;
+        V t836 = 4 * psi * t3;
+        V t837 = -37 * t3 * t36;
+        V t838 = -9 * t153 * t3;
+        V t839 = -72 * t161;
+        V t840 = 46 * psi * t161;
+        V t841 = 12 * t161 * t36;
+        V t842 = 6 * t153 * t161;
+        V t843 = -60 * psi * t167;
+        V t844 = 33 * t167 * t36;
+        V t845 = -3 * t153 * t167;
+        V t846 = 37 * psi * t22;
+        V t847 = -19 * t22 * t36;
+        V t848 = -78 * t22 * t3;
+        V t849 = -119 * psi * t22 * t3;
+        V t850 = 140 * t22 * t3 * t36;
+        V t851 = 55 * t153 * t22 * t3;
+        V t852 = 130 * t161 * t22;
+        V t853 = 35 * psi * t161 * t22;
+        V t854 = -153 * t161 * t22 * t36;
+        V t855 = -4 * t153 * t161 * t22;
+        V t856 = -66 * t167 * t22;
+        V t857 = 95 * psi * t167 * t22;
+        V t858 = -16 * t167 * t22 * t36;
+        V t859 = -19 * t153 * t167 * t22;
+        V t860 = -40 * psi * t73;
+        V t861 = -6 * t36 * t73;
+        V t862 = 34 * t3 * t73;
+        V t863 = 160 * psi * t3 * t73;
+        V t864 = -78 * t3 * t36 * t73;
+        V t865 = -58 * t161 * t73;
+        V t866 = -128 * psi * t161 * t73;
+        V t867 = 142 * t161 * t36 * t73;
+        V t868 = 30 * t167 * t73;
+        V t869 = -10 * t167 * t36 * t73;
+        V t870 = 12 * psi * t208;
+        V t871 = 12 * t208 * t36;
+        V t872 = -56 * psi * t208 * t3;
+        V t873 = -8 * t208 * t3 * t36;
+        V t874 = 60 * psi * t161 * t208;
+        V t875 = -20 * t161 * t208 * t36;
+        V t876 = 60 * t5;
+        V t877 = 26 * psi * t5;
+        V t878 = -50 * t36 * t5;
+        V t879 = -36 * t153 * t5;
+        V t880 = -224 * t3 * t5;
+        V t881 = 112 * psi * t3 * t5;
+        V t882 = 114 * t3 * t36 * t5;
+        V t883 = -10 * t153 * t3 * t5;
+        V t884 = 8 * t159 * t3 * t5;
+        V t885 = 180 * t161 * t5;
+        V t886 = -290 * psi * t161 * t5;
+        V t887 = 96 * t161 * t36 * t5;
+        V t888 = 30 * t153 * t161 * t5;
+        V t889 = -16 * t159 * t161 * t5;
+        V t890 = -104 * t22 * t5;
+        V t891 = -230 * psi * t22 * t5;
+        V t892 = 126 * t22 * t36 * t5;
+        V t893 = 208 * t153 * t22 * t5;
+        V t894 = 392 * t22 * t3 * t5;
+        V t895 = 268 * psi * t22 * t3 * t5;
+        V t896 = -606 * t22 * t3 * t36 * t5;
+        V t897 = -46 * t153 * t22 * t3 * t5;
+        V t898 = -8 * t159 * t22 * t3 * t5;
+        V t899 = -320 * t161 * t22 * t5;
+        V t900 = 370 * psi * t161 * t22 * t5;
+        V t901 = 144 * t161 * t22 * t36 * t5;
+        V t902 = -210 * t153 * t161 * t22 * t5;
+        V t903 = 16 * t159 * t161 * t22 * t5;
+        V t904 = 44 * t5 * t73;
+        V t905 = 240 * psi * t5 * t73;
+        V t906 = 84 * t36 * t5 * t73;
+        V t907 = -368 * t153 * t5 * t73;
+        V t908 = -168 * t3 * t5 * t73;
+        V t909 = -472 * psi * t3 * t5 * t73;
+        V t910 = 304 * t3 * t36 * t5 * t73;
+        V t911 = 336 * t153 * t3 * t5 * t73;
+        V t912 = 140 * t161 * t5 * t73;
+        V t913 = -120 * psi * t161 * t5 * t73;
+        V t914 = -180 * t161 * t36 * t5 * t73;
+        V t915 = 160 * t153 * t161 * t5 * t73;
+        V t916 = -64 * psi * t208 * t5;
+        V t917 = -112 * t208 * t36 * t5;
+        V t918 = 176 * t153 * t208 * t5;
+        V t919 = 160 * psi * t208 * t3 * t5;
+        V t920 = 80 * t208 * t3 * t36 * t5;
+        V t921 = -240 * t153 * t208 * t3 * t5;
+        V t922 = -144 * t266;
+        V t923 = -8 * psi * t266;
+        V t924 = 144 * t266 * t36;
+        V t925 = 4 * t153 * t266;
+        V t926 = 4 * t159 * t266;
+        V t927 = 272 * t266 * t3;
+        V t928 = -360 * psi * t266 * t3;
+        V t929 = -56 * t266 * t3 * t36;
+        V t930 = 164 * t153 * t266 * t3;
+        V t931 = -20 * t159 * t266 * t3;
+        V t932 = 248 * t22 * t266;
+        V t933 = 412 * psi * t22 * t266;
+        V t934 = -476 * t22 * t266 * t36;
+        V t935 = -180 * t153 * t22 * t266;
+        V t936 = -4 * t159 * t22 * t266;
+        V t937 = -472 * t22 * t266 * t3;
+        V t938 = 260 * psi * t22 * t266 * t3;
+        V t939 = 820 * t22 * t266 * t3 * t36;
+        V t940 = -628 * t153 * t22 * t266 * t3;
+        V t941 = 20 * t159 * t22 * t266 * t3;
+        V t942 = -104 * t266 * t73;
+        V t943 = -400 * psi * t266 * t73;
+        V t944 = -56 * t266 * t36 * t73;
+        V t945 = 560 * t153 * t266 * t73;
+        V t946 = 200 * t266 * t3 * t73;
+        V t947 = -600 * t266 * t3 * t36 * t73;
+        V t948 = 400 * t153 * t266 * t3 * t73;
+        V t949 = 80 * psi * t208 * t266;
+        V t950 = 240 * t208 * t266 * t36;
+        V t951 = -320 * t153 * t208 * t266;
+        V t952 = 112 * t298;
+        V t953 = -40 * psi * t298;
+        V t954 = -248 * t298 * t36;
+        V t955 = 184 * t153 * t298;
+        V t956 = -8 * t159 * t298;
+        V t957 = -192 * t22 * t298;
+        V t958 = -200 * psi * t22 * t298;
+        V t959 = 952 * t22 * t298 * t36;
+        V t960 = -568 * t153 * t22 * t298;
+        V t961 = 8 * t159 * t22 * t298;
+        V t962 = 80 * t298 * t73;
+        V t963 = 160 * psi * t298 * t73;
+        V t964 = -560 * t298 * t36 * t73;
+        V t965 = 320 * t153 * t298 * t73;
+        V t966 = 45 * psi * t24;
+        V t967 = -46 * t24 * t36;
+        V t968 = -35 * t153 * t24;
+        V t969 = -190 * t24 * t3;
+        V t970 = -87 * psi * t24 * t3;
+        V t971 = 255 * t24 * t3 * t36;
+        V t972 = 26 * t153 * t24 * t3;
+        V t973 = 318 * t161 * t24;
+        V t974 = -197 * psi * t161 * t24;
+        V t975 = -108 * t161 * t24 * t36;
+        V t976 = -3 * t153 * t161 * t24;
+        V t977 = -162 * t167 * t24;
+        V t978 = 351 * psi * t167 * t24;
+        V t979 = -249 * t167 * t24 * t36;
+        V t980 = 48 * t153 * t167 * t24;
+        V t981 = -160 * psi * t22 * t24;
+        V t982 = 51 * t22 * t24 * t36;
+        V t983 = 141 * t153 * t22 * t24;
+        V t984 = 170 * t22 * t24 * t3;
+        V t985 = 616 * psi * t22 * t24 * t3;
+        V t986 = -580 * t22 * t24 * t3 * t36;
+        V t987 = -214 * t153 * t22 * t24 * t3;
+        V t988 = -290 * t161 * t22 * t24;
+        V t989 = -400 * psi * t161 * t22 * t24;
+        V t990 = 711 * t161 * t22 * t24 * t36;
+        V t991 = -15 * t153 * t161 * t22 * t24;
+        V t992 = -280 * psi * t167 * t22 * t24;
+        V t993 = 110 * t167 * t22 * t24 * t36;
+        V t994 = 20 * t153 * t167 * t22 * t24;
+        V t995 = 84 * psi * t24 * t73;
+        V t996 = 36 * t24 * t36 * t73;
+        V t997 = -120 * t153 * t24 * t73;
+        V t998 = -392 * psi * t24 * t3 * t73;
+        V t999 = 120 * t24 * t3 * t36 * t73;
+        V t1000 = 272 * t153 * t24 * t3 * t73;
+        V t1001 = 420 * psi * t161 * t24 * t73;
+        V t1002 = -300 * t161 * t24 * t36 * t73;
+        V t1003 = -120 * t153 * t161 * t24 * t73;
+        V t1004 = -252 * t24 * t5;
+        V t1005 = -198 * psi * t24 * t5;
+        V t1006 = 174 * t24 * t36 * t5;
+        V t1007 = 288 * t153 * t24 * t5;
+        V t1008 = -12 * t159 * t24 * t5;
+        V t1009 = 952 * t24 * t3 * t5;
+        V t1010 = -388 * psi * t24 * t3 * t5;
+        V t1011 = -476 * t24 * t3 * t36 * t5;
+        V t1012 = -100 * t153 * t24 * t3 * t5;
+        V t1013 = 12 * t159 * t24 * t3 * t5;
+        V t1014 = -780 * t161 * t24 * t5;
+        V t1015 = 1570 * psi * t161 * t24 * t5;
+        V t1016 = -882 * t161 * t24 * t36 * t5;
+        V t1017 = 60 * t153 * t161 * t24 * t5;
+        V t1018 = 32 * t159 * t161 * t24 * t5;
+        V t1019 = 220 * t22 * t24 * t5;
+        V t1020 = 912 * psi * t22 * t24 * t5;
+        V t1021 = -56 * t22 * t24 * t36 * t5;
+        V t1022 = -1088 * t153 * t22 * t24 * t5;
+        V t1023 = 12 * t159 * t22 * t24 * t5;
+        V t1024 = -840 * t22 * t24 * t3 * t5;
+        V t1025 = -1536 * psi * t22 * t24 * t3 * t5;
+        V t1026 = 1700 * t22 * t24 * t3 * t36 * t5;
+        V t1027 = 704 * t153 * t22 * t24 * t3 * t5;
+        V t1028 = -28 * t159 * t22 * t24 * t3 * t5;
+        V t1029 = 700 * t161 * t22 * t24 * t5;
+        V t1030 = -1040 * psi * t161 * t22 * t24 * t5;
+        V t1031 = -20 * t161 * t22 * t24 * t36 * t5;
+        V t1032 = -448 * psi * t24 * t5 * t73;
+        V t1033 = -480 * t24 * t36 * t5 * t73;
+        V t1034 = 928 * t153 * t24 * t5 * t73;
+        V t1035 = 1120 * psi * t24 * t3 * t5 * t73;
+        V t1036 = -1120 * t153 * t24 * t3 * t5 * t73;
+        V t1037 = 600 * t24 * t266;
+        V t1038 = 60 * psi * t24 * t266;
+        V t1039 = -256 * t24 * t266 * t36;
+        V t1040 = -412 * t153 * t24 * t266;
+        V t1041 = 8 * t159 * t24 * t266;
+        V t1042 = -1144 * t24 * t266 * t3;
+        V t1043 = 1892 * psi * t24 * t266 * t3;
+        V t1044 = -404 * t24 * t266 * t3 * t36;
+        V t1045 = -384 * t153 * t24 * t266 * t3;
+        V t1046 = 40 * t159 * t24 * t266 * t3;
+        V t1047 = -520 * t22 * t24 * t266;
+        V t1048 = -1344 * psi * t22 * t24 * t266;
+        V t1049 = 124 * t22 * t24 * t266 * t36;
+        V t1050 = 1756 * t153 * t22 * t24 * t266;
+        V t1051 = -16 * t159 * t22 * t24 * t266;
+        V t1052 = 1000 * t22 * t24 * t266 * t3;
+        V t1053 = -800 * psi * t22 * t24 * t266 * t3;
+        V t1054 = -1400 * t22 * t24 * t266 * t3 * t36;
+        V t1055 = 1200 * t153 * t22 * t24 * t266 * t3;
+        V t1056 = 560 * psi * t24 * t266 * t73;
+        V t1057 = 1200 * t24 * t266 * t36 * t73;
+        V t1058 = -1760 * t153 * t24 * t266 * t73;
+        V t1059 = -464 * t24 * t298;
+        V t1060 = 312 * psi * t24 * t298;
+        V t1061 = 760 * t24 * t298 * t36;
+        V t1062 = -624 * t153 * t24 * t298;
+        V t1063 = 16 * t159 * t24 * t298;
+        V t1064 = 400 * t22 * t24 * t298;
+        V t1065 = 320 * psi * t22 * t24 * t298;
+        V t1066 = -1840 * t22 * t24 * t298 * t36;
+        V t1067 = 1120 * t153 * t22 * t24 * t298;
+        V t1068 = -136 * psi * t100;
+        V t1069 = 126 * t100 * t36;
+        V t1070 = 50 * t100 * t153;
+        V t1071 = 204 * t100 * t3;
+        V t1072 = 480 * psi * t100 * t3;
+        V t1073 = -800 * t100 * t3 * t36;
+        V t1074 = 100 * t100 * t153 * t3;
+        V t1075 = -348 * t100 * t161;
+        V t1076 = -120 * psi * t100 * t161;
+        V t1077 = 678 * t100 * t161 * t36;
+        V t1078 = -198 * t100 * t153 * t161;
+        V t1079 = 180 * t100 * t167;
+        V t1080 = -480 * psi * t100 * t167;
+        V t1081 = 420 * t100 * t167 * t36;
+        V t1082 = -120 * t100 * t153 * t167;
+        V t1083 = 192 * psi * t100 * t22;
+        V t1084 = -48 * t100 * t22 * t36;
+        V t1085 = -144 * t100 * t153 * t22;
+        V t1086 = -896 * psi * t100 * t22 * t3;
+        V t1087 = 752 * t100 * t22 * t3 * t36;
+        V t1088 = 144 * t100 * t153 * t22 * t3;
+        V t1089 = 960 * psi * t100 * t161 * t22;
+        V t1090 = -1120 * t100 * t161 * t22 * t36;
+        V t1091 = 160 * t100 * t153 * t161 * t22;
+        V t1092 = 264 * t100 * t5;
+        V t1093 = 664 * psi * t100 * t5;
+        V t1094 = -352 * t100 * t36 * t5;
+        V t1095 = -600 * t100 * t153 * t5;
+        V t1096 = 24 * t100 * t159 * t5;
+        V t1097 = -1008 * t100 * t3 * t5;
+        V t1098 = -576 * psi * t100 * t3 * t5;
+        V t1099 = 1528 * t100 * t3 * t36 * t5;
+        V t1100 = 112 * t100 * t153 * t3 * t5;
+        V t1101 = -56 * t100 * t159 * t3 * t5;
+        V t1102 = 840 * t100 * t161 * t5;
+        V t1103 = -2040 * psi * t100 * t161 * t5;
+        V t1104 = 1560 * t100 * t161 * t36 * t5;
+        V t1105 = -360 * t100 * t153 * t161 * t5;
+        V t1106 = -1024 * psi * t100 * t22 * t5;
+        V t1107 = -272 * t100 * t22 * t36 * t5;
+        V t1108 = 1296 * t100 * t153 * t22 * t5;
+        V t1109 = 2560 * psi * t100 * t22 * t3 * t5;
+        V t1110 = -1520 * t100 * t22 * t3 * t36 * t5;
+        V t1111 = -1040 * t100 * t153 * t22 * t3 * t5;
+        V t1112 = -624 * t100 * t266;
+        V t1113 = -544 * psi * t100 * t266;
+        V t1114 = -136 * t100 * t266 * t36;
+        V t1115 = 1336 * t100 * t153 * t266;
+        V t1116 = -32 * t100 * t159 * t266;
+        V t1117 = 1200 * t100 * t266 * t3;
+        V t1118 = -2400 * psi * t100 * t266 * t3;
+        V t1119 = 1200 * t100 * t266 * t3 * t36;
+        V t1120 = 1280 * psi * t100 * t22 * t266;
+        V t1121 = 1440 * t100 * t22 * t266 * t36;
+        V t1122 = -2720 * t100 * t153 * t22 * t266;
+        V t1123 = 480 * t100 * t298;
+        V t1124 = -480 * psi * t100 * t298;
+        V t1125 = -480 * t100 * t298 * t36;
+        V t1126 = 480 * t100 * t153 * t298;
+        V t1127 = 144 * psi * t491;
+        V t1128 = -144 * t36 * t491;
+        V t1129 = -672 * psi * t3 * t491;
+        V t1130 = 960 * t3 * t36 * t491;
+        V t1131 = -288 * t153 * t3 * t491;
+        V t1132 = 720 * psi * t161 * t491;
+        V t1133 = -1200 * t161 * t36 * t491;
+        V t1134 = 480 * t153 * t161 * t491;
+        V t1135 = -768 * psi * t491 * t5;
+        V t1136 = 480 * t36 * t491 * t5;
+        V t1137 = 288 * t153 * t491 * t5;
+        V t1138 = 1920 * psi * t3 * t491 * t5;
+        V t1139 = -2400 * t3 * t36 * t491 * t5;
+        V t1140 = 480 * t153 * t3 * t491 * t5;
+        V t1141 = 960 * psi * t266 * t491;
+        V t1142 = -960 * t153 * t266 * t491;
+        V t1143 =
             -8 + t1000 + t1001 + t1002 + t1003 + t1004 + t1005 + t1006 + t1007 + t1008 +
             t1009 + t101 + t1010 + t1011 + t1012 + t1013 + t1014 + t1015 + t1016 + t1017 +
             t1018 + t1019 + t1020 + t1021 + t1022 + t1023 + t1024 + t1025 + t1026 +
@@ -1256,7 +1294,7 @@ struct E2_1 {
             t967 + t968 + t969 + t970 + t971 + t972 + t973 + t974 + t975 + t976 + t977 +
             t978 + t979 + t980 + t981 + t982 + t983 + t984 + t985 + t986 + t987 + t988 +
             t989 + t990 + t991 + t992 + t993 + t994 + t995 + t996 + t997 + t998 + t999;
-        double t1144 = (3 * t1143 * t511) / 2.;
+        V t1144 = (3 * t1143 * t511) / 2.;
         c[0] = -1 + t3 + t9;
         c[1] = -(psi * (-1 + 2 * t3 + 3 * t5));
         c[2] = 1 + t11 + t12 + t13 + t14 + 3 * psi * t5;
@@ -1317,399 +1355,408 @@ struct E2_1 {
     std::span<const real>
     nbs_dirichlet(real h, real psi, std::span<real> c, bool right) const
     {
-        double t3 = alpha[0];
-        double t5 = alpha[2];
-        double t17 = -1 + psi;
-        double t11 = -psi;
-        double t22 = alpha[1];
-        double t9 = 2 * t5;
-        double t24 = alpha[3];
-        double t28 = 1 + psi;
-        double t29 = std::pow(t28, -1);
-        double t12 = -2 * t3;
-        double t36 = std::pow(psi, 2);
-        double t14 = -3 * t5;
-        double t18 = -(t17 * t3);
-        double t21 = -(t17 * t5);
-        double t53 = -6 * t3;
-        double t54 = -3 * t22;
-        double t55 = 5 * t22 * t3;
-        double t56 = -14 * t5;
-        double t57 = 10 * t22 * t5;
-        double t58 = -9 * t24;
-        double t59 = 15 * t24 * t3;
-        double t60 = 30 * t24 * t5;
-        double t61 = 4 + t53 + t54 + t55 + t56 + t57 + t58 + t59 + t60;
-        double t62 = std::pow(t61, -1);
-        double t37 = -t36;
-        double t73 = std::pow(t22, 2);
-        double t44 = 2 * t24 * t36;
-        double t100 = std::pow(t24, 2);
-        double t49 = 3 * t3;
-        double t50 = -1 + t49 + t9;
-        double t51 = 2 * t24;
-        double t52 = -1 + t22 + t51;
-        double t13 = 3 * psi * t3;
-        double t153 = std::pow(psi, 3);
-        double t161 = std::pow(t3, 2);
-        double t159 = std::pow(psi, 4);
-        double t167 = std::pow(t3, 3);
-        double t208 = std::pow(t22, 3);
-        double t266 = std::pow(t5, 2);
-        double t298 = std::pow(t5, 3);
-        double t491 = std::pow(t24, 3);
-        double t222 = -6 * t159 * t5;
-        double t237 = 6 * t159 * t22 * t5;
-        double t292 = -960 * psi * t266 * t3 * t73;
-        double t394 = -1920 * t24 * t3 * t36 * t5 * t73;
-        double t483 = 2160 * t100 * t153 * t266 * t3;
-        double t494 = -432 * t153 * t491;
-        double t508 = -4320 * t266 * t36 * t491;
-        double t151 = -27 * psi;
-        double t152 = 11 * t36;
-        double t154 = 6 * t153;
-        double t155 = 128 * t3;
-        double t156 = 36 * psi * t3;
-        double t157 = -31 * t3 * t36;
-        double t158 = -11 * t153 * t3;
-        double t160 = -2 * t159 * t3;
-        double t162 = -168 * t161;
-        double t163 = 71 * psi * t161;
-        double t164 = -3 * t161 * t36;
-        double t165 = 14 * t153 * t161;
-        double t166 = 8 * t159 * t161;
-        double t168 = 72 * t167;
-        double t169 = -96 * psi * t167;
-        double t170 = 39 * t167 * t36;
-        double t171 = -9 * t153 * t167;
-        double t172 = -6 * t159 * t167;
-        double t173 = 48 * t22;
-        double t174 = 102 * psi * t22;
-        double t175 = -48 * t22 * t36;
-        double t176 = -32 * t153 * t22;
-        double t177 = -200 * t22 * t3;
-        double t178 = -239 * psi * t22 * t3;
-        double t179 = 180 * t22 * t3 * t36;
-        double t180 = 57 * t153 * t22 * t3;
-        double t181 = 2 * t159 * t22 * t3;
-        double t182 = 272 * t161 * t22;
-        double t183 = 14 * psi * t161 * t22;
-        double t184 = -136 * t161 * t22 * t36;
-        double t185 = -12 * t153 * t161 * t22;
-        double t186 = -8 * t159 * t161 * t22;
-        double t187 = -120 * t167 * t22;
-        double t188 = 171 * psi * t167 * t22;
-        double t189 = -44 * t167 * t22 * t36;
-        double t190 = -13 * t153 * t167 * t22;
-        double t191 = 6 * t159 * t167 * t22;
-        double t192 = -18 * t73;
-        double t193 = -108 * psi * t73;
-        double t194 = 46 * t36 * t73;
-        double t195 = 52 * t153 * t73;
-        double t196 = 78 * t3 * t73;
-        double t197 = 312 * psi * t3 * t73;
-        double t198 = -194 * t3 * t36 * t73;
-        double t199 = -116 * t153 * t3 * t73;
-        double t200 = -110 * t161 * t73;
-        double t201 = -172 * psi * t161 * t73;
-        double t202 = 186 * t161 * t36 * t73;
-        double t203 = 44 * t153 * t161 * t73;
-        double t204 = 50 * t167 * t73;
-        double t205 = -80 * psi * t167 * t73;
-        double t206 = 10 * t167 * t36 * t73;
-        double t207 = 20 * t153 * t167 * t73;
-        double t209 = 36 * psi * t208;
-        double t210 = -12 * t208 * t36;
-        double t211 = -24 * t153 * t208;
-        double t212 = -120 * psi * t208 * t3;
-        double t213 = 56 * t208 * t3 * t36;
-        double t214 = 64 * t153 * t208 * t3;
-        double t215 = 100 * psi * t161 * t208;
-        double t216 = -60 * t161 * t208 * t36;
-        double t217 = -40 * t153 * t161 * t208;
-        double t218 = 288 * t5;
-        double t219 = 75 * psi * t5;
-        double t220 = -104 * t36 * t5;
-        double t221 = -37 * t153 * t5;
-        double t223 = -752 * t3 * t5;
-        double t224 = 340 * psi * t3 * t5;
-        double t225 = 42 * t3 * t36 * t5;
-        double t226 = 50 * t153 * t3 * t5;
-        double t227 = 32 * t159 * t3 * t5;
-        double t228 = 480 * t161 * t5;
-        double t229 = -667 * psi * t161 * t5;
-        double t230 = 258 * t161 * t36 * t5;
-        double t231 = -37 * t153 * t161 * t5;
-        double t232 = -34 * t159 * t161 * t5;
-        double t233 = -424 * t22 * t5;
-        double t234 = -539 * psi * t22 * t5;
-        double t235 = 440 * t22 * t36 * t5;
-        double t236 = 157 * t153 * t22 * t5;
-        double t238 = 1152 * t22 * t3 * t5;
-        double t239 = 104 * psi * t22 * t3 * t5;
-        double t240 = -678 * t22 * t3 * t36 * t5;
-        double t241 = -66 * t153 * t22 * t3 * t5;
-        double t242 = -32 * t159 * t22 * t3 * t5;
-        double t243 = -760 * t161 * t22 * t5;
-        double t244 = 1103 * psi * t161 * t22 * t5;
-        double t245 = -278 * t161 * t22 * t36 * t5;
-        double t246 = -99 * t153 * t161 * t22 * t5;
-        double t247 = 34 * t159 * t161 * t22 * t5;
-        double t248 = 156 * t5 * t73;
-        double t249 = 672 * psi * t5 * t73;
-        double t250 = -420 * t36 * t5 * t73;
-        double t251 = -264 * t153 * t5 * t73;
-        double t252 = -440 * t3 * t5 * t73;
-        double t253 = -768 * psi * t3 * t5 * t73;
-        double t254 = 808 * t3 * t36 * t5 * t73;
-        double t255 = 208 * t153 * t3 * t5 * t73;
-        double t256 = 300 * t161 * t5 * t73;
-        double t257 = -480 * psi * t161 * t5 * t73;
-        double t258 = 60 * t161 * t36 * t5 * t73;
-        double t259 = 120 * t153 * t161 * t5 * t73;
-        double t260 = -240 * psi * t208 * t5;
-        double t261 = 112 * t208 * t36 * t5;
-        double t262 = 128 * t153 * t208 * t5;
-        double t263 = 400 * psi * t208 * t3 * t5;
-        double t264 = -240 * t208 * t3 * t36 * t5;
-        double t265 = -160 * t153 * t208 * t3 * t5;
-        double t267 = -840 * t266;
-        double t268 = 408 * psi * t266;
-        double t269 = 112 * t266 * t36;
-        double t270 = 32 * t153 * t266;
-        double t271 = 24 * t159 * t266;
-        double t272 = 1064 * t266 * t3;
-        double t273 = -1544 * psi * t266 * t3;
-        double t274 = 556 * t266 * t3 * t36;
-        double t275 = -20 * t153 * t266 * t3;
-        double t276 = -56 * t159 * t266 * t3;
-        double t277 = 1216 * t22 * t266;
-        double t278 = 148 * psi * t22 * t266;
-        double t279 = -828 * t22 * t266 * t36;
-        double t280 = -72 * t153 * t22 * t266;
-        double t281 = -24 * t159 * t22 * t266;
-        double t282 = -1600 * t22 * t266 * t3;
-        double t283 = 2380 * psi * t22 * t266 * t3;
-        double t284 = -576 * t22 * t266 * t3 * t36;
-        double t285 = -260 * t153 * t22 * t266 * t3;
-        double t286 = 56 * t159 * t22 * t266 * t3;
-        double t287 = -440 * t266 * t73;
-        double t288 = -848 * psi * t266 * t73;
-        double t289 = 872 * t266 * t36 * t73;
-        double t290 = 240 * t153 * t266 * t73;
-        double t291 = 600 * t266 * t3 * t73;
-        double t293 = 120 * t266 * t3 * t36 * t73;
-        double t294 = 240 * t153 * t266 * t3 * t73;
-        double t295 = 400 * psi * t208 * t266;
-        double t296 = -240 * t208 * t266 * t36;
-        double t297 = -160 * t153 * t208 * t266;
-        double t299 = 784 * t298;
-        double t300 = -1188 * psi * t298;
-        double t301 = 392 * t298 * t36;
-        double t302 = 36 * t153 * t298;
-        double t303 = -24 * t159 * t298;
-        double t304 = -1120 * t22 * t298;
-        double t305 = 1716 * psi * t22 * t298;
-        double t306 = -392 * t22 * t298 * t36;
-        double t307 = -228 * t153 * t22 * t298;
-        double t308 = 24 * t159 * t22 * t298;
-        double t309 = 400 * t298 * t73;
-        double t310 = -640 * psi * t298 * t73;
-        double t311 = 80 * t298 * t36 * t73;
-        double t312 = 160 * t153 * t298 * t73;
-        double t313 = 144 * t24;
-        double t314 = 235 * psi * t24;
-        double t315 = -132 * t24 * t36;
-        double t316 = -81 * t153 * t24;
-        double t317 = 2 * t159 * t24;
-        double t318 = -600 * t24 * t3;
-        double t319 = -487 * psi * t24 * t3;
-        double t320 = 485 * t24 * t3 * t36;
-        double t321 = 126 * t153 * t24 * t3;
-        double t322 = -4 * t159 * t24 * t3;
-        double t323 = 816 * t161 * t24;
-        double t324 = -163 * psi * t161 * t24;
-        double t325 = -350 * t161 * t24 * t36;
-        double t326 = 19 * t153 * t161 * t24;
-        double t327 = -10 * t159 * t161 * t24;
-        double t328 = -360 * t167 * t24;
-        double t329 = 543 * psi * t167 * t24;
-        double t330 = -135 * t167 * t24 * t36;
-        double t331 = -60 * t153 * t167 * t24;
-        double t332 = 12 * t159 * t167 * t24;
-        double t333 = -108 * t22 * t24;
-        double t334 = -552 * psi * t22 * t24;
-        double t335 = 251 * t22 * t24 * t36;
-        double t336 = 271 * t153 * t22 * t24;
-        double t337 = -2 * t159 * t22 * t24;
-        double t338 = 468 * t22 * t24 * t3;
-        double t339 = 1568 * psi * t22 * t24 * t3;
-        double t340 = -1050 * t22 * t24 * t3 * t36;
-        double t341 = -594 * t153 * t22 * t24 * t3;
-        double t342 = 8 * t159 * t22 * t24 * t3;
-        double t343 = -660 * t161 * t22 * t24;
-        double t344 = -792 * psi * t161 * t22 * t24;
-        double t345 = 999 * t161 * t22 * t24 * t36;
-        double t346 = 199 * t153 * t161 * t22 * t24;
-        double t347 = -6 * t159 * t161 * t22 * t24;
-        double t348 = 300 * t167 * t22 * t24;
-        double t349 = -480 * psi * t167 * t22 * t24;
-        double t350 = 60 * t167 * t22 * t24 * t36;
-        double t351 = 120 * t153 * t167 * t22 * t24;
-        double t352 = 288 * psi * t24 * t73;
-        double t353 = -96 * t24 * t36 * t73;
-        double t354 = -192 * t153 * t24 * t73;
-        double t355 = -960 * psi * t24 * t3 * t73;
-        double t356 = 448 * t24 * t3 * t36 * t73;
-        double t357 = 512 * t153 * t24 * t3 * t73;
-        double t358 = 800 * psi * t161 * t24 * t73;
-        double t359 = -480 * t161 * t24 * t36 * t73;
-        double t360 = -320 * t153 * t161 * t24 * t73;
-        double t361 = -1272 * t24 * t5;
-        double t362 = -1116 * psi * t24 * t5;
-        double t363 = 1154 * t24 * t36 * t5;
-        double t364 = 366 * t153 * t24 * t5;
-        double t365 = 4 * t159 * t24 * t5;
-        double t366 = 3456 * t24 * t3 * t5;
-        double t367 = -556 * psi * t24 * t3 * t5;
-        double t368 = -1712 * t24 * t3 * t36 * t5;
-        double t369 = 12 * t153 * t24 * t3 * t5;
-        double t370 = -48 * t159 * t24 * t3 * t5;
-        double t371 = -2280 * t161 * t24 * t5;
-        double t372 = 3464 * psi * t161 * t24 * t5;
-        double t373 = -842 * t161 * t24 * t36 * t5;
-        double t374 = -410 * t153 * t161 * t24 * t5;
-        double t375 = 68 * t159 * t161 * t24 * t5;
-        double t376 = 936 * t22 * t24 * t5;
-        double t377 = 3376 * psi * t22 * t24 * t5;
-        double t378 = -2248 * t22 * t24 * t36 * t5;
-        double t379 = -1352 * t153 * t22 * t24 * t5;
-        double t380 = 8 * t159 * t22 * t24 * t5;
-        double t381 = -2640 * t22 * t24 * t3 * t5;
-        double t382 = -3568 * psi * t22 * t24 * t3 * t5;
-        double t383 = 4296 * t22 * t24 * t3 * t36 * t5;
-        double t384 = 968 * t153 * t22 * t24 * t3 * t5;
-        double t385 = -16 * t159 * t22 * t24 * t3 * t5;
-        double t386 = 1800 * t161 * t22 * t24 * t5;
-        double t387 = -2880 * psi * t161 * t22 * t24 * t5;
-        double t388 = 360 * t161 * t22 * t24 * t36 * t5;
-        double t389 = 720 * t153 * t161 * t22 * t24 * t5;
-        double t390 = -1920 * psi * t24 * t5 * t73;
-        double t391 = 896 * t24 * t36 * t5 * t73;
-        double t392 = 1024 * t153 * t24 * t5 * t73;
-        double t393 = 3200 * psi * t24 * t3 * t5 * t73;
-        double t395 = -1280 * t153 * t24 * t3 * t5 * t73;
-        double t396 = 3648 * t24 * t266;
-        double t397 = -468 * psi * t24 * t266;
-        double t398 = -2056 * t24 * t266 * t36;
-        double t399 = -28 * t153 * t24 * t266;
-        double t400 = -40 * t159 * t24 * t266;
-        double t401 = -4800 * t24 * t266 * t3;
-        double t402 = 7380 * psi * t24 * t266 * t3;
-        double t403 = -1732 * t24 * t266 * t3 * t36;
-        double t404 = -960 * t153 * t24 * t266 * t3;
-        double t405 = 112 * t159 * t24 * t266 * t3;
-        double t406 = -2640 * t22 * t24 * t266;
-        double t407 = -3968 * psi * t22 * t24 * t266;
-        double t408 = 4596 * t22 * t24 * t266 * t36;
-        double t409 = 1140 * t153 * t22 * t24 * t266;
-        double t410 = -8 * t159 * t22 * t24 * t266;
-        double t411 = 3600 * t22 * t24 * t266 * t3;
-        double t412 = -5760 * psi * t22 * t24 * t266 * t3;
-        double t413 = 720 * t22 * t24 * t266 * t3 * t36;
-        double t414 = 1440 * t153 * t22 * t24 * t266 * t3;
-        double t415 = 3200 * psi * t24 * t266 * t73;
-        double t416 = -1920 * t24 * t266 * t36 * t73;
-        double t417 = -1280 * t153 * t24 * t266 * t73;
-        double t418 = -3360 * t24 * t298;
-        double t419 = 5248 * psi * t24 * t298;
-        double t420 = -1176 * t24 * t298 * t36;
-        double t421 = -760 * t153 * t24 * t298;
-        double t422 = 48 * t159 * t24 * t298;
-        double t423 = 2400 * t22 * t24 * t298;
-        double t424 = -3840 * psi * t22 * t24 * t298;
-        double t425 = 480 * t22 * t24 * t298 * t36;
-        double t426 = 960 * t153 * t22 * t24 * t298;
-        double t427 = -162 * t100;
-        double t428 = -684 * psi * t100;
-        double t429 = 336 * t100 * t36;
-        double t430 = 346 * t100 * t153;
-        double t431 = -4 * t100 * t159;
-        double t432 = 702 * t100 * t3;
-        double t433 = 1896 * psi * t100 * t3;
-        double t434 = -1390 * t100 * t3 * t36;
-        double t435 = -744 * t100 * t153 * t3;
-        double t436 = 16 * t100 * t159 * t3;
-        double t437 = -990 * t100 * t161;
-        double t438 = -828 * psi * t100 * t161;
-        double t439 = 1308 * t100 * t161 * t36;
-        double t440 = 210 * t100 * t153 * t161;
-        double t441 = -12 * t100 * t159 * t161;
-        double t442 = 450 * t100 * t167;
-        double t443 = -720 * psi * t100 * t167;
-        double t444 = 90 * t100 * t167 * t36;
-        double t445 = 180 * t100 * t153 * t167;
-        double t446 = 756 * psi * t100 * t22;
-        double t447 = -252 * t100 * t22 * t36;
-        double t448 = -504 * t100 * t153 * t22;
-        double t449 = -2520 * psi * t100 * t22 * t3;
-        double t450 = 1176 * t100 * t22 * t3 * t36;
-        double t451 = 1344 * t100 * t153 * t22 * t3;
-        double t452 = 2100 * psi * t100 * t161 * t22;
-        double t453 = -1260 * t100 * t161 * t22 * t36;
-        double t454 = -840 * t100 * t153 * t161 * t22;
-        double t455 = 1404 * t100 * t5;
-        double t456 = 4080 * psi * t100 * t5;
-        double t457 = -2948 * t100 * t36 * t5;
-        double t458 = -1688 * t100 * t153 * t5;
-        double t459 = 16 * t100 * t159 * t5;
-        double t460 = -3960 * t100 * t3 * t5;
-        double t461 = -3792 * psi * t100 * t3 * t5;
-        double t462 = 5576 * t100 * t3 * t36 * t5;
-        double t463 = 1056 * t100 * t153 * t3 * t5;
-        double t464 = -32 * t100 * t159 * t3 * t5;
-        double t465 = 2700 * t100 * t161 * t5;
-        double t466 = -4320 * psi * t100 * t161 * t5;
-        double t467 = 540 * t100 * t161 * t36 * t5;
-        double t468 = 1080 * t100 * t153 * t161 * t5;
-        double t469 = -5040 * psi * t100 * t22 * t5;
-        double t470 = 2352 * t100 * t22 * t36 * t5;
-        double t471 = 2688 * t100 * t153 * t22 * t5;
-        double t472 = 8400 * psi * t100 * t22 * t3 * t5;
-        double t473 = -5040 * t100 * t22 * t3 * t36 * t5;
-        double t474 = -3360 * t100 * t153 * t22 * t3 * t5;
-        double t475 = -3960 * t100 * t266;
-        double t476 = -4272 * psi * t100 * t266;
-        double t477 = 5920 * t100 * t266 * t36;
-        double t478 = 1272 * t100 * t153 * t266;
-        double t479 = -16 * t100 * t159 * t266;
-        double t480 = 5400 * t100 * t266 * t3;
-        double t481 = -8640 * psi * t100 * t266 * t3;
-        double t482 = 1080 * t100 * t266 * t3 * t36;
-        double t484 = 8400 * psi * t100 * t22 * t266;
-        double t485 = -5040 * t100 * t22 * t266 * t36;
-        double t486 = -3360 * t100 * t153 * t22 * t266;
-        double t487 = 3600 * t100 * t298;
-        double t488 = -5760 * psi * t100 * t298;
-        double t489 = 720 * t100 * t298 * t36;
-        double t490 = 1440 * t100 * t153 * t298;
-        double t492 = 648 * psi * t491;
-        double t493 = -216 * t36 * t491;
-        double t495 = -2160 * psi * t3 * t491;
-        double t496 = 1008 * t3 * t36 * t491;
-        double t497 = 1152 * t153 * t3 * t491;
-        double t498 = 1800 * psi * t161 * t491;
-        double t499 = -1080 * t161 * t36 * t491;
-        double t500 = -720 * t153 * t161 * t491;
-        double t501 = -4320 * psi * t491 * t5;
-        double t502 = 2016 * t36 * t491 * t5;
-        double t503 = 2304 * t153 * t491 * t5;
-        double t504 = 7200 * psi * t3 * t491 * t5;
-        double t505 = -4320 * t3 * t36 * t491 * t5;
-        double t506 = -2880 * t153 * t3 * t491 * t5;
-        double t507 = 7200 * psi * t266 * t491;
-        double t509 = -2880 * t153 * t266 * t491;
-        double t510 =
+        return nbs_dirichlet(alpha, h, psi, c, right);
+    }
+
+    template <typename V>
+    static std::span<const V> nbs_dirichlet(
+        const std::array<V, 4>& alpha, real h, real psi, std::span<V> c, bool right)
+    {
+        using std::pow;
+
+        V t3 = alpha[0];
+        V t5 = alpha[2];
+        V t17 = -1 + psi;
+        V t11 = -psi;
+        V t22 = alpha[1];
+        V t9 = 2 * t5;
+        V t24 = alpha[3];
+        V t28 = 1 + psi;
+        V t29 = pow(t28, -1);
+        V t12 = -2 * t3;
+        V t36 = pow(psi, 2);
+        V t14 = -3 * t5;
+        V t18 = -(t17 * t3);
+        V t21 = -(t17 * t5);
+        V t53 = -6 * t3;
+        V t54 = -3 * t22;
+        V t55 = 5 * t22 * t3;
+        V t56 = -14 * t5;
+        V t57 = 10 * t22 * t5;
+        V t58 = -9 * t24;
+        V t59 = 15 * t24 * t3;
+        V t60 = 30 * t24 * t5;
+        V t61 = 4 + t53 + t54 + t55 + t56 + t57 + t58 + t59 + t60;
+        V t62 = pow(t61, -1);
+        V t37 = -t36;
+        V t73 = pow(t22, 2);
+        V t44 = 2 * t24 * t36;
+        V t100 = pow(t24, 2);
+        V t49 = 3 * t3;
+        V t50 = -1 + t49 + t9;
+        V t51 = 2 * t24;
+        V t52 = -1 + t22 + t51;
+        V t13 = 3 * psi * t3;
+        V t153 = pow(psi, 3);
+        V t161 = pow(t3, 2);
+        V t159 = pow(psi, 4);
+        V t167 = pow(t3, 3);
+        V t208 = pow(t22, 3);
+        V t266 = pow(t5, 2);
+        V t298 = pow(t5, 3);
+        V t491 = pow(t24, 3);
+        V t222 = -6 * t159 * t5;
+        V t237 = 6 * t159 * t22 * t5;
+        V t292 = -960 * psi * t266 * t3 * t73;
+        V t394 = -1920 * t24 * t3 * t36 * t5 * t73;
+        V t483 = 2160 * t100 * t153 * t266 * t3;
+        V t494 = -432 * t153 * t491;
+        V t508 = -4320 * t266 * t36 * t491;
+        V t151 = -27 * psi;
+        V t152 = 11 * t36;
+        V t154 = 6 * t153;
+        V t155 = 128 * t3;
+        V t156 = 36 * psi * t3;
+        V t157 = -31 * t3 * t36;
+        V t158 = -11 * t153 * t3;
+        V t160 = -2 * t159 * t3;
+        V t162 = -168 * t161;
+        V t163 = 71 * psi * t161;
+        V t164 = -3 * t161 * t36;
+        V t165 = 14 * t153 * t161;
+        V t166 = 8 * t159 * t161;
+        V t168 = 72 * t167;
+        V t169 = -96 * psi * t167;
+        V t170 = 39 * t167 * t36;
+        V t171 = -9 * t153 * t167;
+        V t172 = -6 * t159 * t167;
+        V t173 = 48 * t22;
+        V t174 = 102 * psi * t22;
+        V t175 = -48 * t22 * t36;
+        V t176 = -32 * t153 * t22;
+        V t177 = -200 * t22 * t3;
+        V t178 = -239 * psi * t22 * t3;
+        V t179 = 180 * t22 * t3 * t36;
+        V t180 = 57 * t153 * t22 * t3;
+        V t181 = 2 * t159 * t22 * t3;
+        V t182 = 272 * t161 * t22;
+        V t183 = 14 * psi * t161 * t22;
+        V t184 = -136 * t161 * t22 * t36;
+        V t185 = -12 * t153 * t161 * t22;
+        V t186 = -8 * t159 * t161 * t22;
+        V t187 = -120 * t167 * t22;
+        V t188 = 171 * psi * t167 * t22;
+        V t189 = -44 * t167 * t22 * t36;
+        V t190 = -13 * t153 * t167 * t22;
+        V t191 = 6 * t159 * t167 * t22;
+        V t192 = -18 * t73;
+        V t193 = -108 * psi * t73;
+        V t194 = 46 * t36 * t73;
+        V t195 = 52 * t153 * t73;
+        V t196 = 78 * t3 * t73;
+        V t197 = 312 * psi * t3 * t73;
+        V t198 = -194 * t3 * t36 * t73;
+        V t199 = -116 * t153 * t3 * t73;
+        V t200 = -110 * t161 * t73;
+        V t201 = -172 * psi * t161 * t73;
+        V t202 = 186 * t161 * t36 * t73;
+        V t203 = 44 * t153 * t161 * t73;
+        V t204 = 50 * t167 * t73;
+        V t205 = -80 * psi * t167 * t73;
+        V t206 = 10 * t167 * t36 * t73;
+        V t207 = 20 * t153 * t167 * t73;
+        V t209 = 36 * psi * t208;
+        V t210 = -12 * t208 * t36;
+        V t211 = -24 * t153 * t208;
+        V t212 = -120 * psi * t208 * t3;
+        V t213 = 56 * t208 * t3 * t36;
+        V t214 = 64 * t153 * t208 * t3;
+        V t215 = 100 * psi * t161 * t208;
+        V t216 = -60 * t161 * t208 * t36;
+        V t217 = -40 * t153 * t161 * t208;
+        V t218 = 288 * t5;
+        V t219 = 75 * psi * t5;
+        V t220 = -104 * t36 * t5;
+        V t221 = -37 * t153 * t5;
+        V t223 = -752 * t3 * t5;
+        V t224 = 340 * psi * t3 * t5;
+        V t225 = 42 * t3 * t36 * t5;
+        V t226 = 50 * t153 * t3 * t5;
+        V t227 = 32 * t159 * t3 * t5;
+        V t228 = 480 * t161 * t5;
+        V t229 = -667 * psi * t161 * t5;
+        V t230 = 258 * t161 * t36 * t5;
+        V t231 = -37 * t153 * t161 * t5;
+        V t232 = -34 * t159 * t161 * t5;
+        V t233 = -424 * t22 * t5;
+        V t234 = -539 * psi * t22 * t5;
+        V t235 = 440 * t22 * t36 * t5;
+        V t236 = 157 * t153 * t22 * t5;
+        V t238 = 1152 * t22 * t3 * t5;
+        V t239 = 104 * psi * t22 * t3 * t5;
+        V t240 = -678 * t22 * t3 * t36 * t5;
+        V t241 = -66 * t153 * t22 * t3 * t5;
+        V t242 = -32 * t159 * t22 * t3 * t5;
+        V t243 = -760 * t161 * t22 * t5;
+        V t244 = 1103 * psi * t161 * t22 * t5;
+        V t245 = -278 * t161 * t22 * t36 * t5;
+        V t246 = -99 * t153 * t161 * t22 * t5;
+        V t247 = 34 * t159 * t161 * t22 * t5;
+        V t248 = 156 * t5 * t73;
+        V t249 = 672 * psi * t5 * t73;
+        V t250 = -420 * t36 * t5 * t73;
+        V t251 = -264 * t153 * t5 * t73;
+        V t252 = -440 * t3 * t5 * t73;
+        V t253 = -768 * psi * t3 * t5 * t73;
+        V t254 = 808 * t3 * t36 * t5 * t73;
+        V t255 = 208 * t153 * t3 * t5 * t73;
+        V t256 = 300 * t161 * t5 * t73;
+        V t257 = -480 * psi * t161 * t5 * t73;
+        V t258 = 60 * t161 * t36 * t5 * t73;
+        V t259 = 120 * t153 * t161 * t5 * t73;
+        V t260 = -240 * psi * t208 * t5;
+        V t261 = 112 * t208 * t36 * t5;
+        V t262 = 128 * t153 * t208 * t5;
+        V t263 = 400 * psi * t208 * t3 * t5;
+        V t264 = -240 * t208 * t3 * t36 * t5;
+        V t265 = -160 * t153 * t208 * t3 * t5;
+        V t267 = -840 * t266;
+        V t268 = 408 * psi * t266;
+        V t269 = 112 * t266 * t36;
+        V t270 = 32 * t153 * t266;
+        V t271 = 24 * t159 * t266;
+        V t272 = 1064 * t266 * t3;
+        V t273 = -1544 * psi * t266 * t3;
+        V t274 = 556 * t266 * t3 * t36;
+        V t275 = -20 * t153 * t266 * t3;
+        V t276 = -56 * t159 * t266 * t3;
+        V t277 = 1216 * t22 * t266;
+        V t278 = 148 * psi * t22 * t266;
+        V t279 = -828 * t22 * t266 * t36;
+        V t280 = -72 * t153 * t22 * t266;
+        V t281 = -24 * t159 * t22 * t266;
+        V t282 = -1600 * t22 * t266 * t3;
+        V t283 = 2380 * psi * t22 * t266 * t3;
+        V t284 = -576 * t22 * t266 * t3 * t36;
+        V t285 = -260 * t153 * t22 * t266 * t3;
+        V t286 = 56 * t159 * t22 * t266 * t3;
+        V t287 = -440 * t266 * t73;
+        V t288 = -848 * psi * t266 * t73;
+        V t289 = 872 * t266 * t36 * t73;
+        V t290 = 240 * t153 * t266 * t73;
+        V t291 = 600 * t266 * t3 * t73;
+        V t293 = 120 * t266 * t3 * t36 * t73;
+        V t294 = 240 * t153 * t266 * t3 * t73;
+        V t295 = 400 * psi * t208 * t266;
+        V t296 = -240 * t208 * t266 * t36;
+        V t297 = -160 * t153 * t208 * t266;
+        V t299 = 784 * t298;
+        V t300 = -1188 * psi * t298;
+        V t301 = 392 * t298 * t36;
+        V t302 = 36 * t153 * t298;
+        V t303 = -24 * t159 * t298;
+        V t304 = -1120 * t22 * t298;
+        V t305 = 1716 * psi * t22 * t298;
+        V t306 = -392 * t22 * t298 * t36;
+        V t307 = -228 * t153 * t22 * t298;
+        V t308 = 24 * t159 * t22 * t298;
+        V t309 = 400 * t298 * t73;
+        V t310 = -640 * psi * t298 * t73;
+        V t311 = 80 * t298 * t36 * t73;
+        V t312 = 160 * t153 * t298 * t73;
+        V t313 = 144 * t24;
+        V t314 = 235 * psi * t24;
+        V t315 = -132 * t24 * t36;
+        V t316 = -81 * t153 * t24;
+        V t317 = 2 * t159 * t24;
+        V t318 = -600 * t24 * t3;
+        V t319 = -487 * psi * t24 * t3;
+        V t320 = 485 * t24 * t3 * t36;
+        V t321 = 126 * t153 * t24 * t3;
+        V t322 = -4 * t159 * t24 * t3;
+        V t323 = 816 * t161 * t24;
+        V t324 = -163 * psi * t161 * t24;
+        V t325 = -350 * t161 * t24 * t36;
+        V t326 = 19 * t153 * t161 * t24;
+        V t327 = -10 * t159 * t161 * t24;
+        V t328 = -360 * t167 * t24;
+        V t329 = 543 * psi * t167 * t24;
+        V t330 = -135 * t167 * t24 * t36;
+        V t331 = -60 * t153 * t167 * t24;
+        V t332 = 12 * t159 * t167 * t24;
+        V t333 = -108 * t22 * t24;
+        V t334 = -552 * psi * t22 * t24;
+        V t335 = 251 * t22 * t24 * t36;
+        V t336 = 271 * t153 * t22 * t24;
+        V t337 = -2 * t159 * t22 * t24;
+        V t338 = 468 * t22 * t24 * t3;
+        V t339 = 1568 * psi * t22 * t24 * t3;
+        V t340 = -1050 * t22 * t24 * t3 * t36;
+        V t341 = -594 * t153 * t22 * t24 * t3;
+        V t342 = 8 * t159 * t22 * t24 * t3;
+        V t343 = -660 * t161 * t22 * t24;
+        V t344 = -792 * psi * t161 * t22 * t24;
+        V t345 = 999 * t161 * t22 * t24 * t36;
+        V t346 = 199 * t153 * t161 * t22 * t24;
+        V t347 = -6 * t159 * t161 * t22 * t24;
+        V t348 = 300 * t167 * t22 * t24;
+        V t349 = -480 * psi * t167 * t22 * t24;
+        V t350 = 60 * t167 * t22 * t24 * t36;
+        V t351 = 120 * t153 * t167 * t22 * t24;
+        V t352 = 288 * psi * t24 * t73;
+        V t353 = -96 * t24 * t36 * t73;
+        V t354 = -192 * t153 * t24 * t73;
+        V t355 = -960 * psi * t24 * t3 * t73;
+        V t356 = 448 * t24 * t3 * t36 * t73;
+        V t357 = 512 * t153 * t24 * t3 * t73;
+        V t358 = 800 * psi * t161 * t24 * t73;
+        V t359 = -480 * t161 * t24 * t36 * t73;
+        V t360 = -320 * t153 * t161 * t24 * t73;
+        V t361 = -1272 * t24 * t5;
+        V t362 = -1116 * psi * t24 * t5;
+        V t363 = 1154 * t24 * t36 * t5;
+        V t364 = 366 * t153 * t24 * t5;
+        V t365 = 4 * t159 * t24 * t5;
+        V t366 = 3456 * t24 * t3 * t5;
+        V t367 = -556 * psi * t24 * t3 * t5;
+        V t368 = -1712 * t24 * t3 * t36 * t5;
+        V t369 = 12 * t153 * t24 * t3 * t5;
+        V t370 = -48 * t159 * t24 * t3 * t5;
+        V t371 = -2280 * t161 * t24 * t5;
+        V t372 = 3464 * psi * t161 * t24 * t5;
+        V t373 = -842 * t161 * t24 * t36 * t5;
+        V t374 = -410 * t153 * t161 * t24 * t5;
+        V t375 = 68 * t159 * t161 * t24 * t5;
+        V t376 = 936 * t22 * t24 * t5;
+        V t377 = 3376 * psi * t22 * t24 * t5;
+        V t378 = -2248 * t22 * t24 * t36 * t5;
+        V t379 = -1352 * t153 * t22 * t24 * t5;
+        V t380 = 8 * t159 * t22 * t24 * t5;
+        V t381 = -2640 * t22 * t24 * t3 * t5;
+        V t382 = -3568 * psi * t22 * t24 * t3 * t5;
+        V t383 = 4296 * t22 * t24 * t3 * t36 * t5;
+        V t384 = 968 * t153 * t22 * t24 * t3 * t5;
+        V t385 = -16 * t159 * t22 * t24 * t3 * t5;
+        V t386 = 1800 * t161 * t22 * t24 * t5;
+        V t387 = -2880 * psi * t161 * t22 * t24 * t5;
+        V t388 = 360 * t161 * t22 * t24 * t36 * t5;
+        V t389 = 720 * t153 * t161 * t22 * t24 * t5;
+        V t390 = -1920 * psi * t24 * t5 * t73;
+        V t391 = 896 * t24 * t36 * t5 * t73;
+        V t392 = 1024 * t153 * t24 * t5 * t73;
+        V t393 = 3200 * psi * t24 * t3 * t5 * t73;
+        V t395 = -1280 * t153 * t24 * t3 * t5 * t73;
+        V t396 = 3648 * t24 * t266;
+        V t397 = -468 * psi * t24 * t266;
+        V t398 = -2056 * t24 * t266 * t36;
+        V t399 = -28 * t153 * t24 * t266;
+        V t400 = -40 * t159 * t24 * t266;
+        V t401 = -4800 * t24 * t266 * t3;
+        V t402 = 7380 * psi * t24 * t266 * t3;
+        V t403 = -1732 * t24 * t266 * t3 * t36;
+        V t404 = -960 * t153 * t24 * t266 * t3;
+        V t405 = 112 * t159 * t24 * t266 * t3;
+        V t406 = -2640 * t22 * t24 * t266;
+        V t407 = -3968 * psi * t22 * t24 * t266;
+        V t408 = 4596 * t22 * t24 * t266 * t36;
+        V t409 = 1140 * t153 * t22 * t24 * t266;
+        V t410 = -8 * t159 * t22 * t24 * t266;
+        V t411 = 3600 * t22 * t24 * t266 * t3;
+        V t412 = -5760 * psi * t22 * t24 * t266 * t3;
+        V t413 = 720 * t22 * t24 * t266 * t3 * t36;
+        V t414 = 1440 * t153 * t22 * t24 * t266 * t3;
+        V t415 = 3200 * psi * t24 * t266 * t73;
+        V t416 = -1920 * t24 * t266 * t36 * t73;
+        V t417 = -1280 * t153 * t24 * t266 * t73;
+        V t418 = -3360 * t24 * t298;
+        V t419 = 5248 * psi * t24 * t298;
+        V t420 = -1176 * t24 * t298 * t36;
+        V t421 = -760 * t153 * t24 * t298;
+        V t422 = 48 * t159 * t24 * t298;
+        V t423 = 2400 * t22 * t24 * t298;
+        V t424 = -3840 * psi * t22 * t24 * t298;
+        V t425 = 480 * t22 * t24 * t298 * t36;
+        V t426 = 960 * t153 * t22 * t24 * t298;
+        V t427 = -162 * t100;
+        V t428 = -684 * psi * t100;
+        V t429 = 336 * t100 * t36;
+        V t430 = 346 * t100 * t153;
+        V t431 = -4 * t100 * t159;
+        V t432 = 702 * t100 * t3;
+        V t433 = 1896 * psi * t100 * t3;
+        V t434 = -1390 * t100 * t3 * t36;
+        V t435 = -744 * t100 * t153 * t3;
+        V t436 = 16 * t100 * t159 * t3;
+        V t437 = -990 * t100 * t161;
+        V t438 = -828 * psi * t100 * t161;
+        V t439 = 1308 * t100 * t161 * t36;
+        V t440 = 210 * t100 * t153 * t161;
+        V t441 = -12 * t100 * t159 * t161;
+        V t442 = 450 * t100 * t167;
+        V t443 = -720 * psi * t100 * t167;
+        V t444 = 90 * t100 * t167 * t36;
+        V t445 = 180 * t100 * t153 * t167;
+        V t446 = 756 * psi * t100 * t22;
+        V t447 = -252 * t100 * t22 * t36;
+        V t448 = -504 * t100 * t153 * t22;
+        V t449 = -2520 * psi * t100 * t22 * t3;
+        V t450 = 1176 * t100 * t22 * t3 * t36;
+        V t451 = 1344 * t100 * t153 * t22 * t3;
+        V t452 = 2100 * psi * t100 * t161 * t22;
+        V t453 = -1260 * t100 * t161 * t22 * t36;
+        V t454 = -840 * t100 * t153 * t161 * t22;
+        V t455 = 1404 * t100 * t5;
+        V t456 = 4080 * psi * t100 * t5;
+        V t457 = -2948 * t100 * t36 * t5;
+        V t458 = -1688 * t100 * t153 * t5;
+        V t459 = 16 * t100 * t159 * t5;
+        V t460 = -3960 * t100 * t3 * t5;
+        V t461 = -3792 * psi * t100 * t3 * t5;
+        V t462 = 5576 * t100 * t3 * t36 * t5;
+        V t463 = 1056 * t100 * t153 * t3 * t5;
+        V t464 = -32 * t100 * t159 * t3 * t5;
+        V t465 = 2700 * t100 * t161 * t5;
+        V t466 = -4320 * psi * t100 * t161 * t5;
+        V t467 = 540 * t100 * t161 * t36 * t5;
+        V t468 = 1080 * t100 * t153 * t161 * t5;
+        V t469 = -5040 * psi * t100 * t22 * t5;
+        V t470 = 2352 * t100 * t22 * t36 * t5;
+        V t471 = 2688 * t100 * t153 * t22 * t5;
+        V t472 = 8400 * psi * t100 * t22 * t3 * t5;
+        V t473 = -5040 * t100 * t22 * t3 * t36 * t5;
+        V t474 = -3360 * t100 * t153 * t22 * t3 * t5;
+        V t475 = -3960 * t100 * t266;
+        V t476 = -4272 * psi * t100 * t266;
+        V t477 = 5920 * t100 * t266 * t36;
+        V t478 = 1272 * t100 * t153 * t266;
+        V t479 = -16 * t100 * t159 * t266;
+        V t480 = 5400 * t100 * t266 * t3;
+        V t481 = -8640 * psi * t100 * t266 * t3;
+        V t482 = 1080 * t100 * t266 * t3 * t36;
+        V t484 = 8400 * psi * t100 * t22 * t266;
+        V t485 = -5040 * t100 * t22 * t266 * t36;
+        V t486 = -3360 * t100 * t153 * t22 * t266;
+        V t487 = 3600 * t100 * t298;
+        V t488 = -5760 * psi * t100 * t298;
+        V t489 = 720 * t100 * t298 * t36;
+        V t490 = 1440 * t100 * t153 * t298;
+        V t492 = 648 * psi * t491;
+        V t493 = -216 * t36 * t491;
+        V t495 = -2160 * psi * t3 * t491;
+        V t496 = 1008 * t3 * t36 * t491;
+        V t497 = 1152 * t153 * t3 * t491;
+        V t498 = 1800 * psi * t161 * t491;
+        V t499 = -1080 * t161 * t36 * t491;
+        V t500 = -720 * t153 * t161 * t491;
+        V t501 = -4320 * psi * t491 * t5;
+        V t502 = 2016 * t36 * t491 * t5;
+        V t503 = 2304 * t153 * t491 * t5;
+        V t504 = 7200 * psi * t3 * t491 * t5;
+        V t505 = -4320 * t3 * t36 * t491 * t5;
+        V t506 = -2880 * t153 * t3 * t491 * t5;
+        V t507 = 7200 * psi * t266 * t491;
+        V t509 = -2880 * t153 * t266 * t491;
+        V t510 =
             -32 + t151 + t152 + t154 + t155 + t156 + t157 + t158 + t160 + t162 + t163 +
             t164 + t165 + t166 + t168 + t169 + t170 + t171 + t172 + t173 + t174 + t175 +
             t176 + t177 + t178 + t179 + t180 + t181 + t182 + t183 + t184 + t185 + t186 +
@@ -1742,332 +1789,332 @@ struct E2_1 {
             t476 + t477 + t478 + t479 + t480 + t481 + t482 + t483 + t484 + t485 + t486 +
             t487 + t488 + t489 + t490 + t492 + t493 + t494 + t495 + t496 + t497 + t498 +
             t499 + t500 + t501 + t502 + t503 + t504 + t505 + t506 + t507 + t508 + t509;
-        double t511 = std::pow(t510, -1);
-        double t522 = 36 * t167;
-        double t67 = 14 * t22;
-        double t74 = -6 * t73;
-        double t551 = -40 * psi * t167 * t73;
-        double t86 = 34 * t24;
-        double t91 = -30 * t22 * t24;
-        double t677 = 150 * t167 * t22 * t24;
-        double t718 = 360 * t153 * t161 * t22 * t24 * t5;
-        double t101 = -36 * t100;
-        double t512 = -21 * psi;
-        double t513 = 3 * t36;
-        double t514 = 84 * t3;
-        double t515 = 32 * psi * t3;
-        double t516 = 6 * t3 * t36;
-        double t517 = -2 * t153 * t3;
-        double t518 = -96 * t161;
-        double t519 = 25 * psi * t161;
-        double t520 = -15 * t161 * t36;
-        double t521 = 8 * t153 * t161;
-        double t523 = -36 * psi * t167;
-        double t524 = 6 * t167 * t36;
-        double t525 = -6 * t153 * t167;
-        double t526 = 34 * t22;
-        double t527 = 65 * psi * t22;
-        double t528 = -29 * t22 * t36;
-        double t529 = -122 * t22 * t3;
-        double t530 = -120 * psi * t22 * t3;
-        double t531 = 40 * t22 * t3 * t36;
-        double t532 = 2 * t153 * t22 * t3;
-        double t533 = 142 * t161 * t22;
-        double t534 = -21 * psi * t161 * t22;
-        double t535 = 17 * t161 * t22 * t36;
-        double t536 = -8 * t153 * t161 * t22;
-        double t537 = -54 * t167 * t22;
-        double t538 = 76 * psi * t167 * t22;
-        double t539 = -28 * t167 * t22 * t36;
-        double t540 = 6 * t153 * t167 * t22;
-        double t541 = -12 * t73;
-        double t542 = -68 * psi * t73;
-        double t543 = 52 * t36 * t73;
-        double t544 = 44 * t3 * t73;
-        double t545 = 152 * psi * t3 * t73;
-        double t546 = -116 * t3 * t36 * t73;
-        double t547 = -52 * t161 * t73;
-        double t548 = -44 * psi * t161 * t73;
-        double t549 = 44 * t161 * t36 * t73;
-        double t550 = 20 * t167 * t73;
-        double t552 = 20 * t167 * t36 * t73;
-        double t553 = 24 * psi * t208;
-        double t554 = -24 * t208 * t36;
-        double t555 = -64 * psi * t208 * t3;
-        double t556 = 64 * t208 * t3 * t36;
-        double t557 = 40 * psi * t161 * t208;
-        double t558 = -40 * t161 * t208 * t36;
-        double t559 = 228 * t5;
-        double t560 = 49 * psi * t5;
-        double t561 = -54 * t36 * t5;
-        double t562 = -(t153 * t5);
-        double t563 = -528 * t3 * t5;
-        double t564 = 228 * psi * t3 * t5;
-        double t565 = -72 * t3 * t36 * t5;
-        double t566 = 60 * t153 * t3 * t5;
-        double t567 = 24 * t159 * t3 * t5;
-        double t568 = 300 * t161 * t5;
-        double t569 = -377 * psi * t161 * t5;
-        double t570 = 162 * t161 * t36 * t5;
-        double t571 = -67 * t153 * t161 * t5;
-        double t572 = -18 * t159 * t161 * t5;
-        double t573 = -320 * t22 * t5;
-        double t574 = -309 * psi * t22 * t5;
-        double t575 = 314 * t22 * t36 * t5;
-        double t576 = -51 * t153 * t22 * t5;
-        double t577 = 760 * t22 * t3 * t5;
-        double t578 = -164 * psi * t22 * t3 * t5;
-        double t579 = -72 * t22 * t3 * t36 * t5;
-        double t580 = -20 * t153 * t22 * t3 * t5;
-        double t581 = -24 * t159 * t22 * t3 * t5;
-        double t582 = -440 * t161 * t22 * t5;
-        double t583 = 733 * psi * t161 * t22 * t5;
-        double t584 = -422 * t161 * t22 * t36 * t5;
-        double t585 = 111 * t153 * t161 * t22 * t5;
-        double t586 = 18 * t159 * t161 * t22 * t5;
-        double t587 = 112 * t5 * t73;
-        double t588 = 432 * psi * t5 * t73;
-        double t589 = -504 * t36 * t5 * t73;
-        double t590 = 104 * t153 * t5 * t73;
-        double t591 = -272 * t3 * t5 * t73;
-        double t592 = -296 * psi * t3 * t5 * t73;
-        double t593 = 504 * t3 * t36 * t5 * t73;
-        double t594 = -128 * t153 * t3 * t5 * t73;
-        double t595 = 160 * t161 * t5 * t73;
-        double t596 = -360 * psi * t161 * t5 * t73;
-        double t597 = 240 * t161 * t36 * t5 * t73;
-        double t598 = -40 * t153 * t161 * t5 * t73;
-        double t599 = -176 * psi * t208 * t5;
-        double t600 = 224 * t208 * t36 * t5;
-        double t601 = -48 * t153 * t208 * t5;
-        double t602 = 240 * psi * t208 * t3 * t5;
-        double t603 = -320 * t208 * t3 * t36 * t5;
-        double t604 = 80 * t153 * t208 * t3 * t5;
-        double t605 = -696 * t266;
-        double t606 = 416 * psi * t266;
-        double t607 = -32 * t266 * t36;
-        double t608 = 28 * t153 * t266;
-        double t609 = 20 * t159 * t266;
-        double t610 = 792 * t266 * t3;
-        double t611 = -1184 * psi * t266 * t3;
-        double t612 = 612 * t266 * t3 * t36;
-        double t613 = -184 * t153 * t266 * t3;
-        double t614 = -36 * t159 * t266 * t3;
-        double t615 = 968 * t22 * t266;
-        double t616 = -264 * psi * t22 * t266;
-        double t617 = -352 * t22 * t266 * t36;
-        double t618 = 108 * t153 * t22 * t266;
-        double t619 = -20 * t159 * t22 * t266;
-        double t620 = -1128 * t22 * t266 * t3;
-        double t621 = 2120 * psi * t22 * t266 * t3;
-        double t622 = -1396 * t22 * t266 * t3 * t36;
-        double t623 = 368 * t153 * t22 * t266 * t3;
-        double t624 = 36 * t159 * t22 * t266 * t3;
-        double t625 = -336 * t266 * t73;
-        double t626 = -448 * psi * t266 * t73;
-        double t627 = 928 * t266 * t36 * t73;
-        double t628 = -320 * t153 * t266 * t73;
-        double t629 = 400 * t266 * t3 * t73;
-        double t630 = 720 * t266 * t3 * t36 * t73;
-        double t631 = -160 * t153 * t266 * t3 * t73;
-        double t632 = 320 * psi * t208 * t266;
-        double t633 = -480 * t208 * t266 * t36;
-        double t634 = 160 * t153 * t208 * t266;
-        double t635 = 672 * t298;
-        double t636 = -1148 * psi * t298;
-        double t637 = 640 * t298 * t36;
-        double t638 = -148 * t153 * t298;
-        double t639 = -16 * t159 * t298;
-        double t640 = -928 * t22 * t298;
-        double t641 = 1916 * psi * t22 * t298;
-        double t642 = -1344 * t22 * t298 * t36;
-        double t643 = 340 * t153 * t22 * t298;
-        double t644 = 16 * t159 * t22 * t298;
-        double t645 = 320 * t298 * t73;
-        double t646 = -800 * psi * t298 * t73;
-        double t647 = 640 * t298 * t36 * t73;
-        double t648 = -160 * t153 * t298 * t73;
-        double t649 = 110 * t24;
-        double t650 = 190 * psi * t24;
-        double t651 = -86 * t24 * t36;
-        double t652 = -46 * t153 * t24;
-        double t653 = -410 * t24 * t3;
-        double t654 = -400 * psi * t24 * t3;
-        double t655 = 230 * t24 * t3 * t36;
-        double t656 = 100 * t153 * t24 * t3;
-        double t657 = 498 * t161 * t24;
-        double t658 = 34 * psi * t161 * t24;
-        double t659 = -242 * t161 * t24 * t36;
-        double t660 = 22 * t153 * t161 * t24;
-        double t661 = -198 * t167 * t24;
-        double t662 = 192 * psi * t167 * t24;
-        double t663 = 114 * t167 * t24 * t36;
-        double t664 = -108 * t153 * t167 * t24;
-        double t665 = -78 * t22 * t24;
-        double t666 = -392 * psi * t22 * t24;
-        double t667 = 200 * t22 * t24 * t36;
-        double t668 = 130 * t153 * t22 * t24;
-        double t669 = 298 * t22 * t24 * t3;
-        double t670 = 952 * psi * t22 * t24 * t3;
-        double t671 = -470 * t22 * t24 * t3 * t36;
-        double t672 = -380 * t153 * t22 * t24 * t3;
-        double t673 = -370 * t161 * t22 * t24;
-        double t674 = -392 * psi * t161 * t22 * t24;
-        double t675 = 288 * t161 * t22 * t24 * t36;
-        double t676 = 214 * t153 * t161 * t22 * t24;
-        double t678 = -200 * psi * t167 * t22 * t24;
-        double t679 = -50 * t167 * t22 * t24 * t36;
-        double t680 = 100 * t153 * t167 * t22 * t24;
-        double t681 = 204 * psi * t24 * t73;
-        double t682 = -132 * t24 * t36 * t73;
-        double t683 = -72 * t153 * t24 * t73;
-        double t684 = -568 * psi * t24 * t3 * t73;
-        double t685 = 328 * t24 * t3 * t36 * t73;
-        double t686 = 240 * t153 * t24 * t3 * t73;
-        double t687 = 380 * psi * t161 * t24 * t73;
-        double t688 = -180 * t161 * t24 * t36 * t73;
-        double t689 = -200 * t153 * t161 * t24 * t73;
-        double t690 = -1020 * t24 * t5;
-        double t691 = -918 * psi * t24 * t5;
-        double t692 = 980 * t24 * t36 * t5;
-        double t693 = 78 * t153 * t24 * t5;
-        double t694 = 16 * t159 * t24 * t5;
-        double t695 = 2504 * t24 * t3 * t5;
-        double t696 = -168 * psi * t24 * t3 * t5;
-        double t697 = -1236 * t24 * t3 * t36 * t5;
-        double t698 = 112 * t153 * t24 * t3 * t5;
-        double t699 = -60 * t159 * t24 * t3 * t5;
-        double t700 = -1500 * t161 * t24 * t5;
-        double t701 = 1894 * psi * t161 * t24 * t5;
-        double t702 = 40 * t161 * t24 * t36 * t5;
-        double t703 = -470 * t153 * t161 * t24 * t5;
-        double t704 = 36 * t159 * t161 * t24 * t5;
-        double t705 = 716 * t22 * t24 * t5;
-        double t706 = 2464 * psi * t22 * t24 * t5;
-        double t707 = -2192 * t22 * t24 * t36 * t5;
-        double t708 = -264 * t153 * t22 * t24 * t5;
-        double t709 = -4 * t159 * t22 * t24 * t5;
-        double t710 = -1800 * t22 * t24 * t3 * t5;
-        double t711 = -2032 * psi * t22 * t24 * t3 * t5;
-        double t712 = 2596 * t22 * t24 * t3 * t36 * t5;
-        double t713 = 264 * t153 * t22 * t24 * t3 * t5;
-        double t714 = 12 * t159 * t22 * t24 * t3 * t5;
-        double t715 = 1100 * t161 * t22 * t24 * t5;
-        double t716 = -1840 * psi * t161 * t22 * t24 * t5;
-        double t717 = 380 * t161 * t22 * t24 * t36 * t5;
-        double t719 = -1472 * psi * t24 * t5 * t73;
-        double t720 = 1376 * t24 * t36 * t5 * t73;
-        double t721 = 96 * t153 * t24 * t5 * t73;
-        double t722 = 2080 * psi * t24 * t3 * t5 * t73;
-        double t723 = -160 * t153 * t24 * t3 * t5 * t73;
-        double t724 = 3048 * t24 * t266;
-        double t725 = -528 * psi * t24 * t266;
-        double t726 = -1800 * t24 * t266 * t36;
-        double t727 = 384 * t153 * t24 * t266;
-        double t728 = -48 * t159 * t24 * t266;
-        double t729 = -3656 * t24 * t266 * t3;
-        double t730 = 5488 * psi * t24 * t266 * t3;
-        double t731 = -1328 * t24 * t266 * t3 * t36;
-        double t732 = -576 * t153 * t24 * t266 * t3;
-        double t733 = 72 * t159 * t24 * t266 * t3;
-        double t734 = -2120 * t22 * t24 * t266;
-        double t735 = -2624 * psi * t22 * t24 * t266;
-        double t736 = 4472 * t22 * t24 * t266 * t36;
-        double t737 = -616 * t153 * t22 * t24 * t266;
-        double t738 = 8 * t159 * t22 * t24 * t266;
-        double t739 = 2600 * t22 * t24 * t266 * t3;
-        double t740 = -4960 * psi * t22 * t24 * t266 * t3;
-        double t741 = 2120 * t22 * t24 * t266 * t3 * t36;
-        double t742 = 240 * t153 * t22 * t24 * t266 * t3;
-        double t743 = 2640 * psi * t24 * t266 * t73;
-        double t744 = -3120 * t24 * t266 * t36 * t73;
-        double t745 = 480 * t153 * t24 * t266 * t73;
-        double t746 = -2896 * t24 * t298;
-        double t747 = 4936 * psi * t24 * t298;
-        double t748 = -1936 * t24 * t298 * t36;
-        double t749 = -136 * t153 * t24 * t298;
-        double t750 = 32 * t159 * t24 * t298;
-        double t751 = 2000 * t22 * t24 * t298;
-        double t752 = -4160 * psi * t22 * t24 * t298;
-        double t753 = 2320 * t22 * t24 * t298 * t36;
-        double t754 = -160 * t153 * t22 * t24 * t298;
-        double t755 = -126 * t100;
-        double t756 = -548 * psi * t100;
-        double t757 = 210 * t100 * t36;
-        double t758 = 296 * t100 * t153;
-        double t759 = 498 * t100 * t3;
-        double t760 = 1416 * psi * t100 * t3;
-        double t761 = -590 * t100 * t3 * t36;
-        double t762 = -844 * t100 * t153 * t3;
-        double t763 = -642 * t100 * t161;
-        double t764 = -708 * psi * t100 * t161;
-        double t765 = 630 * t100 * t161 * t36;
-        double t766 = 408 * t100 * t153 * t161;
-        double t767 = 270 * t100 * t167;
-        double t768 = -240 * psi * t100 * t167;
-        double t769 = -330 * t100 * t167 * t36;
-        double t770 = 300 * t100 * t153 * t167;
-        double t771 = 564 * psi * t100 * t22;
-        double t772 = -204 * t100 * t22 * t36;
-        double t773 = -360 * t100 * t153 * t22;
-        double t774 = -1624 * psi * t100 * t22 * t3;
-        double t775 = 424 * t100 * t22 * t3 * t36;
-        double t776 = 1200 * t100 * t153 * t22 * t3;
-        double t777 = 1140 * psi * t100 * t161 * t22;
-        double t778 = -140 * t100 * t161 * t22 * t36;
-        double t779 = -1000 * t100 * t153 * t161 * t22;
-        double t780 = 1140 * t100 * t5;
-        double t781 = 3416 * psi * t100 * t5;
-        double t782 = -2596 * t100 * t36 * t5;
-        double t783 = -1088 * t100 * t153 * t5;
-        double t784 = -8 * t100 * t159 * t5;
-        double t785 = -2952 * t100 * t3 * t5;
-        double t786 = -3216 * psi * t100 * t3 * t5;
-        double t787 = 4048 * t100 * t3 * t36 * t5;
-        double t788 = 944 * t100 * t153 * t3 * t5;
-        double t789 = 24 * t100 * t159 * t3 * t5;
-        double t790 = 1860 * t100 * t161 * t5;
-        double t791 = -2280 * psi * t100 * t161 * t5;
-        double t792 = -1020 * t100 * t161 * t36 * t5;
-        double t793 = 1440 * t100 * t153 * t161 * t5;
-        double t794 = -4016 * psi * t100 * t22 * t5;
-        double t795 = 2624 * t100 * t22 * t36 * t5;
-        double t796 = 1392 * t100 * t153 * t22 * t5;
-        double t797 = 5840 * psi * t100 * t22 * t3 * t5;
-        double t798 = -3520 * t100 * t22 * t3 * t36 * t5;
-        double t799 = -2320 * t100 * t153 * t22 * t3 * t5;
-        double t800 = -3336 * t100 * t266;
-        double t801 = -3728 * psi * t100 * t266;
-        double t802 = 6056 * t100 * t266 * t36;
-        double t803 = -64 * t100 * t153 * t266;
-        double t804 = 16 * t100 * t159 * t266;
-        double t805 = 4200 * t100 * t266 * t3;
-        double t806 = -6240 * psi * t100 * t266 * t3;
-        double t807 = -120 * t100 * t266 * t3 * t36;
-        double t808 = 7120 * psi * t100 * t22 * t266;
-        double t809 = -6480 * t100 * t22 * t266 * t36;
-        double t810 = -640 * t100 * t153 * t22 * t266;
-        double t811 = 3120 * t100 * t298;
-        double t812 = -5280 * psi * t100 * t298;
-        double t813 = 1200 * t100 * t298 * t36;
-        double t814 = 960 * t100 * t153 * t298;
-        double t815 = 504 * psi * t491;
-        double t816 = -72 * t36 * t491;
-        double t817 = -1488 * psi * t3 * t491;
-        double t818 = 48 * t3 * t36 * t491;
-        double t819 = 1440 * t153 * t3 * t491;
-        double t820 = 1080 * psi * t161 * t491;
-        double t821 = 120 * t161 * t36 * t491;
-        double t822 = -1200 * t153 * t161 * t491;
-        double t823 = -3552 * psi * t491 * t5;
-        double t824 = 1536 * t36 * t491 * t5;
-        double t825 = 2016 * t153 * t491 * t5;
-        double t826 = 5280 * psi * t3 * t491 * t5;
-        double t827 = -1920 * t3 * t36 * t491 * t5;
-        double t828 = -3360 * t153 * t3 * t491 * t5;
-        double t829 = 6240 * psi * t266 * t491;
-        double t830 = -1920 * t153 * t266 * t491;
-        double t831 =
+        V t511 = pow(t510, -1);
+        V t522 = 36 * t167;
+        V t67 = 14 * t22;
+        V t74 = -6 * t73;
+        V t551 = -40 * psi * t167 * t73;
+        V t86 = 34 * t24;
+        V t91 = -30 * t22 * t24;
+        V t677 = 150 * t167 * t22 * t24;
+        V t718 = 360 * t153 * t161 * t22 * t24 * t5;
+        V t101 = -36 * t100;
+        V t512 = -21 * psi;
+        V t513 = 3 * t36;
+        V t514 = 84 * t3;
+        V t515 = 32 * psi * t3;
+        V t516 = 6 * t3 * t36;
+        V t517 = -2 * t153 * t3;
+        V t518 = -96 * t161;
+        V t519 = 25 * psi * t161;
+        V t520 = -15 * t161 * t36;
+        V t521 = 8 * t153 * t161;
+        V t523 = -36 * psi * t167;
+        V t524 = 6 * t167 * t36;
+        V t525 = -6 * t153 * t167;
+        V t526 = 34 * t22;
+        V t527 = 65 * psi * t22;
+        V t528 = -29 * t22 * t36;
+        V t529 = -122 * t22 * t3;
+        V t530 = -120 * psi * t22 * t3;
+        V t531 = 40 * t22 * t3 * t36;
+        V t532 = 2 * t153 * t22 * t3;
+        V t533 = 142 * t161 * t22;
+        V t534 = -21 * psi * t161 * t22;
+        V t535 = 17 * t161 * t22 * t36;
+        V t536 = -8 * t153 * t161 * t22;
+        V t537 = -54 * t167 * t22;
+        V t538 = 76 * psi * t167 * t22;
+        V t539 = -28 * t167 * t22 * t36;
+        V t540 = 6 * t153 * t167 * t22;
+        V t541 = -12 * t73;
+        V t542 = -68 * psi * t73;
+        V t543 = 52 * t36 * t73;
+        V t544 = 44 * t3 * t73;
+        V t545 = 152 * psi * t3 * t73;
+        V t546 = -116 * t3 * t36 * t73;
+        V t547 = -52 * t161 * t73;
+        V t548 = -44 * psi * t161 * t73;
+        V t549 = 44 * t161 * t36 * t73;
+        V t550 = 20 * t167 * t73;
+        V t552 = 20 * t167 * t36 * t73;
+        V t553 = 24 * psi * t208;
+        V t554 = -24 * t208 * t36;
+        V t555 = -64 * psi * t208 * t3;
+        V t556 = 64 * t208 * t3 * t36;
+        V t557 = 40 * psi * t161 * t208;
+        V t558 = -40 * t161 * t208 * t36;
+        V t559 = 228 * t5;
+        V t560 = 49 * psi * t5;
+        V t561 = -54 * t36 * t5;
+        V t562 = -(t153 * t5);
+        V t563 = -528 * t3 * t5;
+        V t564 = 228 * psi * t3 * t5;
+        V t565 = -72 * t3 * t36 * t5;
+        V t566 = 60 * t153 * t3 * t5;
+        V t567 = 24 * t159 * t3 * t5;
+        V t568 = 300 * t161 * t5;
+        V t569 = -377 * psi * t161 * t5;
+        V t570 = 162 * t161 * t36 * t5;
+        V t571 = -67 * t153 * t161 * t5;
+        V t572 = -18 * t159 * t161 * t5;
+        V t573 = -320 * t22 * t5;
+        V t574 = -309 * psi * t22 * t5;
+        V t575 = 314 * t22 * t36 * t5;
+        V t576 = -51 * t153 * t22 * t5;
+        V t577 = 760 * t22 * t3 * t5;
+        V t578 = -164 * psi * t22 * t3 * t5;
+        V t579 = -72 * t22 * t3 * t36 * t5;
+        V t580 = -20 * t153 * t22 * t3 * t5;
+        V t581 = -24 * t159 * t22 * t3 * t5;
+        V t582 = -440 * t161 * t22 * t5;
+        V t583 = 733 * psi * t161 * t22 * t5;
+        V t584 = -422 * t161 * t22 * t36 * t5;
+        V t585 = 111 * t153 * t161 * t22 * t5;
+        V t586 = 18 * t159 * t161 * t22 * t5;
+        V t587 = 112 * t5 * t73;
+        V t588 = 432 * psi * t5 * t73;
+        V t589 = -504 * t36 * t5 * t73;
+        V t590 = 104 * t153 * t5 * t73;
+        V t591 = -272 * t3 * t5 * t73;
+        V t592 = -296 * psi * t3 * t5 * t73;
+        V t593 = 504 * t3 * t36 * t5 * t73;
+        V t594 = -128 * t153 * t3 * t5 * t73;
+        V t595 = 160 * t161 * t5 * t73;
+        V t596 = -360 * psi * t161 * t5 * t73;
+        V t597 = 240 * t161 * t36 * t5 * t73;
+        V t598 = -40 * t153 * t161 * t5 * t73;
+        V t599 = -176 * psi * t208 * t5;
+        V t600 = 224 * t208 * t36 * t5;
+        V t601 = -48 * t153 * t208 * t5;
+        V t602 = 240 * psi * t208 * t3 * t5;
+        V t603 = -320 * t208 * t3 * t36 * t5;
+        V t604 = 80 * t153 * t208 * t3 * t5;
+        V t605 = -696 * t266;
+        V t606 = 416 * psi * t266;
+        V t607 = -32 * t266 * t36;
+        V t608 = 28 * t153 * t266;
+        V t609 = 20 * t159 * t266;
+        V t610 = 792 * t266 * t3;
+        V t611 = -1184 * psi * t266 * t3;
+        V t612 = 612 * t266 * t3 * t36;
+        V t613 = -184 * t153 * t266 * t3;
+        V t614 = -36 * t159 * t266 * t3;
+        V t615 = 968 * t22 * t266;
+        V t616 = -264 * psi * t22 * t266;
+        V t617 = -352 * t22 * t266 * t36;
+        V t618 = 108 * t153 * t22 * t266;
+        V t619 = -20 * t159 * t22 * t266;
+        V t620 = -1128 * t22 * t266 * t3;
+        V t621 = 2120 * psi * t22 * t266 * t3;
+        V t622 = -1396 * t22 * t266 * t3 * t36;
+        V t623 = 368 * t153 * t22 * t266 * t3;
+        V t624 = 36 * t159 * t22 * t266 * t3;
+        V t625 = -336 * t266 * t73;
+        V t626 = -448 * psi * t266 * t73;
+        V t627 = 928 * t266 * t36 * t73;
+        V t628 = -320 * t153 * t266 * t73;
+        V t629 = 400 * t266 * t3 * t73;
+        V t630 = 720 * t266 * t3 * t36 * t73;
+        V t631 = -160 * t153 * t266 * t3 * t73;
+        V t632 = 320 * psi * t208 * t266;
+        V t633 = -480 * t208 * t266 * t36;
+        V t634 = 160 * t153 * t208 * t266;
+        V t635 = 672 * t298;
+        V t636 = -1148 * psi * t298;
+        V t637 = 640 * t298 * t36;
+        V t638 = -148 * t153 * t298;
+        V t639 = -16 * t159 * t298;
+        V t640 = -928 * t22 * t298;
+        V t641 = 1916 * psi * t22 * t298;
+        V t642 = -1344 * t22 * t298 * t36;
+        V t643 = 340 * t153 * t22 * t298;
+        V t644 = 16 * t159 * t22 * t298;
+        V t645 = 320 * t298 * t73;
+        V t646 = -800 * psi * t298 * t73;
+        V t647 = 640 * t298 * t36 * t73;
+        V t648 = -160 * t153 * t298 * t73;
+        V t649 = 110 * t24;
+        V t650 = 190 * psi * t24;
+        V t651 = -86 * t24 * t36;
+        V t652 = -46 * t153 * t24;
+        V t653 = -410 * t24 * t3;
+        V t654 = -400 * psi * t24 * t3;
+        V t655 = 230 * t24 * t3 * t36;
+        V t656 = 100 * t153 * t24 * t3;
+        V t657 = 498 * t161 * t24;
+        V t658 = 34 * psi * t161 * t24;
+        V t659 = -242 * t161 * t24 * t36;
+        V t660 = 22 * t153 * t161 * t24;
+        V t661 = -198 * t167 * t24;
+        V t662 = 192 * psi * t167 * t24;
+        V t663 = 114 * t167 * t24 * t36;
+        V t664 = -108 * t153 * t167 * t24;
+        V t665 = -78 * t22 * t24;
+        V t666 = -392 * psi * t22 * t24;
+        V t667 = 200 * t22 * t24 * t36;
+        V t668 = 130 * t153 * t22 * t24;
+        V t669 = 298 * t22 * t24 * t3;
+        V t670 = 952 * psi * t22 * t24 * t3;
+        V t671 = -470 * t22 * t24 * t3 * t36;
+        V t672 = -380 * t153 * t22 * t24 * t3;
+        V t673 = -370 * t161 * t22 * t24;
+        V t674 = -392 * psi * t161 * t22 * t24;
+        V t675 = 288 * t161 * t22 * t24 * t36;
+        V t676 = 214 * t153 * t161 * t22 * t24;
+        V t678 = -200 * psi * t167 * t22 * t24;
+        V t679 = -50 * t167 * t22 * t24 * t36;
+        V t680 = 100 * t153 * t167 * t22 * t24;
+        V t681 = 204 * psi * t24 * t73;
+        V t682 = -132 * t24 * t36 * t73;
+        V t683 = -72 * t153 * t24 * t73;
+        V t684 = -568 * psi * t24 * t3 * t73;
+        V t685 = 328 * t24 * t3 * t36 * t73;
+        V t686 = 240 * t153 * t24 * t3 * t73;
+        V t687 = 380 * psi * t161 * t24 * t73;
+        V t688 = -180 * t161 * t24 * t36 * t73;
+        V t689 = -200 * t153 * t161 * t24 * t73;
+        V t690 = -1020 * t24 * t5;
+        V t691 = -918 * psi * t24 * t5;
+        V t692 = 980 * t24 * t36 * t5;
+        V t693 = 78 * t153 * t24 * t5;
+        V t694 = 16 * t159 * t24 * t5;
+        V t695 = 2504 * t24 * t3 * t5;
+        V t696 = -168 * psi * t24 * t3 * t5;
+        V t697 = -1236 * t24 * t3 * t36 * t5;
+        V t698 = 112 * t153 * t24 * t3 * t5;
+        V t699 = -60 * t159 * t24 * t3 * t5;
+        V t700 = -1500 * t161 * t24 * t5;
+        V t701 = 1894 * psi * t161 * t24 * t5;
+        V t702 = 40 * t161 * t24 * t36 * t5;
+        V t703 = -470 * t153 * t161 * t24 * t5;
+        V t704 = 36 * t159 * t161 * t24 * t5;
+        V t705 = 716 * t22 * t24 * t5;
+        V t706 = 2464 * psi * t22 * t24 * t5;
+        V t707 = -2192 * t22 * t24 * t36 * t5;
+        V t708 = -264 * t153 * t22 * t24 * t5;
+        V t709 = -4 * t159 * t22 * t24 * t5;
+        V t710 = -1800 * t22 * t24 * t3 * t5;
+        V t711 = -2032 * psi * t22 * t24 * t3 * t5;
+        V t712 = 2596 * t22 * t24 * t3 * t36 * t5;
+        V t713 = 264 * t153 * t22 * t24 * t3 * t5;
+        V t714 = 12 * t159 * t22 * t24 * t3 * t5;
+        V t715 = 1100 * t161 * t22 * t24 * t5;
+        V t716 = -1840 * psi * t161 * t22 * t24 * t5;
+        V t717 = 380 * t161 * t22 * t24 * t36 * t5;
+        V t719 = -1472 * psi * t24 * t5 * t73;
+        V t720 = 1376 * t24 * t36 * t5 * t73;
+        V t721 = 96 * t153 * t24 * t5 * t73;
+        V t722 = 2080 * psi * t24 * t3 * t5 * t73;
+        V t723 = -160 * t153 * t24 * t3 * t5 * t73;
+        V t724 = 3048 * t24 * t266;
+        V t725 = -528 * psi * t24 * t266;
+        V t726 = -1800 * t24 * t266 * t36;
+        V t727 = 384 * t153 * t24 * t266;
+        V t728 = -48 * t159 * t24 * t266;
+        V t729 = -3656 * t24 * t266 * t3;
+        V t730 = 5488 * psi * t24 * t266 * t3;
+        V t731 = -1328 * t24 * t266 * t3 * t36;
+        V t732 = -576 * t153 * t24 * t266 * t3;
+        V t733 = 72 * t159 * t24 * t266 * t3;
+        V t734 = -2120 * t22 * t24 * t266;
+        V t735 = -2624 * psi * t22 * t24 * t266;
+        V t736 = 4472 * t22 * t24 * t266 * t36;
+        V t737 = -616 * t153 * t22 * t24 * t266;
+        V t738 = 8 * t159 * t22 * t24 * t266;
+        V t739 = 2600 * t22 * t24 * t266 * t3;
+        V t740 = -4960 * psi * t22 * t24 * t266 * t3;
+        V t741 = 2120 * t22 * t24 * t266 * t3 * t36;
+        V t742 = 240 * t153 * t22 * t24 * t266 * t3;
+        V t743 = 2640 * psi * t24 * t266 * t73;
+        V t744 = -3120 * t24 * t266 * t36 * t73;
+        V t745 = 480 * t153 * t24 * t266 * t73;
+        V t746 = -2896 * t24 * t298;
+        V t747 = 4936 * psi * t24 * t298;
+        V t748 = -1936 * t24 * t298 * t36;
+        V t749 = -136 * t153 * t24 * t298;
+        V t750 = 32 * t159 * t24 * t298;
+        V t751 = 2000 * t22 * t24 * t298;
+        V t752 = -4160 * psi * t22 * t24 * t298;
+        V t753 = 2320 * t22 * t24 * t298 * t36;
+        V t754 = -160 * t153 * t22 * t24 * t298;
+        V t755 = -126 * t100;
+        V t756 = -548 * psi * t100;
+        V t757 = 210 * t100 * t36;
+        V t758 = 296 * t100 * t153;
+        V t759 = 498 * t100 * t3;
+        V t760 = 1416 * psi * t100 * t3;
+        V t761 = -590 * t100 * t3 * t36;
+        V t762 = -844 * t100 * t153 * t3;
+        V t763 = -642 * t100 * t161;
+        V t764 = -708 * psi * t100 * t161;
+        V t765 = 630 * t100 * t161 * t36;
+        V t766 = 408 * t100 * t153 * t161;
+        V t767 = 270 * t100 * t167;
+        V t768 = -240 * psi * t100 * t167;
+        V t769 = -330 * t100 * t167 * t36;
+        V t770 = 300 * t100 * t153 * t167;
+        V t771 = 564 * psi * t100 * t22;
+        V t772 = -204 * t100 * t22 * t36;
+        V t773 = -360 * t100 * t153 * t22;
+        V t774 = -1624 * psi * t100 * t22 * t3;
+        V t775 = 424 * t100 * t22 * t3 * t36;
+        V t776 = 1200 * t100 * t153 * t22 * t3;
+        V t777 = 1140 * psi * t100 * t161 * t22;
+        V t778 = -140 * t100 * t161 * t22 * t36;
+        V t779 = -1000 * t100 * t153 * t161 * t22;
+        V t780 = 1140 * t100 * t5;
+        V t781 = 3416 * psi * t100 * t5;
+        V t782 = -2596 * t100 * t36 * t5;
+        V t783 = -1088 * t100 * t153 * t5;
+        V t784 = -8 * t100 * t159 * t5;
+        V t785 = -2952 * t100 * t3 * t5;
+        V t786 = -3216 * psi * t100 * t3 * t5;
+        V t787 = 4048 * t100 * t3 * t36 * t5;
+        V t788 = 944 * t100 * t153 * t3 * t5;
+        V t789 = 24 * t100 * t159 * t3 * t5;
+        V t790 = 1860 * t100 * t161 * t5;
+        V t791 = -2280 * psi * t100 * t161 * t5;
+        V t792 = -1020 * t100 * t161 * t36 * t5;
+        V t793 = 1440 * t100 * t153 * t161 * t5;
+        V t794 = -4016 * psi * t100 * t22 * t5;
+        V t795 = 2624 * t100 * t22 * t36 * t5;
+        V t796 = 1392 * t100 * t153 * t22 * t5;
+        V t797 = 5840 * psi * t100 * t22 * t3 * t5;
+        V t798 = -3520 * t100 * t22 * t3 * t36 * t5;
+        V t799 = -2320 * t100 * t153 * t22 * t3 * t5;
+        V t800 = -3336 * t100 * t266;
+        V t801 = -3728 * psi * t100 * t266;
+        V t802 = 6056 * t100 * t266 * t36;
+        V t803 = -64 * t100 * t153 * t266;
+        V t804 = 16 * t100 * t159 * t266;
+        V t805 = 4200 * t100 * t266 * t3;
+        V t806 = -6240 * psi * t100 * t266 * t3;
+        V t807 = -120 * t100 * t266 * t3 * t36;
+        V t808 = 7120 * psi * t100 * t22 * t266;
+        V t809 = -6480 * t100 * t22 * t266 * t36;
+        V t810 = -640 * t100 * t153 * t22 * t266;
+        V t811 = 3120 * t100 * t298;
+        V t812 = -5280 * psi * t100 * t298;
+        V t813 = 1200 * t100 * t298 * t36;
+        V t814 = 960 * t100 * t153 * t298;
+        V t815 = 504 * psi * t491;
+        V t816 = -72 * t36 * t491;
+        V t817 = -1488 * psi * t3 * t491;
+        V t818 = 48 * t3 * t36 * t491;
+        V t819 = 1440 * t153 * t3 * t491;
+        V t820 = 1080 * psi * t161 * t491;
+        V t821 = 120 * t161 * t36 * t491;
+        V t822 = -1200 * t153 * t161 * t491;
+        V t823 = -3552 * psi * t491 * t5;
+        V t824 = 1536 * t36 * t491 * t5;
+        V t825 = 2016 * t153 * t491 * t5;
+        V t826 = 5280 * psi * t3 * t491 * t5;
+        V t827 = -1920 * t3 * t36 * t491 * t5;
+        V t828 = -3360 * t153 * t3 * t491 * t5;
+        V t829 = 6240 * psi * t266 * t491;
+        V t830 = -1920 * t153 * t266 * t491;
+        V t831 =
             -24 + t222 + t237 + t292 + t394 + t483 + t494 + t508 + t512 + t513 + t514 +
             t515 + t516 + t517 + t518 + t519 + t520 + t521 + t522 + t523 + t524 + t525 +
             t526 + t527 + t528 + t529 + t530 + t531 + t532 + t533 + t534 + t535 + t536 +
@@ -2098,317 +2145,317 @@ struct E2_1 {
             t801 + t802 + t803 + t804 + t805 + t806 + t807 + t808 + t809 + t810 + t811 +
             t812 + t813 + t814 + t815 + t816 + t817 + t818 + t819 + t820 + t821 + t822 +
             t823 + t824 + t825 + t826 + t827 + t828 + t829 + t830;
-        double t833 = -6 * psi;
-        double t834 = 8 * t36;
-        double t835 = 44 * t3;
-        double t836 = 4 * psi * t3;
-        double t837 = -37 * t3 * t36;
-        double t838 = -9 * t153 * t3;
-        double t839 = -72 * t161;
-        double t840 = 46 * psi * t161;
-        double t841 = 12 * t161 * t36;
-        double t842 = 6 * t153 * t161;
-        double t843 = -60 * psi * t167;
-        double t844 = 33 * t167 * t36;
-        double t845 = -3 * t153 * t167;
-        double t846 = 37 * psi * t22;
-        double t847 = -19 * t22 * t36;
-        double t848 = -78 * t22 * t3;
-        double t849 = -119 * psi * t22 * t3;
-        double t850 = 140 * t22 * t3 * t36;
-        double t851 = 55 * t153 * t22 * t3;
-        double t852 = 130 * t161 * t22;
-        double t853 = 35 * psi * t161 * t22;
-        double t854 = -153 * t161 * t22 * t36;
-        double t855 = -4 * t153 * t161 * t22;
-        double t856 = -66 * t167 * t22;
-        double t857 = 95 * psi * t167 * t22;
-        double t858 = -16 * t167 * t22 * t36;
-        double t859 = -19 * t153 * t167 * t22;
-        double t860 = -40 * psi * t73;
-        double t861 = -6 * t36 * t73;
-        double t862 = 34 * t3 * t73;
-        double t863 = 160 * psi * t3 * t73;
-        double t864 = -78 * t3 * t36 * t73;
-        double t865 = -58 * t161 * t73;
-        double t866 = -128 * psi * t161 * t73;
-        double t867 = 142 * t161 * t36 * t73;
-        double t868 = 30 * t167 * t73;
-        double t869 = -10 * t167 * t36 * t73;
-        double t870 = 12 * psi * t208;
-        double t871 = 12 * t208 * t36;
-        double t872 = -56 * psi * t208 * t3;
-        double t873 = -8 * t208 * t3 * t36;
-        double t874 = 60 * psi * t161 * t208;
-        double t875 = -20 * t161 * t208 * t36;
-        double t876 = 60 * t5;
-        double t877 = 26 * psi * t5;
-        double t878 = -50 * t36 * t5;
-        double t879 = -36 * t153 * t5;
-        double t880 = -224 * t3 * t5;
-        double t881 = 112 * psi * t3 * t5;
-        double t882 = 114 * t3 * t36 * t5;
-        double t883 = -10 * t153 * t3 * t5;
-        double t884 = 8 * t159 * t3 * t5;
-        double t885 = 180 * t161 * t5;
-        double t886 = -290 * psi * t161 * t5;
-        double t887 = 96 * t161 * t36 * t5;
-        double t888 = 30 * t153 * t161 * t5;
-        double t889 = -16 * t159 * t161 * t5;
-        double t890 = -104 * t22 * t5;
-        double t891 = -230 * psi * t22 * t5;
-        double t892 = 126 * t22 * t36 * t5;
-        double t893 = 208 * t153 * t22 * t5;
-        double t894 = 392 * t22 * t3 * t5;
-        double t895 = 268 * psi * t22 * t3 * t5;
-        double t896 = -606 * t22 * t3 * t36 * t5;
-        double t897 = -46 * t153 * t22 * t3 * t5;
-        double t898 = -8 * t159 * t22 * t3 * t5;
-        double t899 = -320 * t161 * t22 * t5;
-        double t900 = 370 * psi * t161 * t22 * t5;
-        double t901 = 144 * t161 * t22 * t36 * t5;
-        double t902 = -210 * t153 * t161 * t22 * t5;
-        double t903 = 16 * t159 * t161 * t22 * t5;
-        double t904 = 44 * t5 * t73;
-        double t905 = 240 * psi * t5 * t73;
-        double t906 = 84 * t36 * t5 * t73;
-        double t907 = -368 * t153 * t5 * t73;
-        double t908 = -168 * t3 * t5 * t73;
-        double t909 = -472 * psi * t3 * t5 * t73;
-        double t910 = 304 * t3 * t36 * t5 * t73;
-        double t911 = 336 * t153 * t3 * t5 * t73;
-        double t912 = 140 * t161 * t5 * t73;
-        double t913 = -120 * psi * t161 * t5 * t73;
-        double t914 = -180 * t161 * t36 * t5 * t73;
-        double t915 = 160 * t153 * t161 * t5 * t73;
-        double t916 = -64 * psi * t208 * t5;
-        double t917 = -112 * t208 * t36 * t5;
-        double t918 = 176 * t153 * t208 * t5;
-        double t919 = 160 * psi * t208 * t3 * t5;
-        double t920 = 80 * t208 * t3 * t36 * t5;
-        double t921 = -240 * t153 * t208 * t3 * t5;
-        double t922 = -144 * t266;
-        double t923 = -8 * psi * t266;
-        double t924 = 144 * t266 * t36;
-        double t925 = 4 * t153 * t266;
-        double t926 = 4 * t159 * t266;
-        double t927 = 272 * t266 * t3;
-        double t928 = -360 * psi * t266 * t3;
-        double t929 = -56 * t266 * t3 * t36;
-        double t930 = 164 * t153 * t266 * t3;
-        double t931 = -20 * t159 * t266 * t3;
-        double t932 = 248 * t22 * t266;
-        double t933 = 412 * psi * t22 * t266;
-        double t934 = -476 * t22 * t266 * t36;
-        double t935 = -180 * t153 * t22 * t266;
-        double t936 = -4 * t159 * t22 * t266;
-        double t937 = -472 * t22 * t266 * t3;
-        double t938 = 260 * psi * t22 * t266 * t3;
-        double t939 = 820 * t22 * t266 * t3 * t36;
-        double t940 = -628 * t153 * t22 * t266 * t3;
-        double t941 = 20 * t159 * t22 * t266 * t3;
-        double t942 = -104 * t266 * t73;
-        double t943 = -400 * psi * t266 * t73;
-        double t944 = -56 * t266 * t36 * t73;
-        double t945 = 560 * t153 * t266 * t73;
-        double t946 = 200 * t266 * t3 * t73;
-        double t947 = -600 * t266 * t3 * t36 * t73;
-        double t948 = 400 * t153 * t266 * t3 * t73;
-        double t949 = 80 * psi * t208 * t266;
-        double t950 = 240 * t208 * t266 * t36;
-        double t951 = -320 * t153 * t208 * t266;
-        double t952 = 112 * t298;
-        double t953 = -40 * psi * t298;
-        double t954 = -248 * t298 * t36;
-        double t955 = 184 * t153 * t298;
-        double t956 = -8 * t159 * t298;
-        double t957 = -192 * t22 * t298;
-        double t958 = -200 * psi * t22 * t298;
-        double t959 = 952 * t22 * t298 * t36;
-        double t960 = -568 * t153 * t22 * t298;
-        double t961 = 8 * t159 * t22 * t298;
-        double t962 = 80 * t298 * t73;
-        double t963 = 160 * psi * t298 * t73;
-        double t964 = -560 * t298 * t36 * t73;
-        double t965 = 320 * t153 * t298 * t73;
-        double t966 = 45 * psi * t24;
-        double t967 = -46 * t24 * t36;
-        double t968 = -35 * t153 * t24;
-        double t969 = -190 * t24 * t3;
-        double t970 = -87 * psi * t24 * t3;
-        double t971 = 255 * t24 * t3 * t36;
-        double t972 = 26 * t153 * t24 * t3;
-        double t973 = 318 * t161 * t24;
-        double t974 = -197 * psi * t161 * t24;
-        double t975 = -108 * t161 * t24 * t36;
-        double t976 = -3 * t153 * t161 * t24;
-        double t977 = -162 * t167 * t24;
-        double t978 = 351 * psi * t167 * t24;
-        double t979 = -249 * t167 * t24 * t36;
-        double t980 = 48 * t153 * t167 * t24;
-        double t981 = -160 * psi * t22 * t24;
-        double t982 = 51 * t22 * t24 * t36;
-        double t983 = 141 * t153 * t22 * t24;
-        double t984 = 170 * t22 * t24 * t3;
-        double t985 = 616 * psi * t22 * t24 * t3;
-        double t986 = -580 * t22 * t24 * t3 * t36;
-        double t987 = -214 * t153 * t22 * t24 * t3;
-        double t988 = -290 * t161 * t22 * t24;
-        double t989 = -400 * psi * t161 * t22 * t24;
-        double t990 = 711 * t161 * t22 * t24 * t36;
-        double t991 = -15 * t153 * t161 * t22 * t24;
-        double t992 = -280 * psi * t167 * t22 * t24;
-        double t993 = 110 * t167 * t22 * t24 * t36;
-        double t994 = 20 * t153 * t167 * t22 * t24;
-        double t995 = 84 * psi * t24 * t73;
-        double t996 = 36 * t24 * t36 * t73;
-        double t997 = -120 * t153 * t24 * t73;
-        double t998 = -392 * psi * t24 * t3 * t73;
-        double t999 = 120 * t24 * t3 * t36 * t73;
-        double t1000 = 272 * t153 * t24 * t3 * t73;
-        double t1001 = 420 * psi * t161 * t24 * t73;
-        double t1002 = -300 * t161 * t24 * t36 * t73;
-        double t1003 = -120 * t153 * t161 * t24 * t73;
-        double t1004 = -252 * t24 * t5;
-        double t1005 = -198 * psi * t24 * t5;
-        double t1006 = 174 * t24 * t36 * t5;
-        double t1007 = 288 * t153 * t24 * t5;
-        double t1008 = -12 * t159 * t24 * t5;
-        double t1009 = 952 * t24 * t3 * t5;
-        double t1010 = -388 * psi * t24 * t3 * t5;
-        double t1011 = -476 * t24 * t3 * t36 * t5;
-        double t1012 = -100 * t153 * t24 * t3 * t5;
-        double t1013 = 12 * t159 * t24 * t3 * t5;
-        double t1014 = -780 * t161 * t24 * t5;
-        double t1015 = 1570 * psi * t161 * t24 * t5;
-        double t1016 = -882 * t161 * t24 * t36 * t5;
-        double t1017 = 60 * t153 * t161 * t24 * t5;
-        double t1018 = 32 * t159 * t161 * t24 * t5;
-        double t1019 = 220 * t22 * t24 * t5;
-        double t1020 = 912 * psi * t22 * t24 * t5;
-        double t1021 = -56 * t22 * t24 * t36 * t5;
-        double t1022 = -1088 * t153 * t22 * t24 * t5;
-        double t1023 = 12 * t159 * t22 * t24 * t5;
-        double t1024 = -840 * t22 * t24 * t3 * t5;
-        double t1025 = -1536 * psi * t22 * t24 * t3 * t5;
-        double t1026 = 1700 * t22 * t24 * t3 * t36 * t5;
-        double t1027 = 704 * t153 * t22 * t24 * t3 * t5;
-        double t1028 = -28 * t159 * t22 * t24 * t3 * t5;
-        double t1029 = 700 * t161 * t22 * t24 * t5;
-        double t1030 = -1040 * psi * t161 * t22 * t24 * t5;
-        double t1031 = -20 * t161 * t22 * t24 * t36 * t5;
-        double t1032 = -448 * psi * t24 * t5 * t73;
-        double t1033 = -480 * t24 * t36 * t5 * t73;
-        double t1034 = 928 * t153 * t24 * t5 * t73;
-        double t1035 = 1120 * psi * t24 * t3 * t5 * t73;
-        double t1036 = -1120 * t153 * t24 * t3 * t5 * t73;
-        double t1037 = 600 * t24 * t266;
-        double t1038 = 60 * psi * t24 * t266;
-        double t1039 = -256 * t24 * t266 * t36;
-        double t1040 = -412 * t153 * t24 * t266;
-        double t1041 = 8 * t159 * t24 * t266;
-        double t1042 = -1144 * t24 * t266 * t3;
-        double t1043 = 1892 * psi * t24 * t266 * t3;
-        double t1044 = -404 * t24 * t266 * t3 * t36;
-        double t1045 = -384 * t153 * t24 * t266 * t3;
-        double t1046 = 40 * t159 * t24 * t266 * t3;
-        double t1047 = -520 * t22 * t24 * t266;
-        double t1048 = -1344 * psi * t22 * t24 * t266;
-        double t1049 = 124 * t22 * t24 * t266 * t36;
-        double t1050 = 1756 * t153 * t22 * t24 * t266;
-        double t1051 = -16 * t159 * t22 * t24 * t266;
-        double t1052 = 1000 * t22 * t24 * t266 * t3;
-        double t1053 = -800 * psi * t22 * t24 * t266 * t3;
-        double t1054 = -1400 * t22 * t24 * t266 * t3 * t36;
-        double t1055 = 1200 * t153 * t22 * t24 * t266 * t3;
-        double t1056 = 560 * psi * t24 * t266 * t73;
-        double t1057 = 1200 * t24 * t266 * t36 * t73;
-        double t1058 = -1760 * t153 * t24 * t266 * t73;
-        double t1059 = -464 * t24 * t298;
-        double t1060 = 312 * psi * t24 * t298;
-        double t1061 = 760 * t24 * t298 * t36;
-        double t1062 = -624 * t153 * t24 * t298;
-        double t1063 = 16 * t159 * t24 * t298;
-        double t1064 = 400 * t22 * t24 * t298;
-        double t1065 = 320 * psi * t22 * t24 * t298;
-        double t1066 = -1840 * t22 * t24 * t298 * t36;
-        double t1067 = 1120 * t153 * t22 * t24 * t298;
-        double t1068 = -136 * psi * t100;
-        double t1069 = 126 * t100 * t36;
-        double t1070 = 50 * t100 * t153;
-        double t1071 = 204 * t100 * t3;
-        double t1072 = 480 * psi * t100 * t3;
-        double t1073 = -800 * t100 * t3 * t36;
-        double t1074 = 100 * t100 * t153 * t3;
-        double t1075 = -348 * t100 * t161;
-        double t1076 = -120 * psi * t100 * t161;
-        double t1077 = 678 * t100 * t161 * t36;
-        double t1078 = -198 * t100 * t153 * t161;
-        double t1079 = 180 * t100 * t167;
-        double t1080 = -480 * psi * t100 * t167;
-        double t1081 = 420 * t100 * t167 * t36;
-        double t1082 = -120 * t100 * t153 * t167;
-        double t1083 = 192 * psi * t100 * t22;
-        double t1084 = -48 * t100 * t22 * t36;
-        double t1085 = -144 * t100 * t153 * t22;
-        double t1086 = -896 * psi * t100 * t22 * t3;
-        double t1087 = 752 * t100 * t22 * t3 * t36;
-        double t1088 = 144 * t100 * t153 * t22 * t3;
-        double t1089 = 960 * psi * t100 * t161 * t22;
-        double t1090 = -1120 * t100 * t161 * t22 * t36;
-        double t1091 = 160 * t100 * t153 * t161 * t22;
-        double t1092 = 264 * t100 * t5;
-        double t1093 = 664 * psi * t100 * t5;
-        double t1094 = -352 * t100 * t36 * t5;
-        double t1095 = -600 * t100 * t153 * t5;
-        double t1096 = 24 * t100 * t159 * t5;
-        double t1097 = -1008 * t100 * t3 * t5;
-        double t1098 = -576 * psi * t100 * t3 * t5;
-        double t1099 = 1528 * t100 * t3 * t36 * t5;
-        double t1100 = 112 * t100 * t153 * t3 * t5;
-        double t1101 = -56 * t100 * t159 * t3 * t5;
-        double t1102 = 840 * t100 * t161 * t5;
-        double t1103 = -2040 * psi * t100 * t161 * t5;
-        double t1104 = 1560 * t100 * t161 * t36 * t5;
-        double t1105 = -360 * t100 * t153 * t161 * t5;
-        double t1106 = -1024 * psi * t100 * t22 * t5;
-        double t1107 = -272 * t100 * t22 * t36 * t5;
-        double t1108 = 1296 * t100 * t153 * t22 * t5;
-        double t1109 = 2560 * psi * t100 * t22 * t3 * t5;
-        double t1110 = -1520 * t100 * t22 * t3 * t36 * t5;
-        double t1111 = -1040 * t100 * t153 * t22 * t3 * t5;
-        double t1112 = -624 * t100 * t266;
-        double t1113 = -544 * psi * t100 * t266;
-        double t1114 = -136 * t100 * t266 * t36;
-        double t1115 = 1336 * t100 * t153 * t266;
-        double t1116 = -32 * t100 * t159 * t266;
-        double t1117 = 1200 * t100 * t266 * t3;
-        double t1118 = -2400 * psi * t100 * t266 * t3;
-        double t1119 = 1200 * t100 * t266 * t3 * t36;
-        double t1120 = 1280 * psi * t100 * t22 * t266;
-        double t1121 = 1440 * t100 * t22 * t266 * t36;
-        double t1122 = -2720 * t100 * t153 * t22 * t266;
-        double t1123 = 480 * t100 * t298;
-        double t1124 = -480 * psi * t100 * t298;
-        double t1125 = -480 * t100 * t298 * t36;
-        double t1126 = 480 * t100 * t153 * t298;
-        double t1127 = 144 * psi * t491;
-        double t1128 = -144 * t36 * t491;
-        double t1129 = -672 * psi * t3 * t491;
-        double t1130 = 960 * t3 * t36 * t491;
-        double t1131 = -288 * t153 * t3 * t491;
-        double t1132 = 720 * psi * t161 * t491;
-        double t1133 = -1200 * t161 * t36 * t491;
-        double t1134 = 480 * t153 * t161 * t491;
-        double t1135 = -768 * psi * t491 * t5;
-        double t1136 = 480 * t36 * t491 * t5;
-        double t1137 = 288 * t153 * t491 * t5;
-        double t1138 = 1920 * psi * t3 * t491 * t5;
-        double t1139 = -2400 * t3 * t36 * t491 * t5;
-        double t1140 = 480 * t153 * t3 * t491 * t5;
-        double t1141 = 960 * psi * t266 * t491;
-        double t1142 = -960 * t153 * t266 * t491;
-        double t1143 =
+        V t833 = -6 * psi;
+        V t834 = 8 * t36;
+        V t835 = 44 * t3;
+        V t836 = 4 * psi * t3;
+        V t837 = -37 * t3 * t36;
+        V t838 = -9 * t153 * t3;
+        V t839 = -72 * t161;
+        V t840 = 46 * psi * t161;
+        V t841 = 12 * t161 * t36;
+        V t842 = 6 * t153 * t161;
+        V t843 = -60 * psi * t167;
+        V t844 = 33 * t167 * t36;
+        V t845 = -3 * t153 * t167;
+        V t846 = 37 * psi * t22;
+        V t847 = -19 * t22 * t36;
+        V t848 = -78 * t22 * t3;
+        V t849 = -119 * psi * t22 * t3;
+        V t850 = 140 * t22 * t3 * t36;
+        V t851 = 55 * t153 * t22 * t3;
+        V t852 = 130 * t161 * t22;
+        V t853 = 35 * psi * t161 * t22;
+        V t854 = -153 * t161 * t22 * t36;
+        V t855 = -4 * t153 * t161 * t22;
+        V t856 = -66 * t167 * t22;
+        V t857 = 95 * psi * t167 * t22;
+        V t858 = -16 * t167 * t22 * t36;
+        V t859 = -19 * t153 * t167 * t22;
+        V t860 = -40 * psi * t73;
+        V t861 = -6 * t36 * t73;
+        V t862 = 34 * t3 * t73;
+        V t863 = 160 * psi * t3 * t73;
+        V t864 = -78 * t3 * t36 * t73;
+        V t865 = -58 * t161 * t73;
+        V t866 = -128 * psi * t161 * t73;
+        V t867 = 142 * t161 * t36 * t73;
+        V t868 = 30 * t167 * t73;
+        V t869 = -10 * t167 * t36 * t73;
+        V t870 = 12 * psi * t208;
+        V t871 = 12 * t208 * t36;
+        V t872 = -56 * psi * t208 * t3;
+        V t873 = -8 * t208 * t3 * t36;
+        V t874 = 60 * psi * t161 * t208;
+        V t875 = -20 * t161 * t208 * t36;
+        V t876 = 60 * t5;
+        V t877 = 26 * psi * t5;
+        V t878 = -50 * t36 * t5;
+        V t879 = -36 * t153 * t5;
+        V t880 = -224 * t3 * t5;
+        V t881 = 112 * psi * t3 * t5;
+        V t882 = 114 * t3 * t36 * t5;
+        V t883 = -10 * t153 * t3 * t5;
+        V t884 = 8 * t159 * t3 * t5;
+        V t885 = 180 * t161 * t5;
+        V t886 = -290 * psi * t161 * t5;
+        V t887 = 96 * t161 * t36 * t5;
+        V t888 = 30 * t153 * t161 * t5;
+        V t889 = -16 * t159 * t161 * t5;
+        V t890 = -104 * t22 * t5;
+        V t891 = -230 * psi * t22 * t5;
+        V t892 = 126 * t22 * t36 * t5;
+        V t893 = 208 * t153 * t22 * t5;
+        V t894 = 392 * t22 * t3 * t5;
+        V t895 = 268 * psi * t22 * t3 * t5;
+        V t896 = -606 * t22 * t3 * t36 * t5;
+        V t897 = -46 * t153 * t22 * t3 * t5;
+        V t898 = -8 * t159 * t22 * t3 * t5;
+        V t899 = -320 * t161 * t22 * t5;
+        V t900 = 370 * psi * t161 * t22 * t5;
+        V t901 = 144 * t161 * t22 * t36 * t5;
+        V t902 = -210 * t153 * t161 * t22 * t5;
+        V t903 = 16 * t159 * t161 * t22 * t5;
+        V t904 = 44 * t5 * t73;
+        V t905 = 240 * psi * t5 * t73;
+        V t906 = 84 * t36 * t5 * t73;
+        V t907 = -368 * t153 * t5 * t73;
+        V t908 = -168 * t3 * t5 * t73;
+        V t909 = -472 * psi * t3 * t5 * t73;
+        V t910 = 304 * t3 * t36 * t5 * t73;
+        V t911 = 336 * t153 * t3 * t5 * t73;
+        V t912 = 140 * t161 * t5 * t73;
+        V t913 = -120 * psi * t161 * t5 * t73;
+        V t914 = -180 * t161 * t36 * t5 * t73;
+        V t915 = 160 * t153 * t161 * t5 * t73;
+        V t916 = -64 * psi * t208 * t5;
+        V t917 = -112 * t208 * t36 * t5;
+        V t918 = 176 * t153 * t208 * t5;
+        V t919 = 160 * psi * t208 * t3 * t5;
+        V t920 = 80 * t208 * t3 * t36 * t5;
+        V t921 = -240 * t153 * t208 * t3 * t5;
+        V t922 = -144 * t266;
+        V t923 = -8 * psi * t266;
+        V t924 = 144 * t266 * t36;
+        V t925 = 4 * t153 * t266;
+        V t926 = 4 * t159 * t266;
+        V t927 = 272 * t266 * t3;
+        V t928 = -360 * psi * t266 * t3;
+        V t929 = -56 * t266 * t3 * t36;
+        V t930 = 164 * t153 * t266 * t3;
+        V t931 = -20 * t159 * t266 * t3;
+        V t932 = 248 * t22 * t266;
+        V t933 = 412 * psi * t22 * t266;
+        V t934 = -476 * t22 * t266 * t36;
+        V t935 = -180 * t153 * t22 * t266;
+        V t936 = -4 * t159 * t22 * t266;
+        V t937 = -472 * t22 * t266 * t3;
+        V t938 = 260 * psi * t22 * t266 * t3;
+        V t939 = 820 * t22 * t266 * t3 * t36;
+        V t940 = -628 * t153 * t22 * t266 * t3;
+        V t941 = 20 * t159 * t22 * t266 * t3;
+        V t942 = -104 * t266 * t73;
+        V t943 = -400 * psi * t266 * t73;
+        V t944 = -56 * t266 * t36 * t73;
+        V t945 = 560 * t153 * t266 * t73;
+        V t946 = 200 * t266 * t3 * t73;
+        V t947 = -600 * t266 * t3 * t36 * t73;
+        V t948 = 400 * t153 * t266 * t3 * t73;
+        V t949 = 80 * psi * t208 * t266;
+        V t950 = 240 * t208 * t266 * t36;
+        V t951 = -320 * t153 * t208 * t266;
+        V t952 = 112 * t298;
+        V t953 = -40 * psi * t298;
+        V t954 = -248 * t298 * t36;
+        V t955 = 184 * t153 * t298;
+        V t956 = -8 * t159 * t298;
+        V t957 = -192 * t22 * t298;
+        V t958 = -200 * psi * t22 * t298;
+        V t959 = 952 * t22 * t298 * t36;
+        V t960 = -568 * t153 * t22 * t298;
+        V t961 = 8 * t159 * t22 * t298;
+        V t962 = 80 * t298 * t73;
+        V t963 = 160 * psi * t298 * t73;
+        V t964 = -560 * t298 * t36 * t73;
+        V t965 = 320 * t153 * t298 * t73;
+        V t966 = 45 * psi * t24;
+        V t967 = -46 * t24 * t36;
+        V t968 = -35 * t153 * t24;
+        V t969 = -190 * t24 * t3;
+        V t970 = -87 * psi * t24 * t3;
+        V t971 = 255 * t24 * t3 * t36;
+        V t972 = 26 * t153 * t24 * t3;
+        V t973 = 318 * t161 * t24;
+        V t974 = -197 * psi * t161 * t24;
+        V t975 = -108 * t161 * t24 * t36;
+        V t976 = -3 * t153 * t161 * t24;
+        V t977 = -162 * t167 * t24;
+        V t978 = 351 * psi * t167 * t24;
+        V t979 = -249 * t167 * t24 * t36;
+        V t980 = 48 * t153 * t167 * t24;
+        V t981 = -160 * psi * t22 * t24;
+        V t982 = 51 * t22 * t24 * t36;
+        V t983 = 141 * t153 * t22 * t24;
+        V t984 = 170 * t22 * t24 * t3;
+        V t985 = 616 * psi * t22 * t24 * t3;
+        V t986 = -580 * t22 * t24 * t3 * t36;
+        V t987 = -214 * t153 * t22 * t24 * t3;
+        V t988 = -290 * t161 * t22 * t24;
+        V t989 = -400 * psi * t161 * t22 * t24;
+        V t990 = 711 * t161 * t22 * t24 * t36;
+        V t991 = -15 * t153 * t161 * t22 * t24;
+        V t992 = -280 * psi * t167 * t22 * t24;
+        V t993 = 110 * t167 * t22 * t24 * t36;
+        V t994 = 20 * t153 * t167 * t22 * t24;
+        V t995 = 84 * psi * t24 * t73;
+        V t996 = 36 * t24 * t36 * t73;
+        V t997 = -120 * t153 * t24 * t73;
+        V t998 = -392 * psi * t24 * t3 * t73;
+        V t999 = 120 * t24 * t3 * t36 * t73;
+        V t1000 = 272 * t153 * t24 * t3 * t73;
+        V t1001 = 420 * psi * t161 * t24 * t73;
+        V t1002 = -300 * t161 * t24 * t36 * t73;
+        V t1003 = -120 * t153 * t161 * t24 * t73;
+        V t1004 = -252 * t24 * t5;
+        V t1005 = -198 * psi * t24 * t5;
+        V t1006 = 174 * t24 * t36 * t5;
+        V t1007 = 288 * t153 * t24 * t5;
+        V t1008 = -12 * t159 * t24 * t5;
+        V t1009 = 952 * t24 * t3 * t5;
+        V t1010 = -388 * psi * t24 * t3 * t5;
+        V t1011 = -476 * t24 * t3 * t36 * t5;
+        V t1012 = -100 * t153 * t24 * t3 * t5;
+        V t1013 = 12 * t159 * t24 * t3 * t5;
+        V t1014 = -780 * t161 * t24 * t5;
+        V t1015 = 1570 * psi * t161 * t24 * t5;
+        V t1016 = -882 * t161 * t24 * t36 * t5;
+        V t1017 = 60 * t153 * t161 * t24 * t5;
+        V t1018 = 32 * t159 * t161 * t24 * t5;
+        V t1019 = 220 * t22 * t24 * t5;
+        V t1020 = 912 * psi * t22 * t24 * t5;
+        V t1021 = -56 * t22 * t24 * t36 * t5;
+        V t1022 = -1088 * t153 * t22 * t24 * t5;
+        V t1023 = 12 * t159 * t22 * t24 * t5;
+        V t1024 = -840 * t22 * t24 * t3 * t5;
+        V t1025 = -1536 * psi * t22 * t24 * t3 * t5;
+        V t1026 = 1700 * t22 * t24 * t3 * t36 * t5;
+        V t1027 = 704 * t153 * t22 * t24 * t3 * t5;
+        V t1028 = -28 * t159 * t22 * t24 * t3 * t5;
+        V t1029 = 700 * t161 * t22 * t24 * t5;
+        V t1030 = -1040 * psi * t161 * t22 * t24 * t5;
+        V t1031 = -20 * t161 * t22 * t24 * t36 * t5;
+        V t1032 = -448 * psi * t24 * t5 * t73;
+        V t1033 = -480 * t24 * t36 * t5 * t73;
+        V t1034 = 928 * t153 * t24 * t5 * t73;
+        V t1035 = 1120 * psi * t24 * t3 * t5 * t73;
+        V t1036 = -1120 * t153 * t24 * t3 * t5 * t73;
+        V t1037 = 600 * t24 * t266;
+        V t1038 = 60 * psi * t24 * t266;
+        V t1039 = -256 * t24 * t266 * t36;
+        V t1040 = -412 * t153 * t24 * t266;
+        V t1041 = 8 * t159 * t24 * t266;
+        V t1042 = -1144 * t24 * t266 * t3;
+        V t1043 = 1892 * psi * t24 * t266 * t3;
+        V t1044 = -404 * t24 * t266 * t3 * t36;
+        V t1045 = -384 * t153 * t24 * t266 * t3;
+        V t1046 = 40 * t159 * t24 * t266 * t3;
+        V t1047 = -520 * t22 * t24 * t266;
+        V t1048 = -1344 * psi * t22 * t24 * t266;
+        V t1049 = 124 * t22 * t24 * t266 * t36;
+        V t1050 = 1756 * t153 * t22 * t24 * t266;
+        V t1051 = -16 * t159 * t22 * t24 * t266;
+        V t1052 = 1000 * t22 * t24 * t266 * t3;
+        V t1053 = -800 * psi * t22 * t24 * t266 * t3;
+        V t1054 = -1400 * t22 * t24 * t266 * t3 * t36;
+        V t1055 = 1200 * t153 * t22 * t24 * t266 * t3;
+        V t1056 = 560 * psi * t24 * t266 * t73;
+        V t1057 = 1200 * t24 * t266 * t36 * t73;
+        V t1058 = -1760 * t153 * t24 * t266 * t73;
+        V t1059 = -464 * t24 * t298;
+        V t1060 = 312 * psi * t24 * t298;
+        V t1061 = 760 * t24 * t298 * t36;
+        V t1062 = -624 * t153 * t24 * t298;
+        V t1063 = 16 * t159 * t24 * t298;
+        V t1064 = 400 * t22 * t24 * t298;
+        V t1065 = 320 * psi * t22 * t24 * t298;
+        V t1066 = -1840 * t22 * t24 * t298 * t36;
+        V t1067 = 1120 * t153 * t22 * t24 * t298;
+        V t1068 = -136 * psi * t100;
+        V t1069 = 126 * t100 * t36;
+        V t1070 = 50 * t100 * t153;
+        V t1071 = 204 * t100 * t3;
+        V t1072 = 480 * psi * t100 * t3;
+        V t1073 = -800 * t100 * t3 * t36;
+        V t1074 = 100 * t100 * t153 * t3;
+        V t1075 = -348 * t100 * t161;
+        V t1076 = -120 * psi * t100 * t161;
+        V t1077 = 678 * t100 * t161 * t36;
+        V t1078 = -198 * t100 * t153 * t161;
+        V t1079 = 180 * t100 * t167;
+        V t1080 = -480 * psi * t100 * t167;
+        V t1081 = 420 * t100 * t167 * t36;
+        V t1082 = -120 * t100 * t153 * t167;
+        V t1083 = 192 * psi * t100 * t22;
+        V t1084 = -48 * t100 * t22 * t36;
+        V t1085 = -144 * t100 * t153 * t22;
+        V t1086 = -896 * psi * t100 * t22 * t3;
+        V t1087 = 752 * t100 * t22 * t3 * t36;
+        V t1088 = 144 * t100 * t153 * t22 * t3;
+        V t1089 = 960 * psi * t100 * t161 * t22;
+        V t1090 = -1120 * t100 * t161 * t22 * t36;
+        V t1091 = 160 * t100 * t153 * t161 * t22;
+        V t1092 = 264 * t100 * t5;
+        V t1093 = 664 * psi * t100 * t5;
+        V t1094 = -352 * t100 * t36 * t5;
+        V t1095 = -600 * t100 * t153 * t5;
+        V t1096 = 24 * t100 * t159 * t5;
+        V t1097 = -1008 * t100 * t3 * t5;
+        V t1098 = -576 * psi * t100 * t3 * t5;
+        V t1099 = 1528 * t100 * t3 * t36 * t5;
+        V t1100 = 112 * t100 * t153 * t3 * t5;
+        V t1101 = -56 * t100 * t159 * t3 * t5;
+        V t1102 = 840 * t100 * t161 * t5;
+        V t1103 = -2040 * psi * t100 * t161 * t5;
+        V t1104 = 1560 * t100 * t161 * t36 * t5;
+        V t1105 = -360 * t100 * t153 * t161 * t5;
+        V t1106 = -1024 * psi * t100 * t22 * t5;
+        V t1107 = -272 * t100 * t22 * t36 * t5;
+        V t1108 = 1296 * t100 * t153 * t22 * t5;
+        V t1109 = 2560 * psi * t100 * t22 * t3 * t5;
+        V t1110 = -1520 * t100 * t22 * t3 * t36 * t5;
+        V t1111 = -1040 * t100 * t153 * t22 * t3 * t5;
+        V t1112 = -624 * t100 * t266;
+        V t1113 = -544 * psi * t100 * t266;
+        V t1114 = -136 * t100 * t266 * t36;
+        V t1115 = 1336 * t100 * t153 * t266;
+        V t1116 = -32 * t100 * t159 * t266;
+        V t1117 = 1200 * t100 * t266 * t3;
+        V t1118 = -2400 * psi * t100 * t266 * t3;
+        V t1119 = 1200 * t100 * t266 * t3 * t36;
+        V t1120 = 1280 * psi * t100 * t22 * t266;
+        V t1121 = 1440 * t100 * t22 * t266 * t36;
+        V t1122 = -2720 * t100 * t153 * t22 * t266;
+        V t1123 = 480 * t100 * t298;
+        V t1124 = -480 * psi * t100 * t298;
+        V t1125 = -480 * t100 * t298 * t36;
+        V t1126 = 480 * t100 * t153 * t298;
+        V t1127 = 144 * psi * t491;
+        V t1128 = -144 * t36 * t491;
+        V t1129 = -672 * psi * t3 * t491;
+        V t1130 = 960 * t3 * t36 * t491;
+        V t1131 = -288 * t153 * t3 * t491;
+        V t1132 = 720 * psi * t161 * t491;
+        V t1133 = -1200 * t161 * t36 * t491;
+        V t1134 = 480 * t153 * t161 * t491;
+        V t1135 = -768 * psi * t491 * t5;
+        V t1136 = 480 * t36 * t491 * t5;
+        V t1137 = 288 * t153 * t491 * t5;
+        V t1138 = 1920 * psi * t3 * t491 * t5;
+        V t1139 = -2400 * t3 * t36 * t491 * t5;
+        V t1140 = 480 * t153 * t3 * t491 * t5;
+        V t1141 = 960 * psi * t266 * t491;
+        V t1142 = -960 * t153 * t266 * t491;
+        V t1143 =
             -8 + t1000 + t1001 + t1002 + t1003 + t1004 + t1005 + t1006 + t1007 + t1008 +
             t1009 + t101 + t1010 + t1011 + t1012 + t1013 + t1014 + t1015 + t1016 + t1017 +
             t1018 + t1019 + t1020 + t1021 + t1022 + t1023 + t1024 + t1025 + t1026 +
@@ -2443,7 +2490,7 @@ struct E2_1 {
             t967 + t968 + t969 + t970 + t971 + t972 + t973 + t974 + t975 + t976 + t977 +
             t978 + t979 + t980 + t981 + t982 + t983 + t984 + t985 + t986 + t987 + t988 +
             t989 + t990 + t991 + t992 + t993 + t994 + t995 + t996 + t997 + t998 + t999;
-        double t1144 = (3 * t1143 * t511) / 2.;
+        V t1144 = (3 * t1143 * t511) / 2.;
         // c[0] = -1 + t3 + t9;
         // c[1] = -(psi * (-1 + 2 * t3 + 3 * t5));
         // c[2] = 1 + t11 + t12 + t13 + t14 + 3 * psi * t5;
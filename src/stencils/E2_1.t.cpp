@@ -96,3 +96,39 @@ TEST_CASE("E2_1")
                               -12.}));
     }
 }
+
+TEST_CASE("E2_1 alpha derivatives")
+{
+    using T = std::vector<real>;
+
+    const T alpha{
+        -1.47956280234494, 0.261900367793859, -0.145072532538541, -0.224665713988644};
+    const auto st = stencils::make_E2_1(alpha);
+    REQUIRE(st.parameters() == 4);
+
+    // compare with central differences
+    const real eps = 1e-6;
+    for (auto bc : {bcs::Floating, bcs::Dirichlet}) {
+        auto [p, r, t, x] = st.query(bc);
+        for (int k = 0; k < 4; k++) {
+            T ap{alpha}, am{alpha};
+            ap[k] += eps;
+            am[k] -= eps;
+
+            T c(r * t), cp(r * t), cm(r * t), ex{};
+            st.nbs_derivative(k, 0.5, bc, 0.37, true, c, ex);
+            stencils::make_E2_1(ap).nbs(0.5, bc, 0.37, true, cp, ex);
+            stencils::make_E2_1(am).nbs(0.5, bc, 0.37, true, cm, ex);
+
+            for (auto&& [d, u, v] : vs::zip(c, cp, cm)) {
+                const real fd = (u - v) / (2 * eps);
+                REQUIRE(d == Catch::Approx(fd).epsilon(1e-6).margin(1e-6));
+            }
+        }
+    }
+
+    // the interior does not depend on alpha
+    T c(3, 1.0);
+    st.parameter_derivative(0).interior(0.5, c);
+    REQUIRE_THAT(c, Approx(T{0, 0, 0}));
+}
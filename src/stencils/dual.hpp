@@ -0,0 +1,79 @@
+#pragma once
+
+#include "types.hpp"
+
+#include <array>
+#include <cmath>
+#include <span>
+
+namespace ccs::stencils
+{
+// A value along with its derivative with respect to a single parameter.  Stencils whose
+// coefficients are written for a generic value type are evaluated with duals to get the
+// derivatives of their coefficients with respect to their free parameters
+struct dual {
+    real v = 0.0;
+    real d = 0.0;
+
+    dual() = default;
+    dual(real v, real d = 0.0) : v{v}, d{d} {}
+
+    dual& operator+=(const dual& o)
+    {
+        v += o.v;
+        d += o.d;
+        return *this;
+    }
+
+    dual& operator-=(const dual& o)
+    {
+        v -= o.v;
+        d -= o.d;
+        return *this;
+    }
+
+    dual& operator*=(const dual& o)
+    {
+        d = d * o.v + v * o.d;
+        v *= o.v;
+        return *this;
+    }
+
+    dual& operator/=(const dual& o)
+    {
+        d = (d * o.v - v * o.d) / (o.v * o.v);
+        v /= o.v;
+        return *this;
+    }
+
+    friend dual operator+(const dual& a) { return a; }
+    friend dual operator-(const dual& a) { return {-a.v, -a.d}; }
+
+    friend dual operator+(dual a, const dual& b) { return a += b; }
+    friend dual operator-(dual a, const dual& b) { return a -= b; }
+    friend dual operator*(dual a, const dual& b) { return a *= b; }
+    friend dual operator/(dual a, const dual& b) { return a /= b; }
+
+    friend dual pow(const dual& a, real p)
+    {
+        return {std::pow(a.v, p), p * std::pow(a.v, p - 1) * a.d};
+    }
+};
+
+// parameters with the k'th one marked as the one to differentiate with respect to.  An
+// out of range k leaves every derivative at zero
+template <std::size_t N>
+std::array<dual, N> seed(const std::array<real, N>& p, int k)
+{
+    std::array<dual, N> s;
+    for (int i = 0; i < (int)N; i++) s[i] = dual{p[i], i == k ? 1.0 : 0.0};
+    return s;
+}
+
+// copy the derivatives of `x` to the front of `c`
+inline std::span<const real> derivatives(std::span<const dual> x, std::span<real> c)
+{
+    for (std::size_t i = 0; i < x.size(); i++) c[i] = x[i].d;
+    return c.subspan(0, x.size());
+}
+} // namespace ccs::stencils
@@ -1,3 +1,4 @@
+#include "dual.hpp"
 #include "stencil.hpp"
 
 #include <range/v3/algorithm/copy.hpp>
@@ -63,23 +64,35 @@ struct polyE2_1 {
 
     std::span<const real>
     interp_wall(int i, real y, real psi, std::span<real> c, bool right) const
+    {
+        return interp_wall(fa, ia, i, y, psi, c, right);
+    }
+
+    template <typename V>
+    static std::span<const V> interp_wall(const std::array<V, 6>& fa,
+                                          const std::array<V, 4>& ia,
+                                          int i,
+                                          real y,
+                                          real psi,
+                                          std::span<V> c,
+                                          bool right)
     {
         if (right) {
-            const real t5 = fa[2];
-            const real t6 = t5 * y;
-            const real t9 = ia[2];
-            const real t13 = -1 * y;
-            const real t7 = fa[3];
-            const real t10 = ia[3];
-            const real t16 = 1 + psi;
-            const real t17 = 1.0 / (t16);
-            const real t8 = t7 * y;
-            const real t30 = fa[0];
-            const real t31 = t30 * y;
-            const real t34 = ia[0];
-            const real t32 = fa[1];
-            const real t35 = ia[1];
-            const real t33 = t32 * y;
+            const V t5 = fa[2];
+            const V t6 = t5 * y;
+            const V t9 = ia[2];
+            const V t13 = -1 * y;
+            const V t7 = fa[3];
+            const V t10 = ia[3];
+            const V t16 = 1 + psi;
+            const V t17 = 1.0 / (t16);
+            const V t8 = t7 * y;
+            const V t30 = fa[0];
+            const V t31 = t30 * y;
+            const V t34 = ia[0];
+            const V t32 = fa[1];
+            const V t35 = ia[1];
+            const V t33 = t32 * y;
             switch (i) {
             case 0:
                 c[0] = (t31 + t33 + t34 + t35) * 0.5;
@@ -103,21 +116,21 @@ struct polyE2_1 {
                 break;
             }
         } else {
-            const real t7 = -1 * y;
-            const real t13 = fa[0];
-            const real t14 = t13 * y;
-            const real t15 = ia[0];
-            const real t5 = 1 + psi;
-            const real t6 = 1.0 / (t5);
-            const real t8 = fa[1];
-            const real t10 = ia[1];
-            const real t9 = t8 * y;
-            const real t36 = fa[2];
-            const real t37 = t36 * y;
-            const real t38 = ia[2];
-            const real t31 = fa[3];
-            const real t33 = ia[3];
-            const real t32 = t31 * y;
+            const V t7 = -1 * y;
+            const V t13 = fa[0];
+            const V t14 = t13 * y;
+            const V t15 = ia[0];
+            const V t5 = 1 + psi;
+            const V t6 = 1.0 / (t5);
+            const V t8 = fa[1];
+            const V t10 = ia[1];
+            const V t9 = t8 * y;
+            const V t36 = fa[2];
+            const V t37 = t36 * y;
+            const V t38 = ia[2];
+            const V t31 = fa[3];
+            const V t33 = ia[3];
+            const V t32 = t31 * y;
             switch (i) {
             case 0:
                 c[0] = (1 + psi + t10 + t7 + t9) * 0.5 * t6;
@@ -173,23 +186,71 @@ struct polyE2_1 {
         }
     }
 
+    int parameters() const { return fa.size() + da.size() + ia.size(); }
+
+    // Derivatives with respect to parameter k of the coefficients that depend on the
+    // free parameters.  The parameters are ordered as floating, dirichlet and
+    // interpolant alpha
+    std::span<const real> nbs_derivative(int k,
+                                         real h,
+                                         bcs::type b,
+                                         real psi,
+                                         bool right,
+                                         std::span<real> c,
+                                         std::span<real>) const
+    {
+        std::array<dual, R * T> work;
+        auto d = std::span<dual>(work);
+
+        switch (b) {
+        case bcs::Floating:
+            return derivatives(nbs_floating(seed(fa, k), h, psi, d, right), c);
+        case bcs::Dirichlet:
+            return derivatives(nbs_dirichlet(seed(da, k - 6), h, psi, d, right), c);
+        default:
+            return c;
+        }
+    }
+
+    std::span<const real> interp_wall_derivative(
+        int k, int i, real y, real psi, std::span<real> c, bool right) const
+    {
+        std::array<dual, 4> work;
+        auto d = std::span<dual>(work);
+        const auto f = seed(fa, k);
+        const auto w = seed(ia, k - 9);
+        return derivatives(interp_wall(f, w, i, y, psi, d, right), c);
+    }
+
+    // the coefficients are written for a generic value type so they can be evaluated
+    // with duals for their derivatives
     std::span<const real>
     nbs_floating(real h, real psi, std::span<real> c, bool right) const
+    {
+        return nbs_floating(fa, h, psi, c, right);
+    }
+
+    template <typename V>
+    static std::span<const V> nbs_floating(const std::array<V, 6>& fa,
+                                           real h,
+                                           real psi,
+                                           std::span<V> c,
+                                           bool right)
     {
         c = c.subspan(0, R * T);
 
-        real t10 = fa[0];
-        real t5 = 1 + psi;
-        real t6 = 1.0 / (t5);
-        real t7 = fa[1];
-        real t8 = -1 + t7;
-        real t22 = fa[2];
-        real t14 = 2 + psi;
-        real t19 = fa[3];
-        real t20 = -1 + t19;
-        real t33 = fa[4];
-        real t30 = fa[5];
-        real t31 = -1 + t30;
+        V t10 = fa[0];
+        V t5 = 1 + psi;
+        V t6 = 1.0 / (t5);
+        V t7 = fa[1];
+        V t8 = -1 + t7;
+        V t22 = fa[2];
+        V t14 = 2 + psi;
+        V t19 = fa[3];
+        V t20 = -1 + t19;
+        V t33 = fa[4];
+        V t30 = fa[5];
+        V t31 = -1 + t30;
         c[0] = 0.5 * t6 * t8;
         c[1] = (-1 + t10) * 0.5;
         c[2] = -1 * t10 + -0.5 * t14 * t6 * t8;
@@ -213,26 +274,36 @@ struct polyE2_1 {
 
     std::span<const real>
     nbs_dirichlet(real h, real psi, std::span<real> c, bool right) const
+    {
+        return nbs_dirichlet(da, h, psi, c, right);
+    }
+
+    template <typename V>
+    static std::span<const V> nbs_dirichlet(const std::array<V, 3>& da,
+                                            real h,
+                                            real psi,
+                                            std::span<V> c,
+                                            bool right)
     {
         c = c.subspan(0, (R - 1) * T);
 
-        real t7 = da[0];
-        real t13 = da[1];
-        real t19 = da[2];
-        real t5 = 1 + psi;
-        real t6 = 1.0 / (t5);
-        real t8 = -1 + t7;
-        real t18 = 2 * psi;
-        real t20 = 3 * t19;
-        real t21 = 2 * psi * t19;
-        real t22 = 1 + t18 + t20 + t21;
-        real t23 = 1.0 / (t22);
-        real t14 = 2 * psi * t13;
-        real t15 = 3 * t13 * t7;
-        real t16 = 2 * psi * t13 * t7;
-        real t29 = -1 * t13;
-        real t25 = 2 + psi;
-        real t43 = -1 + t19;
+        V t7 = da[0];
+        V t13 = da[1];
+        V t19 = da[2];
+        V t5 = 1 + psi;
+        V t6 = 1.0 / (t5);
+        V t8 = -1 + t7;
+        V t18 = 2 * psi;
+        V t20 = 3 * t19;
+        V t21 = 2 * psi * t19;
+        V t22 = 1 + t18 + t20 + t21;
+        V t23 = 1.0 / (t22);
+        V t14 = 2 * psi * t13;
+        V t15 = 3 * t13 * t7;
+        V t16 = 2 * psi * t13 * t7;
+        V t29 = -1 * t13;
+        V t25 = 2 + psi;
+        V t43 = -1 + t19;
         c[0] = 0.5 * t6 * t8;
         c[1] =
             (-1 + -2 * psi + t13 + t14 + t15 + t16 + -3 * t7 + -2 * psi * t7) * 0.5 * t23;
@@ -339,3 +339,52 @@ TEST_CASE("interp wall")
         REQUIRE(yi == Catch::Approx(bf(ymax + y * h)));
     }
 }
+
+TEST_CASE("alpha derivatives")
+{
+    // floating, dirichlet and interpolant alpha
+    const T alpha{
+        0.13, 0.14, 0.15, 0.16, 0.17, 0.18, 0.12, 0.13, 0.14, 0.1, -0.2, 0.05, 0.3};
+    auto make = [](const T& a) {
+        auto s = std::span{a};
+        return stencils::make_polyE2_1(s.subspan(0, 6), s.subspan(6, 3), s.subspan(9, 4));
+    };
+    const auto st = make(alpha);
+    REQUIRE(st.parameters() == 13);
+
+    // compare with central differences
+    const real eps = 1e-6;
+    for (int k = 0; k < 13; k++) {
+        T ap{alpha}, am{alpha};
+        ap[k] += eps;
+        am[k] -= eps;
+        const auto sp = make(ap);
+        const auto sm = make(am);
+
+        auto check = [eps](const T& d, const T& u, const T& v) {
+            for (auto&& [a, b, c] : vs::zip(d, u, v)) {
+                const real fd = (b - c) / (2 * eps);
+                REQUIRE(a == Catch::Approx(fd).epsilon(1e-6).margin(1e-6));
+            }
+        };
+
+        for (auto bc : {bcs::Floating, bcs::Dirichlet}) {
+            auto [p, r, t, x] = st.query(bc);
+            T c(r * t), cp(r * t), cm(r * t), ex{};
+            st.nbs_derivative(k, 0.5, bc, 0.37, false, c, ex);
+            sp.nbs(0.5, bc, 0.37, false, cp, ex);
+            sm.nbs(0.5, bc, 0.37, false, cm, ex);
+            check(c, cp, cm);
+        }
+
+        for (int i = 0; i < 2; i++) {
+            for (bool right : {false, true}) {
+                T c(4), cp(4), cm(4);
+                st.interp_wall_derivative(k, i, 0.3, 0.6, c, right);
+                sp.interp_wall(i, 0.3, 0.6, cp, right);
+                sm.interp_wall(i, 0.3, 0.6, cm, right);
+                check(c, cp, cm);
+            }
+        }
+    }
+}
@@ -4,6 +4,53 @@
 
 namespace ccs::stencils
 {
+namespace
+{
+// the coefficients of `st` differentiated with respect to parameter k
+struct parameter_derivative_stencil {
+    stencil st;
+    int k;
+
+    info query(bcs::type b) const { return st.query(b); }
+    info query_max() const { return st.query_max(); }
+    interp_info query_interp() const { return st.query_interp(); }
+
+    std::span<const real> nbs(real h,
+                              bcs::type b,
+                              real psi,
+                              bool right,
+                              std::span<real> c,
+                              std::span<real> extra) const
+    {
+        auto r = st.nbs_derivative(k, h, b, psi, right, c, extra);
+        // neumann data are taken to be independent of the parameters
+        std::ranges::fill(extra, 0.0);
+        return r;
+    }
+
+    std::span<const real> interior(real h, std::span<real> c) const
+    {
+        return detail::zero(st.interior(h, c), c);
+    }
+
+    std::span<const real> interp_interior(real y, std::span<real> c) const
+    {
+        return detail::zero(st.interp_interior(y, c), c);
+    }
+
+    std::span<const real>
+    interp_wall(int i, real y, real psi, std::span<real> c, bool right) const
+    {
+        return st.interp_wall_derivative(k, i, y, psi, c, right);
+    }
+};
+} // namespace
+
+stencil stencil::parameter_derivative(int k) const
+{
+    return parameter_derivative_stencil{*this, k};
+}
+
 std::optional<stencil> stencil::from_lua(const sol::table& tbl, const logs& logger)
 {
 
@@ -5,6 +5,7 @@
 #include "operators/boundaries.hpp"
 #include "types.hpp"
 
+#include <algorithm>
 #include <concepts>
 #include <optional>
 
@@ -23,11 +24,15 @@ struct info {
     int r;
     int t;
     int nextra;
+
+    bool operator==(const info&) const = default;
 };
 
 struct interp_info {
     int p;
     int t;
+
+    bool operator==(const interp_info&) const = default;
 };
 
 struct interp_line {
@@ -36,6 +41,17 @@ struct interp_line {
     boundary right;
 };
 
+namespace detail
+{
+// zero the coefficients `r` that were written to `c`
+inline std::span<const real> zero(std::span<const real> r, std::span<real> c)
+{
+    auto z = c.subspan(r.data() - c.data(), r.size());
+    std::ranges::fill(z, 0.0);
+    return z;
+}
+} // namespace detail
+
 // satisfaction of Stencil makes a type a stencil
 template <typename T>
 concept Stencil = requires(const T& st,
@@ -88,6 +104,16 @@ class stencil
         virtual std::span<const real> interp_interior(real, std::span<real>) const = 0;
         virtual std::span<const real>
         interp_wall(int i, real y, real psi, std::span<real> c, bool right) const = 0;
+        virtual int parameters() const = 0;
+        virtual std::span<const real> nbs_derivative(int k,
+                                                     real h,
+                                                     bcs::type,
+                                                     real psi,
+                                                     bool ray_outside,
+                                                     std::span<real> coeffs,
+                                                     std::span<real> extra) const = 0;
+        virtual std::span<const real> interp_wall_derivative(
+            int k, int i, real y, real psi, std::span<real> c, bool right) const = 0;
     };
 
     template <Stencil S>
@@ -130,6 +156,39 @@ class stencil
         {
             return s.interp_wall(i, y, psi, c, right);
         }
+
+        // Stencils without free parameters, or whose coefficients are not
+        // differentiated, report none and have zero derivatives
+        int parameters() const override
+        {
+            if constexpr (requires { s.parameters(); })
+                return s.parameters();
+            else
+                return 0;
+        }
+
+        std::span<const real> nbs_derivative(int k,
+                                             real h,
+                                             bcs::type b,
+                                             real psi,
+                                             bool right,
+                                             std::span<real> c,
+                                             std::span<real> extra) const override
+        {
+            if constexpr (requires { s.nbs_derivative(k, h, b, psi, right, c, extra); })
+                return s.nbs_derivative(k, h, b, psi, right, c, extra);
+            else
+                return detail::zero(s.nbs(h, b, psi, right, c, extra), c);
+        }
+
+        std::span<const real> interp_wall_derivative(
+            int k, int i, real y, real psi, std::span<real> c, bool right) const override
+        {
+            if constexpr (requires { s.interp_wall_derivative(k, i, y, psi, c, right); })
+                return s.interp_wall_derivative(k, i, y, psi, c, right);
+            else
+                return detail::zero(s.interp_wall(i, y, psi, c, right), c);
+        }
     };
 
     any_stencil* s;
@@ -202,6 +261,34 @@ public:
             return s->interp_wall(i, y, psi, c, right);
         }
 
+        // Number of free parameters, the alpha, of the stencil and the derivatives of the
+        // coefficients with respect to parameter k.  The interior coefficients do not
+        // depend on the parameters
+        int parameters() const { return s->parameters(); }
+
+        std::span<const real> nbs_derivative(int k,
+                                             real h,
+                                             bcs::type b,
+                                             real psi,
+                                             bool ray_outside,
+                                             std::span<real> c,
+                                             std::span<real> ex) const
+        {
+            return s->nbs_derivative(k, h, b, psi, ray_outside, c, ex);
+        }
+
+        std::span<const real> interp_wall_derivative(
+            int k, int i, real y, real psi, std::span<real> c, bool right) const
+        {
+            return s->interp_wall_derivative(k, i, y, psi, c, right);
+        }
+
+        // A stencil of the same shape whose coefficients are the derivatives of these
+        // with respect to parameter k.  An operator built from it is the derivative of
+        // the operator with respect to the parameter wherever no interpolation is needed,
+        // such as on 1D meshes
+        stencil parameter_derivative(int k) const;
+
         interp_line interp(int dir,
                            int3 closest,
                            real y,
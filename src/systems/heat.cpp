@@ -8,6 +8,7 @@
 #include <sol/sol.hpp>
 
 #include "operators/discrete_operator.hpp"
+#include "operators/sparse_eigenvalue_visitor.hpp"
 
 #include <range/v3/algorithm/max_element.hpp>
 
@@ -17,6 +18,45 @@ namespace ccs::systems
 constexpr auto abs = lift([](auto&& x) { return std::abs(x); });
 enum class scalars : int { u };
 
+namespace
+{
+// locations of the points in a selection of mesh::xyz
+template <typename S>
+std::vector<real3> locations(S&& s)
+{
+    std::vector<real3> v;
+    auto add = [&v](auto&& rng) {
+        for (auto&& [x, y, z] : rng) v.push_back({x, y, z});
+    };
+    if constexpr (TupleLike<S>)
+        for_each(add, s);
+    else
+        add(s);
+    return v;
+}
+
+// op(s[i], v[i]) for the same selection of a scalar, with v in the order of locations
+template <typename S, typename Op>
+void set_points(S&& s, std::span<const real> v, Op op)
+{
+    auto set = [&v, &op](auto&& rng) {
+        const auto n = static_cast<std::size_t>(rs::distance(rng));
+        assign_elements(rng, v.first(n), op);
+        v = v.subspan(n);
+    };
+    if constexpr (TupleLike<S>)
+        for_each(set, s);
+    else
+        set(s);
+}
+
+template <typename T>
+std::span<T> head(std::vector<T>& v, std::size_t n)
+{
+    return std::span{v}.first(n);
+}
+} // namespace
+
 heat::heat(mesh&& m,
            bcs::Grid&& grid_bcs,
            bcs::Object&& object_bcs,
@@ -31,10 +71,25 @@ heat::heat(mesh&& m,
       lap{this->m, st, this->grid_bcs, this->object_bcs, build_logger},
       diffusivity{diffusivity},
       neumann_u{this->m.ss()},
+      zero_neumann{this->m.ss()},
       error{this->m.ss()},
+      fluid_xyz{locations(this->m.xyz | this->m.fluid_all(this->object_bcs))},
+      dirichlet_xyz{
+          locations(this->m.xyz | this->m.dirichlet(this->grid_bcs, this->object_bcs))},
+      neumann_xyz{locations(this->m.xyz | this->m.neumann<0>(this->grid_bcs)),
+                  locations(this->m.xyz | this->m.neumann<1>(this->grid_bcs)),
+                  locations(this->m.xyz | this->m.neumann<2>(this->grid_bcs))},
+      ms_lap(fluid_xyz.size()),
       logger{build_logger, "system", "system.csv"}
 {
     assert(!!(this->m_sol));
+    this->m.add_object_bcs(this->object_bcs);
+
+    // ms_eval holds the values at any of the sets of locations
+    auto n = std::max(fluid_xyz.size(), dirichlet_xyz.size());
+    for (auto&& l : neumann_xyz) n = std::max(n, l.size());
+    ms_eval.resize(n);
+    ms_grad.resize(n);
 
     logger.set_pattern("%v");
     logger(spdlog::level::info,
@@ -52,11 +107,16 @@ void heat::operator()(field& f, const step_controller& c)
     if (!m_sol) return;
 
     auto&& u = f.scalars(scalars::u);
-    auto sol = m.xyz | m_sol(c.simulation_time());
+    auto set = [this, time = c.simulation_time()](auto&& s, auto&& xyz) {
+        const auto l = locations(xyz);
+        std::vector<real> v(l.size());
+        m_sol(time, l, v);
+        set_points(FWD(s), v, eq);
+    };
 
     u | sel::D = 0;
-    u | m.fluid = sol;
-    u | sel::R = sol;
+    set(u | m.fluid, m.xyz | m.fluid);
+    set(u | sel::R, m.xyz | sel::R);
 }
 
 //
@@ -66,7 +126,12 @@ system_stats heat::stats(const field&, const field& f, const step_controller& st
 {
     auto&& u = f.scalars(scalars::u);
 
-    auto sol = m.xyz | m_sol(step.simulation_time());
+    // local so that stats does not share the buffers of rhs
+    std::vector<real> v(fluid_xyz.size());
+    m_sol(step.simulation_time(), fluid_xyz, v);
+    scalar_real sol{m.ss()};
+    set_points(sol | m.fluid_all(object_bcs), v, eq);
+
     auto [u_min, u_max] = minmax(u | m.fluid_all(object_bcs));
 
     real err = max(abs(u - sol) | m.fluid_all(object_bcs));
@@ -117,12 +182,38 @@ real heat::timestep_size(const field&, const step_controller& step) const
     return step.parabolic_cfl() * h_min * h_min / (4 * diffusivity);
 };
 
+//
+// largest magnitude eigenvalues of diffusivity * lap with homogeneous boundary data
+//
+std::vector<std::complex<real>> heat::dominant_eigenvalues() const
+{
+    return ccs::dominant_eigenvalues(
+        m, grid_bcs, object_bcs, [&](scalar_view x, scalar_span y) {
+            y = lap(x, zero_neumann);
+            y *= diffusivity;
+        });
+}
+
+void heat::linear_rhs(const field_view& x, field_span& y) const
+{
+    auto&& y_u = y.scalars(scalars::u);
+    y_u = lap(x.scalars(scalars::u), zero_neumann);
+    y_u *= diffusivity;
+    y_u | m.dirichlet(grid_bcs, object_bcs) = 0;
+}
+
+void heat::clear_boundary(field_span f) const
+{
+    auto&& u = f.scalars(scalars::u);
+    u | m.dirichlet(grid_bcs, object_bcs) = 0;
+}
+
 //
 // rhs = diffusivity * lap(f) + (dQ/dt - diffusivity * lap(Q))
 //
 // Q is the manufactured solution
 //
-void heat::rhs(field_view f, real time, field_span rhs) const
+void heat::rhs(field_view f, real time, field_span rhs)
 {
     auto&& u_rhs = rhs.scalars(scalars::u);
     auto&& u = f.scalars(scalars::u);
@@ -132,10 +223,13 @@ void heat::rhs(field_view f, real time, field_span rhs) const
     u_rhs *= diffusivity;
 
     if (m_sol) {
-        const auto src =
-            (m.xyz | m_sol.ddt(time)) - (diffusivity * (m.xyz | m_sol.laplacian(time)));
+        // evaluated in batches, and only where the source is added
+        auto src = head(ms_eval, fluid_xyz.size());
+        m_sol.ddt(time, fluid_xyz, src);
+        m_sol.laplacian(time, fluid_xyz, ms_lap);
+        for (std::size_t i = 0; i < src.size(); i++) src[i] -= diffusivity * ms_lap[i];
 
-        u_rhs | m.fluid_all(object_bcs) += src;
+        set_points(u_rhs | m.fluid_all(object_bcs), src, plus_eq);
         u_rhs | m.dirichlet(grid_bcs, object_bcs) = 0;
     }
 }
@@ -148,14 +242,23 @@ void heat::rhs(field_view f, real time, field_span rhs) const
 void heat::update_boundary(field_span f, real time)
 {
     auto&& u = f.scalars(scalars::u);
-    auto l = m.xyz;
 
-    u | m.dirichlet(grid_bcs, object_bcs) = l | m_sol(time);
-
-    // set possible neumann bcs;
-    neumann_u | m.neumann<0>(grid_bcs) = l | m_sol.gradient(0, time);
-    neumann_u | m.neumann<1>(grid_bcs) = l | m_sol.gradient(1, time);
-    neumann_u | m.neumann<2>(grid_bcs) = l | m_sol.gradient(2, time);
+    auto sol = head(ms_eval, dirichlet_xyz.size());
+    m_sol(time, dirichlet_xyz, sol);
+    set_points(u | m.dirichlet(grid_bcs, object_bcs), sol, eq);
+
+    // set possible neumann bcs from component k of the gradient
+    auto neumann = [this, time](auto&& s, int k) {
+        const auto& l = neumann_xyz[k];
+        auto grad = head(ms_grad, l.size());
+        auto du = head(ms_eval, l.size());
+        m_sol.gradient(time, l, grad);
+        for (std::size_t i = 0; i < l.size(); i++) du[i] = grad[i][k];
+        set_points(FWD(s), du, eq);
+    };
+    neumann(neumann_u | m.neumann<0>(grid_bcs), 0);
+    neumann(neumann_u | m.neumann<1>(grid_bcs), 1);
+    neumann(neumann_u | m.neumann<2>(grid_bcs), 2);
 }
 
 void heat::log(const system_stats& stats, const step_controller& step)
@@ -170,10 +273,12 @@ void heat::log(const system_stats& stats, const step_controller& step)
 bool heat::write(field_io& io, field_view f, const step_controller& c, real dt)
 {
     auto&& u = f.scalars(scalars::u);
-    auto sol = m.xyz | m_sol(c.simulation_time());
+    auto sol = head(ms_eval, fluid_xyz.size());
+    m_sol(c.simulation_time(), fluid_xyz, sol);
 
     error = 0;
-    error | m.fluid_all(object_bcs) = abs(u - sol);
+    set_points(error | m.fluid_all(object_bcs), sol, eq);
+    error | m.fluid_all(object_bcs) = abs(u - error);
     error | m.dirichlet(grid_bcs, object_bcs) = 0;
 
     field_view io_view{std::vector<scalar_view>{u, error}, std::vector<vector_view>{}};
@@ -193,19 +298,24 @@ std::optional<heat> heat::from_lua(const sol::table& tbl, const logs& logger)
 {
     // assume we can only get here if simulation.system.type == "heat" so check
     // for the rest
-    real diff = tbl["system"]["diffusivity"].get_or(1.0);
-
     auto mesh_opt = mesh::from_lua(tbl, logger);
     if (!mesh_opt) return std::nullopt;
 
-    auto bc_opt = bcs::from_lua(tbl, mesh_opt->extents(), logger);
+    return from_lua(tbl, MOVE(*mesh_opt), logger);
+}
+
+std::optional<heat> heat::from_lua(const sol::table& tbl, mesh&& m, const logs& logger)
+{
+    real diff = tbl["system"]["diffusivity"].get_or(1.0);
+
+    auto bc_opt = bcs::from_lua(tbl, m.extents(), logger);
     auto st_opt = stencil::from_lua(tbl, logger);
 
     if (bc_opt && st_opt) {
-        auto ms_opt = manufactured_solution::from_lua(tbl, mesh_opt->dims(), logger);
+        auto ms_opt = manufactured_solution::from_lua(tbl, m.dims(), logger);
         auto t = ms_opt ? MOVE(*ms_opt) : manufactured_solution{};
 
-        return heat{MOVE(*mesh_opt),
+        return heat{MOVE(m),
                     MOVE(bc_opt->first),
                     MOVE(bc_opt->second),
                     MOVE(t),
@@ -25,8 +25,19 @@ class heat
     real diffusivity;
 
     scalar_real neumann_u;
+    // homogeneous neumann data for the linear part of the rhs
+    scalar_real zero_neumann;
     scalar_real error;
 
+    // locations where the manufactured solution is evaluated in batches, packed one
+    // selected component after another, and space for the results
+    std::vector<real3> fluid_xyz;
+    std::vector<real3> dirichlet_xyz;
+    std::array<std::vector<real3>, 3> neumann_xyz;
+    std::vector<real> ms_eval;
+    std::vector<real> ms_lap;
+    std::vector<real3> ms_grad;
+
     logs logger;
 
     std::vector<std::string> io_names = {"U", "Error"};
@@ -44,6 +55,10 @@ public:
 
     static std::optional<heat> from_lua(const sol::table&, const logs& = {});
 
+    // build on an existing mesh rather than the one described by the table
+    static std::optional<heat>
+    from_lua(const sol::table&, mesh&&, const logs& = {});
+
     void operator()(field&, const step_controller&);
 
     system_stats stats(const field& u0, const field& u1, const step_controller&) const;
@@ -52,7 +67,17 @@ public:
 
     real timestep_size(const field&, const step_controller&) const;
 
-    void rhs(field_view, real, field_span) const;
+    std::vector<std::complex<real>> dominant_eigenvalues() const;
+
+    // the rhs without the boundary data and source terms
+    void linear_rhs(const field_view& x, field_span& y) const;
+
+    void clear_boundary(field_span) const;
+
+    // the points where the equation holds
+    auto fluid_all() const { return m.fluid_all(object_bcs); }
+
+    void rhs(field_view, real, field_span);
 
     void update_boundary(field_span, real time);
 
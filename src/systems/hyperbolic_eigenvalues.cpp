@@ -6,21 +6,36 @@
 
 #include "operators/discrete_operator.hpp"
 #include "operators/eigenvalue_visitor.hpp"
+#include "operators/sparse_eigenvalue_visitor.hpp"
 
 #include <range/v3/algorithm/max.hpp>
 
 namespace ccs::systems
 {
 
+namespace
+{
+// the boundary points on Rx with dirichlet conditions are not unknowns
+eigenvalue_visitor dense_visitor(const mesh& m, const bcs::Object& object_bcs)
+{
+    auto p = m.Rx() | vs::transform([&object_bcs](auto&& info) {
+                 return object_bcs[info.shape_id] == bcs::Dirichlet;
+             });
+    return eigenvalue_visitor{m.extents(), p, std::vector<bool>{}, std::vector<bool>{}};
+}
+} // namespace
+
 hyperbolic_eigenvalues::hyperbolic_eigenvalues(mesh&& m,
                                                bcs::Grid&& grid_bcs,
                                                bcs::Object&& object_bcs,
                                                stencil st,
+                                               std::optional<matrix::krylov_schur> krylov,
                                                const logs& build_logger)
     : m{MOVE(m)},
       grid_bcs{MOVE(grid_bcs)},
       object_bcs{MOVE(object_bcs)},
       grad{gradient(this->m, st, this->grid_bcs, this->object_bcs, build_logger)},
+      krylov{MOVE(krylov)},
       logger{build_logger, "system", "system.csv"}
 {
 
@@ -35,16 +50,48 @@ hyperbolic_eigenvalues::hyperbolic_eigenvalues(mesh&& m,
 system_stats
 hyperbolic_eigenvalues::stats(const field&, const field&, const step_controller&) const
 {
+    // The semi-discrete system is du/dt = -D u.  Report h times the largest real part of
+    // the eigenvalues of -D
+    if (krylov) {
+        auto v = sparse_eigenvalue_visitor{m, grid_bcs, object_bcs, -1.0, *krylov};
+        grad.visit(v);
 
-    auto p = m.Rx() | vs::transform([this](auto&& info) {
-                 return object_bcs[info.shape_id] == bcs::Dirichlet;
-             });
-    auto v = eigenvalue_visitor{m.extents(), p, std::vector<bool>{}, std::vector<bool>{}};
+        if (!v.converged())
+            logger(spdlog::level::warn, "eigenvalues did not converge");
+
+        const auto eigs = v.eigenvalues_real();
+        return system_stats{.stats = {eigs.empty() ? 0.0 : m.h(0) * eigs[0]}};
+    }
+
+    auto v = dense_visitor(m, object_bcs);
     grad.visit(v);
 
     return system_stats{.stats = {-m.h(0) * rs::min(v.eigenvalues_real())}};
 }
 
+std::vector<real>
+hyperbolic_eigenvalues::screen(std::span<const stencil> candidates) const
+{
+    if (!krylov) {
+        auto res = dense_visitor(m, object_bcs)
+                       .spectral_abscissae(m, candidates, grid_bcs, object_bcs, -1.0);
+        for (auto&& r : res) r *= m.h(0);
+        return res;
+    }
+
+    // the Krylov-Schur iteration is already threaded so the candidates are done in turn
+    std::vector<real> res;
+    res.reserve(candidates.size());
+    for (auto&& st : candidates) {
+        auto v = sparse_eigenvalue_visitor{m, grid_bcs, object_bcs, -1.0, *krylov};
+        v.visit(derivative{0, m, st, grid_bcs, object_bcs});
+
+        const auto eigs = v.eigenvalues_real();
+        res.push_back(eigs.empty() ? 0.0 : m.h(0) * eigs[0]);
+    }
+    return res;
+}
+
 real3 hyperbolic_eigenvalues::summary(const system_stats& stats) const
 {
     return {stats.stats[0], 0.0, 0.0};
@@ -63,14 +110,42 @@ hyperbolic_eigenvalues::from_lua(const sol::table& tbl, const logs& logger)
     auto mesh_opt = mesh::from_lua(tbl, logger);
     if (!mesh_opt) return std::nullopt;
 
-    auto bc_opt = bcs::from_lua(tbl, mesh_opt->extents(), logger);
+    return from_lua(tbl, MOVE(*mesh_opt), logger);
+}
+
+std::optional<hyperbolic_eigenvalues>
+hyperbolic_eigenvalues::from_lua(const sol::table& tbl, mesh&& m, const logs& logger)
+{
+    auto bc_opt = bcs::from_lua(tbl, m.extents(), logger);
     auto st_opt = stencil::from_lua(tbl, logger);
 
-    if (bc_opt && st_opt)
-        return hyperbolic_eigenvalues{
-            MOVE(*mesh_opt), MOVE(bc_opt->first), MOVE(bc_opt->second), *st_opt, logger};
-    else
+    if (!(bc_opt && st_opt)) return std::nullopt;
+
+    // The dense solver forms the whole matrix and is limited to 1D.  Otherwise the
+    // rightmost eigenvalues are found with a matrix-free Krylov-Schur iteration
+    const auto ex = m.extents();
+    const bool one_d = ex[1] == 1 && ex[2] == 1;
+    std::optional<matrix::krylov_schur> krylov{};
+
+    auto sys = tbl["system"];
+    std::string solver = sys["solver"].get_or(std::string{one_d ? "dense" : "arnoldi"});
+    if (solver == "arnoldi") {
+        krylov = matrix::krylov_schur{sys["eigenvalues"].get_or(1),
+                                      sys["krylov_dimension"].get_or(0),
+                                      sys["tolerance"].get_or(1e-10),
+                                      sys["max_restarts"].get_or(1000)};
+    } else if (solver != "dense" || !one_d) {
+        logger(spdlog::level::err,
+               "system.solver must be 'arnoldi' or, for 1D meshes, 'dense'");
         return std::nullopt;
+    }
+
+    return hyperbolic_eigenvalues{MOVE(m),
+                                  MOVE(bc_opt->first),
+                                  MOVE(bc_opt->second),
+                                  *st_opt,
+                                  MOVE(krylov),
+                                  logger};
 }
 
 //
@@ -3,6 +3,7 @@
 #include "fields/field.hpp"
 #include "io/field_io.hpp"
 #include "io/logging.hpp"
+#include "matrices/krylov_schur.hpp"
 #include "operators/gradient.hpp"
 #include "temporal/step_controller.hpp"
 #include "types.hpp"
@@ -20,18 +21,31 @@ class hyperbolic_eigenvalues
 
     gradient grad; // field operator
 
+    // the spectrum is found with a dense eigensolver unless set.  Only 1D meshes may use
+    // the dense solver
+    std::optional<matrix::krylov_schur> krylov;
+
     logs logger;
 
 public:
     hyperbolic_eigenvalues() = default;
 
-    hyperbolic_eigenvalues(
-        mesh&&, bcs::Grid&&, bcs::Object&&, stencil, const logs& = {});
+    hyperbolic_eigenvalues(mesh&&,
+                           bcs::Grid&&,
+                           bcs::Object&&,
+                           stencil,
+                           std::optional<matrix::krylov_schur> = std::nullopt,
+                           const logs& = {});
 
     void operator()(field& s, const step_controller&);
 
     system_stats stats(const field& u0, const field& u1, const step_controller&) const;
 
+    // The statistic reported by `stats` for each candidate stencil on this mesh.  Meant
+    // for screening many stencil parameters at once: on 1D meshes the candidates are
+    // evaluated concurrently with the dense solver
+    std::vector<real> screen(std::span<const stencil> candidates) const;
+
     bool valid(const system_stats&) const;
 
     real timestep_size(const field&, const step_controller&) const;
@@ -49,5 +63,9 @@ public:
     system_size size() const;
 
     static std::optional<hyperbolic_eigenvalues> from_lua(const sol::table&, const logs&);
+
+    // build on an existing mesh rather than the one described by the table
+    static std::optional<hyperbolic_eigenvalues>
+    from_lua(const sol::table&, mesh&&, const logs& = {});
 };
 } // namespace ccs::systems
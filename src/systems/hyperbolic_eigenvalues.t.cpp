@@ -2,6 +2,7 @@
 #include <catch2/catch_test_macros.hpp>
 
 #include "io/logging.hpp"
+#include <fmt/core.h>
 #include <sol/sol.hpp>
 
 #include "system.hpp"
@@ -56,3 +57,63 @@ TEST_CASE("hyperbolic_eigenvalues")
     auto st = sys.stats(f, f, step);
     REQUIRE(st.stats[0] + 1.0 == Catch::Approx(1.0));
 }
+
+TEST_CASE("hyperbolic_eigenvalues arnoldi")
+{
+    // each x-line of the 2D mesh matches the 1D mesh so the rightmost eigenvalue agrees
+    // with the dense 1D result
+    auto run = [](std::string extents, std::string bounds, std::string solver) {
+        sol::state lua;
+        lua.open_libraries(sol::lib::base, sol::lib::math);
+        lua.script(fmt::format(R"(
+            simulation = {{
+                mesh = {{
+                    index_extents = {},
+                    domain_bounds = {}
+                }},
+                shapes = {{
+                    {{
+                        type = "yz_rect",
+                        psi = 0.001,
+                        normal = 1,
+                        boundary_condition = "dirichlet"
+                    }},
+                    {{
+                        type = "yz_rect",
+                        psi = 0.9,
+                        normal = -1,
+                        boundary_condition = "floating"
+                    }}
+                }},
+                scheme = {{
+                    order = 1,
+                    type = "E2-poly",
+                    floating_alpha = {{13/100, 7/50, 3/20, 4/25, 17/100, 9/50}},
+                    dirichlet_alpha = {{3/25, 13/100, 7/50}}
+                }},
+                system = {{
+                    type = "eigenvalues",
+                    solver = "{}",
+                    eigenvalues = 2
+                }}
+            }}
+        )",
+                               extents,
+                               bounds,
+                               solver));
+
+        auto sys_opt = system::from_lua(lua["simulation"], logs{});
+        REQUIRE(!!sys_opt);
+        auto& sys = *sys_opt;
+        step_controller step{};
+        field f{sys(step)};
+        return sys.stats(f, f, step).stats[0];
+    };
+
+    const auto dense = run("{21}", "{1}", "dense");
+    const auto arnoldi_1d = run("{21}", "{1}", "arnoldi");
+    const auto arnoldi_2d = run("{21, 7}", "{1, 1}", "arnoldi");
+
+    REQUIRE(arnoldi_1d + 1.0 == Catch::Approx(dense + 1.0));
+    REQUIRE(arnoldi_2d + 1.0 == Catch::Approx(dense + 1.0));
+}
@@ -8,6 +8,7 @@
 #include <sol/sol.hpp>
 
 #include "operators/discrete_operator.hpp"
+#include "operators/sparse_eigenvalue_visitor.hpp"
 
 #include <range/v3/algorithm/max_element.hpp>
 #include <range/v3/view/transform.hpp>
@@ -55,11 +56,12 @@ scalar_wave::scalar_wave(mesh&& m_,
       center{center},
       radius{radius},
       grad_G{m.vs()},
-      du{m.vs()},
+      du{m.ss()},
       error{m.ss()},
       max_error{max_error},
       logger{build_logger, "system", "system.csv"}
 {
+    m.add_object_bcs(this->object_bcs);
 
     // Initialize wave speeds
     grad_G | m.fluid = m.vxyz | tuple{neg_G<0>(center, radius),
@@ -85,6 +87,30 @@ real scalar_wave::timestep_size(const field&, const step_controller& step) const
     return step.hyperbolic_cfl() * h_min;
 }
 
+//
+// largest magnitude eigenvalues of the linear operator - grad(G) . grad(u)
+//
+std::vector<std::complex<real>> scalar_wave::dominant_eigenvalues() const
+{
+    return ccs::dominant_eigenvalues(
+        m, grid_bcs, object_bcs, [this](scalar_view x, scalar_span y) {
+            y = grad.dot(grad_G, x);
+        });
+}
+
+void scalar_wave::linear_rhs(const field_view& x, field_span& y) const
+{
+    auto&& y_u = y.scalars(scalars::u);
+    y_u = grad.dot(grad_G, x.scalars(scalars::u));
+    y_u | m.dirichlet(grid_bcs, object_bcs) = 0;
+}
+
+void scalar_wave::clear_boundary(field_span f) const
+{
+    auto&& u = f.scalars(scalars::u);
+    u | m.dirichlet(grid_bcs, object_bcs) = 0;
+}
+
 //
 // sets the field f to the solution
 //
@@ -151,15 +177,14 @@ bool scalar_wave::valid(const system_stats& stats) const
 }
 
 //
-// rhs = - grad(G) . grad(u) -> dot(neg_G, du)
+// rhs = - grad(G) . grad(u) -> dot(neg_G, grad(u)) without forming grad(u)
 //
 void scalar_wave::rhs(field_view f, real, field_span rhs)
 {
     auto&& u = f.scalars(scalars::u);
     auto&& u_rhs = rhs.scalars(scalars::u);
 
-    du = grad(u);
-    u_rhs = dot(grad_G, du);
+    u_rhs = grad.dot(grad_G, u, du);
 }
 
 real3 scalar_wave::summary(const system_stats& stats) const
@@ -205,6 +230,15 @@ system_size scalar_wave::size() const { return {1, 0, m.ss()}; }
 
 std::optional<scalar_wave> scalar_wave::from_lua(const sol::table& tbl,
                                                  const logs& logger)
+{
+    auto mesh_opt = mesh::from_lua(tbl, logger);
+    if (!mesh_opt) return std::nullopt;
+
+    return from_lua(tbl, MOVE(*mesh_opt), logger);
+}
+
+std::optional<scalar_wave>
+scalar_wave::from_lua(const sol::table& tbl, mesh&& m, const logs& logger)
 {
     real max_error = tbl["system"]["max_error"].get_or(100.0);
     // assume we can only get here if simulation.system.type == "scalar_wave" so check
@@ -243,15 +277,12 @@ std::optional<scalar_wave> scalar_wave::from_lua(const sol::table& tbl,
         return std::nullopt;
     }
 
-    auto mesh_opt = mesh::from_lua(tbl, logger);
-    if (!mesh_opt) return std::nullopt;
-
-    auto bc_opt = bcs::from_lua(tbl, mesh_opt->extents(), logger);
+    auto bc_opt = bcs::from_lua(tbl, m.extents(), logger);
     auto st_opt = stencil::from_lua(tbl, logger);
 
     if (bc_opt && st_opt) {
 
-        return scalar_wave{MOVE(*mesh_opt),
+        return scalar_wave{MOVE(m),
                            MOVE(bc_opt->first),
                            MOVE(bc_opt->second),
                            *st_opt,
@@ -28,7 +28,8 @@ class scalar_wave
     real radius;
 
     vector_real grad_G;
-    vector_real du;
+    // one direction of grad(u) at a time for rhs
+    scalar_real du;
 
     scalar_real error;
 
@@ -57,6 +58,16 @@ public:
 
     real timestep_size(const field&, const step_controller&) const;
 
+    std::vector<std::complex<real>> dominant_eigenvalues() const;
+
+    // the rhs without the boundary data and source terms
+    void linear_rhs(const field_view& x, field_span& y) const;
+
+    void clear_boundary(field_span) const;
+
+    // the points where the equation holds
+    auto fluid_all() const { return m.fluid_all(object_bcs); }
+
     void rhs(field_view, real, field_span);
 
     void update_boundary(field_span, real time);
@@ -70,6 +81,10 @@ public:
     system_size size() const;
 
     static std::optional<scalar_wave> from_lua(const sol::table&, const logs& = {});
+
+    // build on an existing mesh rather than the one described by the table
+    static std::optional<scalar_wave>
+    from_lua(const sol::table&, mesh&&, const logs& = {});
 };
 
 } // namespace ccs::systems
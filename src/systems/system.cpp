@@ -1,4 +1,5 @@
 #include "system.hpp"
+#include "fields/algorithms.hpp"
 
 #include <sol/sol.hpp>
 #include <spdlog/spdlog.h>
@@ -41,6 +42,12 @@ void system::update_boundary(field_span view, real time)
 std::optional<real> system::timestep_size(const field& field,
                                           const step_controller& controller) const
 {
+    // a step size chosen from the error of the last step comes first
+    if (auto dt = controller.adaptive_timestep(); dt)
+        return controller.check_timestep_size(*dt);
+    if (auto dt = controller.stable_timestep(); dt)
+        return controller.check_timestep_size(*dt);
+
     const auto predicted_dt = std::visit(
         [&field, &controller](auto&& current_system) {
             return current_system.timestep_size(field, controller);
@@ -50,6 +57,67 @@ std::optional<real> system::timestep_size(const field& field,
     return controller.check_timestep_size(predicted_dt);
 }
 
+std::vector<std::complex<real>> system::dominant_eigenvalues() const
+{
+    return std::visit(
+        [](auto&& sys) -> std::vector<std::complex<real>> {
+            if constexpr (requires { sys.dominant_eigenvalues(); })
+                return sys.dominant_eigenvalues();
+            else
+                return {};
+        },
+        v);
+}
+
+void system::linear_rhs(const field_view& x, field_span& y) const
+{
+    std::visit(
+        [&x, &y](auto&& sys) {
+            if constexpr (requires { sys.linear_rhs(x, y); })
+                sys.linear_rhs(x, y);
+            else
+                y = 0;
+        },
+        v);
+}
+
+void system::clear_boundary(field_span f) const
+{
+    std::visit(
+        [f](auto&& sys) {
+            if constexpr (requires { sys.clear_boundary(f); }) sys.clear_boundary(f);
+        },
+        v);
+}
+
+real system::error_norm(
+    field_view u0, field_view u1, field_span err, real atol, real rtol) const
+{
+    return std::visit(
+        [&](auto&& sys) -> real {
+            if constexpr (requires { sys.error_norm(u0, u1, err, atol, rtol); }) {
+                return sys.error_norm(u0, u1, err, atol, rtol);
+            } else {
+                // the points where the solution is imposed carry no error, and only the
+                // points with an equation count if the system says which they are
+                if constexpr (requires { sys.clear_boundary(err); })
+                    sys.clear_boundary(err);
+
+                real e = 0.0;
+                for (int i = 0; i < (int)err.scalars().size(); i++) {
+                    auto w = weighted_error(atol, rtol)(
+                        err.scalars(i), u0.scalars(i), u1.scalars(i));
+                    if constexpr (requires { sys.fluid_all(); })
+                        e = std::max(e, max(w | sys.fluid_all()));
+                    else
+                        e = std::max(e, max(w));
+                }
+                return e;
+            }
+        },
+        v);
+}
+
 bool system::valid(const system_stats& stats) const
 {
     return std::visit([&stats](auto&& sys) { return sys.valid(stats); }, v);
@@ -87,34 +155,53 @@ system_size system::size() const
     return std::visit([](auto&& current_system) { return current_system.size(); }, v);
 }
 
-std::optional<system> system::from_lua(const sol::table& tbl, const logs& logger)
+namespace
 {
-    auto m = tbl["system"];
-    if (!m.valid()) {
+// `m` is either empty, in which case the systems build their own mesh, or the mesh
+// to build on
+template <typename... M>
+std::optional<system> build(const sol::table& tbl, const logs& logger, const M&... m)
+{
+    auto sys = tbl["system"];
+    if (!sys.valid()) {
         logger(spdlog::level::err, "simulation.system must be specified");
         return std::nullopt;
     }
 
-    auto type = m["type"].get_or(std::string{});
+    auto type = sys["type"].get_or(std::string{});
 
     if (type == "heat") {
         logger(spdlog::level::info, "building heat system");
-        if (auto opt = systems::heat::from_lua(tbl, logger); opt)
+        if (auto opt = systems::heat::from_lua(tbl, mesh{m}..., logger); opt)
             return system(MOVE(*opt));
     } else if (type == "scalar wave") {
         logger(spdlog::level::info, "building scalar_wave system");
-        if (auto opt = systems::scalar_wave::from_lua(tbl, logger); opt)
+        if (auto opt = systems::scalar_wave::from_lua(tbl, mesh{m}..., logger); opt)
             return system(MOVE(*opt));
     } else if (type == "inviscid vortex") {
         logger(spdlog::level::info, "building inviscid_vortex system");
         return system(systems::inviscid_vortex{});
     } else if (type == "eigenvalues") {
         logger(spdlog::level::info, "building hyperbolic_eigenvalues system");
-        if (auto opt = systems::hyperbolic_eigenvalues::from_lua(tbl, logger); opt)
+        if (auto opt =
+                systems::hyperbolic_eigenvalues::from_lua(tbl, mesh{m}..., logger);
+            opt)
             return system(MOVE(*opt));
     } else {
         logger(spdlog::level::err, "unrecognized system.type");
     }
     return std::nullopt;
 }
+} // namespace
+
+std::optional<system> system::from_lua(const sol::table& tbl, const logs& logger)
+{
+    return build(tbl, logger);
+}
+
+std::optional<system>
+system::from_lua(const sol::table& tbl, const mesh& m, const logs& logger)
+{
+    return build(tbl, logger, m);
+}
 } // namespace ccs
@@ -10,8 +10,10 @@
 #include "io/logging.hpp"
 #include "temporal/step_controller.hpp"
 #include "types.hpp"
+#include <complex>
 #include <sol/forward.hpp>
 #include <variant>
+#include <vector>
 
 namespace ccs
 {
@@ -77,9 +79,30 @@ public:
     // returns true if the system stats say so
     bool valid(const system_stats&) const;
 
-    // return a valid timestep size based on cfl and system-specific data
+    // return a valid timestep size based on cfl and system-specific data.  An adaptive
+    // or stable timestep recorded in the controller takes the place of the cfl estimate
     std::optional<real> timestep_size(const field&, const step_controller&) const;
 
+    // estimates of the largest magnitude eigenvalues of the rhs operator.  Empty if the
+    // system does not provide them
+    std::vector<std::complex<real>> dominant_eigenvalues() const;
+
+    // y = J x where J is the linear part of the rhs, applied with homogeneous boundary
+    // data.  y is zero on the dirichlet points.  Used by the implicit integrators, which
+    // treat the rest of the rhs explicitly.  Systems without one give J = 0.  The view
+    // and span are taken by reference so the solver's repeated calls do not copy them
+    void linear_rhs(const field_view& x, field_span& y) const;
+
+    // zero the points where the solution is imposed by update_boundary
+    void clear_boundary(field_span) const;
+
+    // weighted max norm of the error estimate `err` of a step from u0 to u1 over the
+    // points with an equation.  Used to accept or reject steps of adaptive integrators.
+    // The estimate is cleared by the system's clear_boundary and only read at its
+    // fluid_all points, unless it provides its own error_norm
+    real error_norm(
+        field_view u0, field_view u1, field_span err, real atol, real rtol) const;
+
     std::function<void(field_span)> rhs(field_view, real);
 
     void update_boundary(field_span, real time);
@@ -90,6 +113,10 @@ public:
 
     static std::optional<system> from_lua(const sol::table&, const logs& = {});
 
+    // build the system on a copy of `m` instead of the mesh described by the table
+    static std::optional<system>
+    from_lua(const sol::table&, const mesh& m, const logs& = {});
+
     system_size size() const;
 };
 
@@ -0,0 +1,124 @@
+#include "embedded.hpp"
+#include "step_controller.hpp"
+#include "systems/system.hpp"
+
+namespace ccs::integrators
+{
+
+namespace
+{
+constexpr int max_stages = embedded_scheme::max_stages;
+using coefficients = std::array<real, max_stages>;
+
+// c follows from the rows of a and the stability polynomial from
+// R(z) = 1 + sum_j z^j b^T a^(j - 1) 1
+constexpr embedded_scheme make_scheme(int stages,
+                                      int order,
+                                      std::array<coefficients, max_stages> a,
+                                      coefficients b,
+                                      coefficients b_hat)
+{
+    coefficients e{}, c{}, v{};
+    std::array<real, max_stages + 1> stability{1.0};
+
+    for (int i = 0; i < stages; i++) {
+        e[i] = b[i] - b_hat[i];
+        for (int j = 0; j < i; j++) c[i] += a[i][j];
+        v[i] = 1.0;
+    }
+
+    for (int p = 1; p <= stages; p++) {
+        for (int i = 0; i < stages; i++) stability[p] += b[i] * v[i];
+
+        coefficients w{};
+        for (int i = 0; i < stages; i++)
+            for (int j = 0; j < i; j++) w[i] += a[i][j] * v[j];
+        v = w;
+    }
+
+    return {stages, order, a, b, e, c, stability};
+}
+} // namespace
+
+const embedded_scheme embedded::bs32 =
+    make_scheme(4,
+                2,
+                {{{},
+                  {1.0 / 2.0},
+                  {0.0, 3.0 / 4.0},
+                  {2.0 / 9.0, 1.0 / 3.0, 4.0 / 9.0}}},
+                {2.0 / 9.0, 1.0 / 3.0, 4.0 / 9.0, 0.0},
+                {7.0 / 24.0, 1.0 / 4.0, 1.0 / 3.0, 1.0 / 8.0});
+
+const embedded_scheme embedded::dp54 = make_scheme(
+    7,
+    4,
+    {{{},
+      {1.0 / 5.0},
+      {3.0 / 40.0, 9.0 / 40.0},
+      {44.0 / 45.0, -56.0 / 15.0, 32.0 / 9.0},
+      {19372.0 / 6561.0, -25360.0 / 2187.0, 64448.0 / 6561.0, -212.0 / 729.0},
+      {9017.0 / 3168.0, -355.0 / 33.0, 46732.0 / 5247.0, 49.0 / 176.0, -5103.0 / 18656.0},
+      {35.0 / 384.0, 0.0, 500.0 / 1113.0, 125.0 / 192.0, -2187.0 / 6784.0, 11.0 / 84.0}}},
+    {35.0 / 384.0,
+     0.0,
+     500.0 / 1113.0,
+     125.0 / 192.0,
+     -2187.0 / 6784.0,
+     11.0 / 84.0,
+     0.0},
+    {5179.0 / 57600.0,
+     0.0,
+     7571.0 / 16695.0,
+     393.0 / 640.0,
+     -92097.0 / 339200.0,
+     187.0 / 2100.0,
+     1.0 / 40.0});
+
+std::span<const real> embedded::stability_polynomial() const
+{
+    return std::span<const real>(scheme->stability).first(scheme->stages + 1);
+}
+
+void embedded::ensure_size(system_size sz)
+{
+    if ((int)k.size() != scheme->stages || ssize(err) != sz) {
+        k.assign(scheme->stages, field{sz});
+        err = field{sz};
+    }
+}
+
+void embedded::operator()(system& system,
+                          const field& u0,
+                          field_span u,
+                          const step_controller& controller,
+                          real dt)
+{
+    const int stages = scheme->stages;
+    const auto& a = scheme->a;
+    const auto& b = scheme->b;
+    const auto& e = scheme->e;
+    const auto& c = scheme->c;
+    const real time = controller;
+
+    k[0] = system.rhs(u0, time);
+    for (int i = 1; i < stages; i++) {
+        u = u0;
+        for (int j = 0; j < i; j++)
+            if (a[i][j] != 0.0) u += dt * a[i][j] * k[j];
+        system.update_boundary(u, time + dt * c[i]);
+        k[i] = system.rhs(u, time + dt * c[i]);
+    }
+
+    u = u0;
+    err = 0;
+    for (int j = 0; j < stages; j++) {
+        if (b[j] != 0.0) u += dt * b[j] * k[j];
+        if (e[j] != 0.0) err += dt * e[j] * k[j];
+    }
+    system.update_boundary(u, time + dt);
+
+    err_norm = system.error_norm(
+        u0, u, err, controller.absolute_tolerance(), controller.relative_tolerance());
+}
+} // namespace ccs::integrators
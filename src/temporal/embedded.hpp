@@ -0,0 +1,65 @@
+#pragma once
+
+#include "fields/field.hpp"
+
+#include <array>
+#include <optional>
+#include <vector>
+
+namespace ccs
+{
+// Forward decls
+class system;
+class step_controller;
+
+namespace integrators
+{
+
+// Butcher tableau of an explicit Runge-Kutta scheme with an embedded solution of lower
+// order.  `e` holds the difference of the weights of the two solutions
+struct embedded_scheme {
+    static constexpr int max_stages = 7;
+
+    int stages;
+    // order of the error estimate
+    int order;
+    std::array<std::array<real, max_stages>, max_stages> a;
+    std::array<real, max_stages> b;
+    std::array<real, max_stages> e;
+    std::array<real, max_stages> c;
+    // coefficients of the stability polynomial R(z) in increasing powers of z
+    std::array<real, max_stages + 1> stability;
+};
+
+// Explicit Runge-Kutta schemes which estimate the error of each step from an embedded
+// solution.  The weighted norm of the estimate, measured by the system, is left for the
+// step controller to accept or reject the step.  The stages are kept so the step needs
+// a register per stage plus one for the error
+class embedded
+{
+    const embedded_scheme* scheme = nullptr;
+    std::vector<field> k;
+    field err;
+    std::optional<real> err_norm;
+
+public:
+    embedded() = default;
+    embedded(const embedded_scheme& scheme) : scheme{&scheme} {}
+
+    void ensure_size(system_size);
+
+    void operator()(system&, const field&, field_span, const step_controller&, real);
+
+    std::span<const real> stability_polynomial() const;
+
+    // weighted norm of the error of the last step.  Values above one fail the tolerance
+    std::optional<real> error_estimate() const { return err_norm; }
+    int error_order() const { return scheme->order; }
+
+    // Bogacki and Shampine's 3(2) pair
+    static const embedded_scheme bs32;
+    // Dormand and Prince's 5(4) pair
+    static const embedded_scheme dp54;
+};
+} // namespace integrators
+} // namespace ccs
@@ -0,0 +1,129 @@
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <sol/sol.hpp>
+#include <spdlog/spdlog.h>
+
+#include "integrator.hpp"
+#include "systems/system.hpp"
+#include "test_problems.hpp"
+
+#include <range/v3/all.hpp>
+
+using namespace ccs;
+
+TEST_CASE("integrator - embedded")
+{
+    sol::state lua;
+    testing::cubic_heat(lua, R"(type = "dormand prince")");
+
+    auto sys_opt = system::from_lua(lua["simulation"]);
+    REQUIRE(!!sys_opt);
+    auto& sys = *sys_opt;
+
+    for (auto type : {"bogacki shampine", "dormand prince"}) {
+        lua["simulation"]["integrator"]["type"] = type;
+        auto it_opt = integrator::from_lua(lua["simulation"]);
+        REQUIRE(!!it_opt);
+        auto& it = *it_opt;
+        REQUIRE(!it.in_place());
+        REQUIRE(!it.error_estimate());
+
+        auto st_opt = step_controller::from_lua(lua["simulation"]);
+        REQUIRE(!!st_opt);
+        auto& step = *st_opt;
+
+        field f{sys(step)};
+        sys.update_boundary(f, step);
+
+        field g{sys.size()};
+
+        const real dt = *sys.timestep_size(f, step);
+
+        g = it(sys, f, step, dt);
+
+        // the solution is linear in time so both solutions are exact
+        REQUIRE(it.error_estimate());
+        REQUIRE(*it.error_estimate() < 1e-6);
+        REQUIRE(step.accept(*it.error_estimate(), dt, it.error_order()));
+        REQUIRE(*step.adaptive_timestep() > dt);
+
+        step.advance(dt);
+
+        // at this point, all fluid points in g should have a value of m_sol(time, loc)
+        auto stats = sys.stats(f, g, step);
+        REQUIRE_THAT(stats.stats[0], Catch::Matchers::WithinAbs(0.0, 1e-13));
+    }
+}
+
+TEST_CASE("rejected steps")
+{
+    sol::state lua;
+    testing::forced_heat(lua, R"(type = "bogacki shampine")");
+
+    auto sys_opt = system::from_lua(lua["simulation"]);
+    REQUIRE(!!sys_opt);
+    auto& sys = *sys_opt;
+
+    auto it_opt = integrator::from_lua(lua["simulation"]);
+    REQUIRE(!!it_opt);
+    auto& it = *it_opt;
+
+    auto st_opt = step_controller::from_lua(lua["simulation"]);
+    REQUIRE(!!st_opt);
+    auto& step = *st_opt;
+
+    field f{sys(step)};
+    sys.update_boundary(f, step);
+
+    field g{sys.size()};
+
+    // far too large for the default tolerances
+    real dt = 1.0;
+    g = it(sys, f, step, dt);
+    REQUIRE(*it.error_estimate() > 1.0);
+    REQUIRE(!step.accept(*it.error_estimate(), dt, it.error_order()));
+    REQUIRE(*step.adaptive_timestep() < dt);
+
+    // retry from the same solution with the proposed steps, as the simulation cycle does
+    int rejected = 1;
+    for (;;) {
+        dt = *step.adaptive_timestep();
+        sys.update_boundary(f, step);
+        g = it(sys, f, step, dt);
+        if (step.accept(*it.error_estimate(), dt, it.error_order())) break;
+        REQUIRE(++rejected < 10);
+    }
+
+    // the step is not allowed to grow right after a rejection
+    REQUIRE(*step.adaptive_timestep() <= dt);
+
+    step.advance(dt);
+    auto stats = sys.stats(f, g, step);
+    REQUIRE(stats.stats[0] < 1e-4);
+
+    // the step proposed after an accepted one is accepted too
+    std::swap(f, g);
+    dt = *step.adaptive_timestep();
+    g = it(sys, f, step, dt);
+    REQUIRE(step.accept(*it.error_estimate(), dt, it.error_order()));
+}
+
+TEST_CASE("stability polynomial")
+{
+    using integrators::embedded;
+
+    // R(z) matches exp(z) up to the order of the scheme
+    const std::array taylor{
+        1.0, 1.0, 1.0 / 2.0, 1.0 / 6.0, 1.0 / 24.0, 1.0 / 120.0, 1.0 / 600.0, 0.0};
+
+    auto bs32 = embedded{embedded::bs32}.stability_polynomial();
+    REQUIRE(bs32.size() == 5u);
+    for (int i = 0; i < 4; i++) REQUIRE(bs32[i] == Catch::Approx(taylor[i]));
+
+    auto dp54 = embedded{embedded::dp54}.stability_polynomial();
+    REQUIRE(dp54.size() == 8u);
+    for (int i = 0; i < 7; i++) REQUIRE(dp54[i] == Catch::Approx(taylor[i]));
+    REQUIRE(dp54[7] + 1.0 == Catch::Approx(1.0));
+}
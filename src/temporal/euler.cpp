@@ -1,23 +1,26 @@
 #include "euler.hpp"
+#include "stage_update.hpp"
 #include "step_controller.hpp"
 #include "systems/system.hpp"
 
 namespace ccs::integrators
 {
 
+constexpr std::array stability{1.0, 1.0};
+
+std::span<const real> euler::stability_polynomial() { return stability; }
+
 void euler::ensure_size(system_size sz)
 {
-    if (ssize(system_rhs) != sz) { system_rhs = field{sz}; }
+    if (ssize(system_rhs) != sz) { system_rhs = slab_field{sz}; }
 }
 
 void euler::operator()(
     system& system, const field& u0, field_span u, const step_controller& step, real dt)
 {
     const real time = step;
-    system_rhs = 0;
-
     system_rhs = system.rhs(u0, time);
-    u = u0 + dt * system_rhs;
+    axpy_update(u, u0, system_rhs, dt);
     system.update_boundary(u, time + dt);
 }
 
@@ -0,0 +1,160 @@
+#include "implicit.hpp"
+#include "step_controller.hpp"
+#include "systems/system.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numbers>
+
+namespace ccs::integrators
+{
+
+namespace
+{
+// the contiguous parts of a scalar in D, Rx, Ry, Rz order
+template <typename S>
+auto parts(S&& s)
+{
+    using namespace si;
+    return std::array{std::span{get<D>(s)},
+                      std::span{get<Rx>(s)},
+                      std::span{get<Ry>(s)},
+                      std::span{get<Rz>(s)}};
+}
+
+// copy the scalars of `f` to the flat vector `out`
+void gather(const field& f, std::span<real> out)
+{
+    auto it = out.begin();
+    for (auto&& s : f.scalars())
+        for (auto part : parts(s)) it = std::ranges::copy(part, it).out;
+}
+
+void scatter(std::span<const real> in, field& f)
+{
+    auto it = in.begin();
+    for (auto&& s : f.scalars())
+        for (auto part : parts(s)) {
+            std::copy(it, it + part.size(), part.begin());
+            it += part.size();
+        }
+}
+
+constexpr real sdirk2_gamma = 1.0 - 1.0 / std::numbers::sqrt2;
+} // namespace
+
+const implicit_scheme implicit::backward_euler{1, {{{1.0}}}, {1.0}};
+
+const implicit_scheme implicit::crank_nicolson{2, {{{}, {0.5, 0.5}}}, {0.0, 1.0}};
+
+const implicit_scheme implicit::sdirk2{
+    2, {{{sdirk2_gamma}, {1.0 - sdirk2_gamma, sdirk2_gamma}}}, {sdirk2_gamma, 1.0}};
+
+const implicit_scheme implicit::imex_euler{1, {{{1.0}}}, {1.0}, true};
+
+void implicit::ensure_size(system_size sz)
+{
+    if (ssize(r) != sz) {
+        k.assign(scheme->stages, field{sz});
+        r = field{sz};
+        p = field{sz};
+        q = field{sz};
+        // the buffers of p and q stay put when the integrator is moved
+        p_view = field_view{p};
+        q_span = field_span{q};
+
+        integer n = 0;
+        for (auto&& s : r.scalars())
+            for (auto part : parts(s)) n += part.size();
+
+        b_flat.assign(n, 0.0);
+        x_flat.assign(n, 0.0);
+        solver.reserve(n);
+    }
+}
+
+//
+// d = (I - gamma J)^-1 r with r cleared on the dirichlet points.  False if GMRES did
+// not converge
+//
+bool implicit::solve(system& system, real gamma, field& d)
+{
+    system.clear_boundary(r);
+    gather(r, b_flat);
+    std::ranges::fill(x_flat, 0.0);
+
+    last = solver(
+        [&](std::span<const real> x, std::span<real> y) {
+            scatter(x, p);
+            system.linear_rhs(p_view, q_span);
+            gather(q, y);
+            for (std::size_t i = 0; i < y.size(); i++) y[i] = x[i] - gamma * y[i];
+        },
+        b_flat,
+        x_flat);
+
+    if (!last.converged)
+        logger(spdlog::level::warn,
+               "gmres did not converge after {} iterations, relative residual {}",
+               last.iterations,
+               last.residual);
+
+    scatter(x_flat, d);
+    return last.converged;
+}
+
+std::optional<real> implicit::error_estimate() const
+{
+    if (converged) return std::nullopt;
+    return std::numeric_limits<real>::infinity();
+}
+
+void implicit::operator()(system& system,
+                          const field& u0,
+                          field_span u,
+                          const step_controller& controller,
+                          real dt)
+{
+    const auto& a = scheme->a;
+    const auto& c = scheme->c;
+    const real time = controller;
+    converged = true;
+
+    if (scheme->imex) {
+        // explicit step with everything but J, then u + d = u + dt J (u + d)
+        k[0] = system.rhs(u0, time);
+        system.linear_rhs(u0, q_span);
+        u = u0 + dt * (k[0] - q);
+        system.update_boundary(u, time + dt);
+
+        system.linear_rhs(u, q_span);
+        r = dt * q;
+        converged = solve(system, dt, k[0]);
+        u += k[0];
+        system.update_boundary(u, time + dt);
+        return;
+    }
+
+    for (int i = 0; i < scheme->stages; i++) {
+        const real t = time + dt * c[i];
+        const real g = dt * a[i][i];
+
+        u = u0;
+        for (int j = 0; j < i; j++)
+            if (a[i][j] != 0.0) u += dt * a[i][j] * k[j];
+        system.update_boundary(u, t);
+        k[i] = system.rhs(u, t);
+
+        if (g == 0.0) continue;
+
+        // the change d of the stage satisfies d = g F(u + d) = g (F(u) + J d) after
+        // which F(u + d) = d / g
+        r = g * k[i];
+        converged = solve(system, g, k[i]) && converged;
+        u += k[i];
+        system.update_boundary(u, t);
+        k[i] *= 1.0 / g;
+    }
+}
+} // namespace ccs::integrators
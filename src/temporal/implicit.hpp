@@ -0,0 +1,93 @@
+#pragma once
+
+#include "fields/field.hpp"
+#include "io/logging.hpp"
+#include "matrices/gmres.hpp"
+
+#include <array>
+#include <optional>
+#include <vector>
+
+namespace ccs
+{
+// Forward decls
+class system;
+class step_controller;
+
+namespace integrators
+{
+
+// Butcher tableau of a stiffly accurate diagonally implicit Runge-Kutta scheme, so the
+// last stage is the solution.  Stages with a zero diagonal are explicit.  With `imex`
+// the scheme is forward-backward euler: only the linear part of the rhs is implicit
+struct implicit_scheme {
+    static constexpr int max_stages = 2;
+
+    int stages;
+    std::array<std::array<real, max_stages>, max_stages> a;
+    std::array<real, max_stages> c;
+    bool imex = false;
+};
+
+// Diagonally implicit and implicit-explicit schemes for systems whose rhs is its linear
+// part J u plus terms that do not depend on u, such as diffusion with boundary and
+// source data.  Each implicit stage solves (I - dt a_ii J) d = r for the change d from
+// an explicit guess with GMRES.  J is applied through system::linear_rhs, so the
+// derivative matrices are never formed.  The dirichlet points are held at the boundary
+// data by keeping them out of the residual.  For other systems a stage is a single
+// linearised step.
+//
+// The stage registers, the GMRES basis and the vectors it works on are allocated with
+// the field, along with the view and span of J's input and output, so the solves do not
+// allocate.  A step in which a solve does not converge reports an infinite error
+// estimate so the caller rejects it.
+class implicit
+{
+    const implicit_scheme* scheme = nullptr;
+    matrix::gmres solver;
+
+    std::vector<field> k;
+    field r;
+    // input and output of J inside the solver
+    field p;
+    field q;
+    field_view p_view;
+    field_span q_span;
+    // r and the solution of the linear system as flat vectors for the solver
+    std::vector<real> b_flat;
+    std::vector<real> x_flat;
+
+    // the last solve of the step and whether every solve of the step converged
+    matrix::gmres::result last{};
+    bool converged = true;
+    // reports stage solves that did not converge
+    logs logger{false, "implicit"};
+
+    bool solve(system&, real gamma, field& d);
+
+public:
+    implicit() = default;
+    implicit(const implicit_scheme& scheme,
+             matrix::gmres solver = {},
+             const logs& build_logger = {})
+        : scheme{&scheme}, solver{MOVE(solver)}, logger{build_logger, "implicit"}
+    {
+    }
+
+    void ensure_size(system_size);
+
+    void operator()(system&, const field&, field_span, const step_controller&, real);
+
+    const matrix::gmres::result& last_solve() const { return last; }
+
+    // infinite if a solve of the last step did not converge
+    std::optional<real> error_estimate() const;
+
+    static const implicit_scheme backward_euler;
+    static const implicit_scheme crank_nicolson;
+    // Alexander's two stage, second order, L-stable scheme
+    static const implicit_scheme sdirk2;
+    static const implicit_scheme imex_euler;
+};
+} // namespace integrators
+} // namespace ccs
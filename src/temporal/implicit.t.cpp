@@ -0,0 +1,127 @@
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <sol/sol.hpp>
+#include <spdlog/spdlog.h>
+
+#include "integrator.hpp"
+#include "systems/system.hpp"
+#include "test_problems.hpp"
+
+#include <range/v3/all.hpp>
+
+using namespace ccs;
+
+TEST_CASE("integrator - implicit")
+{
+    sol::state lua;
+    testing::cubic_heat(lua, R"(type = "backward euler", gmres = { tolerance = 1e-12 })");
+
+    auto sys_opt = system::from_lua(lua["simulation"]);
+    REQUIRE(!!sys_opt);
+    auto& sys = *sys_opt;
+
+    for (auto type : {"backward euler", "crank nicolson", "sdirk2", "imex euler"}) {
+        lua["simulation"]["integrator"]["type"] = type;
+        auto it_opt = integrator::from_lua(lua["simulation"]);
+        REQUIRE(!!it_opt);
+        auto& it = *it_opt;
+
+        auto st_opt = step_controller::from_lua(lua["simulation"]);
+        REQUIRE(!!st_opt);
+        auto& step = *st_opt;
+
+        field f{sys(step)};
+        sys.update_boundary(f, step);
+
+        field g{sys.size()};
+
+        // far beyond the explicit stability limit
+        const real dt = 100 * *sys.timestep_size(f, step);
+
+        g = it(sys, f, step, dt);
+        REQUIRE(!it.error_estimate());
+
+        step.advance(dt);
+
+        // the solution is linear in time so each scheme is exact up to the linear solves
+        auto stats = sys.stats(f, g, step);
+        REQUIRE_THAT(stats.stats[0], Catch::Matchers::WithinAbs(0.0, 1e-9));
+    }
+}
+
+TEST_CASE("stiff decay")
+{
+    sol::state lua;
+    testing::cubic_heat(lua, R"(type = "backward euler", gmres = { tolerance = 1e-12 })");
+
+    auto sys_opt = system::from_lua(lua["simulation"]);
+    REQUIRE(!!sys_opt);
+    auto& sys = *sys_opt;
+
+    // the L-stable schemes damp the stiffest modes in a single step
+    for (auto type : {"backward euler", "sdirk2", "imex euler"}) {
+        lua["simulation"]["integrator"]["type"] = type;
+        auto it_opt = integrator::from_lua(lua["simulation"]);
+        REQUIRE(!!it_opt);
+        auto& it = *it_opt;
+
+        auto st_opt = step_controller::from_lua(lua["simulation"]);
+        REQUIRE(!!st_opt);
+        auto& step = *st_opt;
+
+        // a sawtooth on top of the exact solution excites the highest frequencies
+        constexpr real amplitude = 1e-3;
+        field f{sys(step)};
+        auto&& d = get<si::D>(f.scalars(0));
+        for (std::size_t i = 0; i < d.size(); i++) d[i] += i % 2 ? amplitude : -amplitude;
+        sys.update_boundary(f, step);
+        REQUIRE(sys.stats(f, f, step).stats[0] > 0.5 * amplitude);
+
+        field g{sys.size()};
+        const real dt = 100 * *sys.timestep_size(f, step);
+
+        for (int i = 0; i < 10; i++) {
+            g = it(sys, f, step, dt);
+            REQUIRE(!it.error_estimate());
+            step.advance(dt);
+            std::swap(f, g);
+        }
+
+        auto stats = sys.stats(f, f, step);
+        REQUIRE(stats.stats[0] < 1e-2 * amplitude);
+    }
+}
+
+TEST_CASE("unconverged solves")
+{
+    sol::state lua;
+    testing::cubic_heat(lua,
+                        R"(type = "backward euler",
+                           gmres = { tolerance = 1e-14, max_iterations = 1 })");
+
+    auto sys_opt = system::from_lua(lua["simulation"]);
+    REQUIRE(!!sys_opt);
+    auto& sys = *sys_opt;
+
+    auto it_opt = integrator::from_lua(lua["simulation"]);
+    REQUIRE(!!it_opt);
+    auto& it = *it_opt;
+
+    auto st_opt = step_controller::from_lua(lua["simulation"]);
+    REQUIRE(!!st_opt);
+    auto& step = *st_opt;
+
+    field f{sys(step)};
+    sys.update_boundary(f, step);
+
+    field g{sys.size()};
+    const real dt = 100 * *sys.timestep_size(f, step);
+
+    // the step is rejected rather than taken with an inaccurate solve
+    g = it(sys, f, step, dt);
+    REQUIRE(it.error_estimate());
+    REQUIRE(!step.accept(*it.error_estimate(), dt, it.error_order()));
+    REQUIRE(*step.adaptive_timestep() < dt);
+}
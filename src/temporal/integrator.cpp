@@ -1,8 +1,11 @@
 #include "integrator.hpp"
+#include "stability.hpp"
 #include "systems/system.hpp"
 
 #include <sol/sol.hpp>
 
+#include <map>
+
 namespace ccs
 {
 
@@ -22,6 +25,69 @@ std::function<void(field_span)> integrator::operator()(system& s,
         v);
 }
 
+real integrator::max_stable_step(std::span<const std::complex<real>> eigenvalues) const
+{
+    return std::visit(
+        [eigenvalues](auto&& integrator_v) {
+            if constexpr (requires { integrator_v.stability_polynomial(); })
+                return ccs::max_stable_step(integrator_v.stability_polynomial(),
+                                            eigenvalues);
+            else
+                return ccs::max_stable_step({}, eigenvalues);
+        },
+        v);
+}
+
+bool integrator::in_place() const
+{
+    return std::holds_alternative<integrators::low_storage>(v);
+}
+
+bool integrator::prepare(system& s, const logs& logger)
+{
+    return std::visit(
+        [&s, &logger](auto&& integrator_v) {
+            if constexpr (requires { integrator_v.prepare(s, logger); })
+                return integrator_v.prepare(s, logger);
+            else
+                return true;
+        },
+        v);
+}
+
+std::optional<real> integrator::error_estimate() const
+{
+    return std::visit(
+        [](auto&& integrator_v) -> std::optional<real> {
+            if constexpr (requires { integrator_v.error_estimate(); })
+                return integrator_v.error_estimate();
+            else
+                return std::nullopt;
+        },
+        v);
+}
+
+int integrator::error_order() const
+{
+    return std::visit(
+        [](auto&& integrator_v) {
+            if constexpr (requires { integrator_v.error_order(); })
+                return integrator_v.error_order();
+            else
+                return 0;
+        },
+        v);
+}
+
+namespace
+{
+const std::map<std::string, const integrators::implicit_scheme*> implicit_schemes{
+    {"backward euler", &integrators::implicit::backward_euler},
+    {"crank nicolson", &integrators::implicit::crank_nicolson},
+    {"sdirk2", &integrators::implicit::sdirk2},
+    {"imex euler", &integrators::implicit::imex_euler}};
+} // namespace
+
 std::optional<integrator> integrator::from_lua(const sol::table& tbl, const logs& logger)
 {
 
@@ -40,8 +106,41 @@ std::optional<integrator> integrator::from_lua(const sol::table& tbl, const logs
     } else if (type == "euler") {
         logger(spdlog::level::info, "building euler integrator");
         return integrator{integrators::euler{}};
+    } else if (type == "low storage rk3") {
+        logger(spdlog::level::info, "building low storage rk3 integrator");
+        return integrator{integrators::low_storage{integrators::low_storage::rk3}};
+    } else if (type == "low storage rk4") {
+        logger(spdlog::level::info, "building low storage rk4 integrator");
+        return integrator{integrators::low_storage{integrators::low_storage::rk4}};
+    } else if (type == "bogacki shampine") {
+        logger(spdlog::level::info, "building bogacki shampine 3(2) integrator");
+        return integrator{integrators::embedded{integrators::embedded::bs32}};
+    } else if (type == "dormand prince") {
+        logger(spdlog::level::info, "building dormand prince 5(4) integrator");
+        return integrator{integrators::embedded{integrators::embedded::dp54}};
+    } else if (type == "rkc") {
+        // estimated from the system when not given
+        sol::optional<real> rho = m["spectral_radius"];
+        if (rho && !(*rho > 0)) {
+            logger(spdlog::level::err, "integrator.spectral_radius must be positive");
+            return std::nullopt;
+        }
+        logger(spdlog::level::info, "building runge kutta chebyshev integrator");
+        return integrator{
+            integrators::rkc{rho ? std::optional<real>{*rho} : std::nullopt}};
+    } else if (auto it = implicit_schemes.find(type); it != implicit_schemes.end()) {
+        // the linear systems are solved to a tolerance relative to the stage residual
+        auto g = m["gmres"];
+        auto solver = matrix::gmres{g["restart"].get_or(30),
+                                    g["tolerance"].get_or(1e-10),
+                                    g["max_iterations"].get_or(500)};
+        logger(spdlog::level::info, "building {} integrator", type);
+        return integrator{integrators::implicit{*it->second, MOVE(solver), logger}};
     } else {
-        logger(spdlog::level::err, "integrator.type must be one of: [rk4, euler]");
+        logger(spdlog::level::err,
+               "integrator.type must be one of: [rk4, euler, low storage rk3, low "
+               "storage rk4, bogacki shampine, dormand prince, rkc, backward euler, "
+               "crank nicolson, sdirk2, imex euler]");
         return std::nullopt;
     }
 }
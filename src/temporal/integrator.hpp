@@ -1,15 +1,20 @@
 #pragma once
 
+#include <complex>
 #include <functional>
 #include <optional>
 #include <sol/forward.hpp>
 #include <variant>
 
+#include "embedded.hpp"
 #include "empty_integrator.hpp"
 #include "euler.hpp"
 #include "fields/field.hpp"
+#include "implicit.hpp"
 #include "io/logging.hpp"
+#include "low_storage.hpp"
 #include "rk4.hpp"
+#include "rkc.hpp"
 #include "types.hpp"
 
 namespace ccs
@@ -19,7 +24,14 @@ class system;
 
 class integrator
 {
-    std::variant<integrators::empty, integrators::rk4, integrators::euler> v;
+    std::variant<integrators::empty,
+                 integrators::rk4,
+                 integrators::euler,
+                 integrators::low_storage,
+                 integrators::embedded,
+                 integrators::rkc,
+                 integrators::implicit>
+        v;
     using v_t = decltype(v);
 
 public:
@@ -32,6 +44,24 @@ public:
     std::function<void(field_span)>
     operator()(system&, const field&, const step_controller&, real dt);
 
+    // largest stable step for a right hand side with these eigenvalues.  Infinite for
+    // integrators without a stability polynomial.  See max_stable_step
+    real max_stable_step(std::span<const std::complex<real>> eigenvalues) const;
+
+    // true if the integrator may write its result over the solution it started from so
+    // the caller need not keep a second copy of the solution
+    bool in_place() const;
+
+    // called once the system to integrate is known and before the first step.  False if
+    // the integrator cannot be used with it
+    bool prepare(system&, const logs& = {});
+
+    // weighted norm of the error of the last step for integrators with an error
+    // estimate, along with the order of the estimate.  The implicit integrators report
+    // an infinite error for a step whose linear solves did not converge
+    std::optional<real> error_estimate() const;
+    int error_order() const;
+
     static std::optional<integrator> from_lua(const sol::table&, const logs& = {});
 };
 
@@ -0,0 +1,92 @@
+#include "low_storage.hpp"
+#include "step_controller.hpp"
+#include "systems/system.hpp"
+
+namespace ccs::integrators
+{
+
+namespace
+{
+// The stability polynomial follows from applying the scheme to u' = lambda u with
+// z = dt lambda.  `u` and `du` hold polynomials in z
+using coefficients = std::array<real, low_storage_scheme::max_stages>;
+
+constexpr low_storage_scheme
+make_scheme(int stages, coefficients a, coefficients b, coefficients c)
+{
+    std::array<real, low_storage_scheme::max_stages + 1> u{1.0};
+    std::array<real, low_storage_scheme::max_stages + 1> du{};
+
+    for (int i = 0; i < stages; i++) {
+        for (int j = stages; j >= 0; j--)
+            du[j] = a[i] * du[j] + (j > 0 ? u[j - 1] : 0.0);
+        for (int j = 0; j <= stages; j++) u[j] += b[i] * du[j];
+    }
+
+    return {stages, a, b, c, u};
+}
+} // namespace
+
+const low_storage_scheme low_storage::rk3 =
+    make_scheme(3,
+                {0.0, -5.0 / 9.0, -153.0 / 128.0},
+                {1.0 / 3.0, 15.0 / 16.0, 8.0 / 15.0},
+                {0.0, 1.0 / 3.0, 3.0 / 4.0});
+
+const low_storage_scheme low_storage::rk4 =
+    make_scheme(5,
+                {0.0,
+                 -567301805773.0 / 1357537059087.0,
+                 -2404267990393.0 / 2016746695238.0,
+                 -3550918686646.0 / 2091501179385.0,
+                 -1275806237668.0 / 842570457699.0},
+                {1432997174477.0 / 9575080441755.0,
+                 5161836677717.0 / 13612068292357.0,
+                 1720146321549.0 / 2090206949498.0,
+                 3134564353537.0 / 4481467310338.0,
+                 2277821191437.0 / 14882151754819.0},
+                {0.0,
+                 1432997174477.0 / 9575080441755.0,
+                 2526269341429.0 / 6820363962896.0,
+                 2006345519317.0 / 3224310063776.0,
+                 2802321613138.0 / 2924317926251.0});
+
+std::span<const real> low_storage::stability_polynomial() const
+{
+    return std::span<const real>(scheme->stability).first(scheme->stages + 1);
+}
+
+void low_storage::ensure_size(system_size sz)
+{
+    if (ssize(du) != sz) {
+        du = field{sz};
+        system_rhs = field{sz};
+    }
+}
+
+void low_storage::operator()(system& system,
+                             const field& u0,
+                             field_span u,
+                             const step_controller& controller,
+                             real dt)
+{
+    const auto& a = scheme->a;
+    const auto& b = scheme->b;
+    const auto& c = scheme->c;
+    const real time = controller;
+
+    // the first stage is written out so u0 is not read once u has been written
+    system_rhs = system.rhs(u0, time);
+    du = dt * system_rhs;
+    u = u0 + b[0] * du;
+
+    for (int i = 1; i < scheme->stages; ++i) {
+        system.update_boundary(u, time + dt * c[i]);
+        system_rhs = system.rhs(u, time + dt * c[i]);
+        du = a[i] * du + dt * system_rhs;
+        u += b[i] * du;
+    }
+
+    system.update_boundary(u, time + dt);
+}
+} // namespace ccs::integrators
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "fields/field.hpp"
+
+#include <array>
+
+namespace ccs
+{
+// Forward decls
+class system;
+class step_controller;
+
+namespace integrators
+{
+
+// Coefficients of a 2N-storage Runge-Kutta scheme in Williamson's form
+//
+//      du_i = a_i du_{i-1} + dt f(t + c_i dt, u_{i-1})
+//      u_i  = u_{i-1} + b_i du_i
+//
+// with a_0 = 0 so the first stage does not read du
+struct low_storage_scheme {
+    static constexpr int max_stages = 5;
+
+    int stages;
+    std::array<real, max_stages> a;
+    std::array<real, max_stages> b;
+    std::array<real, max_stages> c;
+    // coefficients of the stability polynomial R(z) in increasing powers of z
+    std::array<real, max_stages + 1> stability;
+};
+
+// Explicit Runge-Kutta schemes which only keep the solution, one accumulation register
+// and the right hand side.  The solution from the previous step is only read in the
+// first stage so the update may be done in place, with `u0` and `u` the same field.
+// Systems overwrite the field given to their rhs rather than adding to it, so dt f
+// cannot be accumulated into du directly and the rhs needs a register of its own
+class low_storage
+{
+    const low_storage_scheme* scheme = nullptr;
+    field du;
+    field system_rhs;
+
+public:
+    low_storage() = default;
+    low_storage(const low_storage_scheme& scheme) : scheme{&scheme} {}
+
+    void ensure_size(system_size);
+
+    void operator()(system&, const field&, field_span, const step_controller&, real);
+
+    std::span<const real> stability_polynomial() const;
+
+    // Williamson's third order, three stage scheme
+    static const low_storage_scheme rk3;
+    // Carpenter and Kennedy's fourth order, five stage scheme (solution 3)
+    static const low_storage_scheme rk4;
+};
+} // namespace integrators
+} // namespace ccs
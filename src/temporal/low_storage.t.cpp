@@ -0,0 +1,79 @@
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <sol/sol.hpp>
+#include <spdlog/spdlog.h>
+
+#include "integrator.hpp"
+#include "systems/system.hpp"
+#include "test_problems.hpp"
+
+#include <range/v3/all.hpp>
+
+using namespace ccs;
+
+TEST_CASE("integrator - low storage")
+{
+    sol::state lua;
+    testing::cubic_heat(lua, R"(type = "low storage rk4")");
+
+    auto sys_opt = system::from_lua(lua["simulation"]);
+    REQUIRE(!!sys_opt);
+    auto& sys = *sys_opt;
+
+    for (auto type : {"low storage rk3", "low storage rk4"}) {
+        lua["simulation"]["integrator"]["type"] = type;
+        auto it_opt = integrator::from_lua(lua["simulation"]);
+        REQUIRE(!!it_opt);
+        auto& it = *it_opt;
+        REQUIRE(it.in_place());
+
+        auto st_opt = step_controller::from_lua(lua["simulation"]);
+        REQUIRE(!!st_opt);
+        auto& step = *st_opt;
+
+        field f{sys(step)};
+        sys.update_boundary(f, step);
+
+        const real dt = *sys.timestep_size(f, step);
+
+        // the solution is overwritten in place
+        f = it(sys, f, step, dt);
+
+        step.advance(dt);
+
+        // at this point, all fluid points in f should have a value of m_sol(time, loc)
+        auto stats = sys.stats(f, f, step);
+        REQUIRE_THAT(stats.stats[0], Catch::Matchers::WithinAbs(0.0, 1e-13));
+    }
+}
+
+TEST_CASE("order of accuracy")
+{
+    sol::state lua;
+    testing::forced_heat(lua, "");
+
+    using P = std::pair<const char*, int>;
+    for (auto [type, order] : {P{"low storage rk3", 3}, P{"low storage rk4", 4}}) {
+        lua["simulation"]["integrator"]["type"] = type;
+        REQUIRE(testing::observed_order(lua["simulation"], 2.0, 4) > order - 0.2);
+    }
+}
+
+TEST_CASE("stability polynomial")
+{
+    using integrators::low_storage;
+
+    // R(z) matches exp(z) up to the order of the scheme
+    const std::array taylor{1.0, 1.0, 1.0 / 2.0, 1.0 / 6.0, 1.0 / 24.0};
+
+    auto rk3 = low_storage{low_storage::rk3}.stability_polynomial();
+    REQUIRE(rk3.size() == 4u);
+    for (int i = 0; i < 4; i++) REQUIRE(rk3[i] == Catch::Approx(taylor[i]));
+
+    auto rk4 = low_storage{low_storage::rk4}.stability_polynomial();
+    REQUIRE(rk4.size() == 6u);
+    for (int i = 0; i < 5; i++) REQUIRE(rk4[i] == Catch::Approx(taylor[i]));
+    REQUIRE(rk4[5] == Catch::Approx(1.0 / 200.0));
+}
@@ -1,4 +1,5 @@
 #include "rk4.hpp"
+#include "stage_update.hpp"
 #include "step_controller.hpp"
 #include "systems/system.hpp"
 
@@ -7,12 +8,15 @@ namespace ccs::integrators
 
 constexpr std::array rki{0.0, 0.5, 0.5, 1.0};
 constexpr std::array rkf{1.0 / 6.0, 1.0 / 3.0, 1.0 / 3.0, 1.0 / 6.0};
+constexpr std::array stability{1.0, 1.0, 1.0 / 2.0, 1.0 / 6.0, 1.0 / 24.0};
+
+std::span<const real> rk4::stability_polynomial() { return stability; }
 
 void rk4::ensure_size(system_size sz)
 {
     if (ssize(rk_rhs) != sz) {
-        rk_rhs = field{sz};
-        system_rhs = field{sz};
+        rk_rhs = slab_field{sz};
+        system_rhs = slab_field{sz};
     }
 }
 
@@ -22,22 +26,24 @@ void rk4::operator()(system& system,
                      const step_controller& controller,
                      real dt)
 {
-    rk_rhs = 0;
-    system_rhs = 0;
     const real time = controller;
-    u = u0;
 
+    // Each stage evaluates the rhs and then makes one fused pass that accumulates
+    // dt * rkf[i] * rhs into rk_rhs and forms the state for the next stage
     for (int i = 0; i < 4; ++i) {
-        if (i > 0) {
-            u = u0 + dt * rki[i] * system_rhs;
+        if (i == 0) {
+            system_rhs = system.rhs(u0, time);
+        } else {
             system.update_boundary(u, time + dt * rki[i]);
+            system_rhs = system.rhs(u, time + dt * rki[i]);
         }
-        system_rhs = system.rhs(u, time + dt * rki[i]);
-        rk_rhs += dt * rkf[i] * system_rhs;
+
+        if (i < 3)
+            stage_update(u, u0, system_rhs, dt * rki[i + 1], rk_rhs, dt * rkf[i], i > 0);
+        else
+            final_update(u, u0, rk_rhs, system_rhs, dt * rkf[i]);
     }
 
-    // final update
-    u = u0 + rk_rhs;
     system.update_boundary(u, time + dt);
 }
 } // namespace ccs::integrators
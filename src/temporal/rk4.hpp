@@ -1,6 +1,6 @@
 #pragma once
 
-#include "fields/field.hpp"
+#include "fields/slab_field.hpp"
 
 namespace ccs
 {
@@ -13,14 +13,17 @@ namespace integrators
 
 class rk4
 {
-    field rk_rhs;
-    field system_rhs;
+    slab_field rk_rhs;
+    slab_field system_rhs;
 
 public:
     rk4() = default;
     void ensure_size(system_size);
 
     void operator()(system&, const field&, field_span, const step_controller&, real);
+
+    // coefficients of the stability polynomial R(z) in increasing powers of z
+    static std::span<const real> stability_polynomial();
 };
 } // namespace integrators
 } // namespace ccs
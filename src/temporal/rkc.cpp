@@ -0,0 +1,131 @@
+#include "rkc.hpp"
+#include "step_controller.hpp"
+#include "systems/system.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+namespace ccs::integrators
+{
+
+namespace
+{
+// damping keeps the stability region away from the real axis
+constexpr real damping = 2.0 / 13.0;
+// the eigenvalue estimates are only accurate to a few digits
+constexpr real radius_safety = 1.1;
+} // namespace
+
+int rkc::stages(real z) { return std::max(2, 1 + (int)std::sqrt(1.54 * z + 1.0)); }
+
+//
+// stage coefficients from the Chebyshev polynomials T_j and their derivatives at w0
+//
+void rkc::coefficients(int stages)
+{
+    if (s == stages) return;
+    s = stages;
+
+    const real w0 = 1.0 + damping / (s * s);
+    std::vector<real> T(s + 1), dT(s + 1), ddT(s + 1), b(s + 1);
+    T[0] = 1.0;
+    T[1] = w0;
+    dT[0] = 0.0;
+    dT[1] = 1.0;
+    ddT[0] = 0.0;
+    ddT[1] = 0.0;
+    for (int j = 2; j <= s; j++) {
+        T[j] = 2 * w0 * T[j - 1] - T[j - 2];
+        dT[j] = 2 * T[j - 1] + 2 * w0 * dT[j - 1] - dT[j - 2];
+        ddT[j] = 4 * dT[j - 1] + 2 * w0 * ddT[j - 1] - ddT[j - 2];
+    }
+    const real w1 = dT[s] / ddT[s];
+
+    for (int j = 2; j <= s; j++) b[j] = ddT[j] / (dT[j] * dT[j]);
+    b[0] = b[1] = b[2];
+
+    mu.assign(s + 1, 0.0);
+    nu.assign(s + 1, 0.0);
+    mu_t.assign(s + 1, 0.0);
+    gamma_t.assign(s + 1, 0.0);
+    c.assign(s + 1, 0.0);
+
+    mu_t[1] = b[1] * w1;
+    for (int j = 2; j <= s; j++) {
+        mu[j] = 2 * b[j] * w0 / b[j - 1];
+        nu[j] = -b[j] / b[j - 2];
+        mu_t[j] = 2 * b[j] * w1 / b[j - 1];
+        gamma_t[j] = -(1 - b[j - 1] * T[j - 1]) * mu_t[j];
+        c[j] = w1 * ddT[j] / dT[j];
+    }
+    c[1] = c[2] / dT[2];
+}
+
+bool rkc::prepare(system& system, const logs& logger)
+{
+    if (rho) return true;
+
+    real r = 0.0;
+    for (auto&& e : system.dominant_eigenvalues()) r = std::max(r, std::abs(e));
+    // with a zero radius every step would silently use two stages
+    if (!(r > 0)) {
+        logger(spdlog::level::err,
+               "rkc needs integrator.spectral_radius when the system cannot estimate "
+               "its eigenvalues");
+        return false;
+    }
+
+    rho = radius_safety * r;
+    logger(spdlog::level::info, "rkc spectral radius estimated as {}", *rho);
+    return true;
+}
+
+void rkc::ensure_size(system_size sz)
+{
+    if (ssize(y1) != sz) {
+        y1 = field{sz};
+        y2 = field{sz};
+        f0 = field{sz};
+        f = field{sz};
+    }
+}
+
+void rkc::operator()(system& system,
+                     const field& u0,
+                     field_span u,
+                     const step_controller& controller,
+                     real dt)
+{
+    assert(rho && "rkc::prepare must succeed before stepping");
+    coefficients(stages(dt * *rho));
+
+    const real time = controller;
+
+    f0 = system.rhs(u0, time);
+    y1 = u0 + dt * mu_t[1] * f0;
+    system.update_boundary(y1, time + dt * c[1]);
+
+    // Y_j depends on Y_{j-1} and Y_{j-2}.  Y_{j-2} is overwritten by Y_j and the last
+    // stage is written to u
+    auto stage = [&](auto&& y, int j, const field& ym2) {
+        y = (1 - mu[j] - nu[j]) * u0 + mu[j] * y1 + nu[j] * ym2 + dt * mu_t[j] * f +
+            dt * gamma_t[j] * f0;
+    };
+
+    for (int j = 2; j <= s; j++) {
+        f = system.rhs(y1, time + dt * c[j - 1]);
+        const field& ym2 = j == 2 ? u0 : y2;
+
+        if (j < s) {
+            stage(y2, j, ym2);
+            system.update_boundary(y2, time + dt * c[j]);
+            swap(y1, y2);
+        } else {
+            stage(u, j, ym2);
+        }
+    }
+
+    system.update_boundary(u, time + dt);
+}
+} // namespace ccs::integrators
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "fields/field.hpp"
+#include "io/logging.hpp"
+
+#include <optional>
+#include <vector>
+
+namespace ccs
+{
+// Forward decls
+class system;
+class step_controller;
+
+namespace integrators
+{
+
+// Second order Runge-Kutta-Chebyshev scheme of Sommeijer, Shampine and Verwer for
+// problems whose eigenvalues lie near the negative real axis, such as diffusion.  The
+// stability interval of an s stage step grows as 0.65 s^2, so the number of stages is
+// picked from the spectral radius of the rhs and the step size.  The spectral radius is
+// either given or estimated from the system's dominant eigenvalues by prepare, which
+// fails for systems without them.  Four registers are used besides the solution.
+class rkc
+{
+    std::optional<real> rho;
+    field y1;
+    field y2;
+    field f0;
+    field f;
+
+    // coefficients of the last stage count
+    int s = 0;
+    std::vector<real> mu, nu, mu_t, gamma_t, c;
+
+    void coefficients(int stages);
+
+public:
+    rkc() = default;
+    rkc(std::optional<real> spectral_radius) : rho{spectral_radius} {}
+
+    bool prepare(system&, const logs&);
+
+    void ensure_size(system_size);
+
+    void operator()(system&, const field&, field_span, const step_controller&, real);
+
+    // stages needed for a stable step when dt times the spectral radius is `z`
+    static int stages(real z);
+};
+} // namespace integrators
+} // namespace ccs
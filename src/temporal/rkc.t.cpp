@@ -0,0 +1,85 @@
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <sol/sol.hpp>
+#include <spdlog/spdlog.h>
+
+#include "integrator.hpp"
+#include "systems/system.hpp"
+#include "test_problems.hpp"
+
+#include <range/v3/all.hpp>
+
+using namespace ccs;
+
+TEST_CASE("integrator - rkc")
+{
+    sol::state lua;
+    testing::cubic_heat(lua, R"(type = "rkc")");
+
+    auto sys_opt = system::from_lua(lua["simulation"]);
+    REQUIRE(!!sys_opt);
+    auto& sys = *sys_opt;
+
+    auto it_opt = integrator::from_lua(lua["simulation"]);
+    REQUIRE(!!it_opt);
+    auto& it = *it_opt;
+    REQUIRE(it.prepare(sys));
+
+    auto st_opt = step_controller::from_lua(lua["simulation"]);
+    REQUIRE(!!st_opt);
+    auto& step = *st_opt;
+
+    field f{sys(step)};
+    sys.update_boundary(f, step);
+
+    field g{sys.size()};
+
+    // well beyond the explicit stability limit
+    const real dt = 20 * *sys.timestep_size(f, step);
+
+    g = it(sys, f, step, dt);
+
+    step.advance(dt);
+
+    // at this point, all fluid points in g should have a value of m_sol(time, loc)
+    auto stats = sys.stats(f, g, step);
+    REQUIRE_THAT(stats.stats[0], Catch::Matchers::WithinAbs(0.0, 1e-12));
+}
+
+TEST_CASE("order of accuracy")
+{
+    sol::state lua;
+    testing::forced_heat(lua, R"(type = "rkc")");
+    // stiff enough for the steps to need more than the two stages of an explicit scheme
+    lua["simulation"]["system"]["diffusivity"] = 0.05;
+
+    REQUIRE(testing::observed_order(lua["simulation"], 2.0, 4) > 1.8);
+}
+
+TEST_CASE("spectral radius")
+{
+    // the empty system has no eigenvalue estimate
+    system sys{};
+    integrator estimated{integrators::rkc{std::nullopt}};
+    REQUIRE(!estimated.prepare(sys));
+
+    integrator given{integrators::rkc{1.0}};
+    REQUIRE(given.prepare(sys));
+}
+
+TEST_CASE("stages")
+{
+    using integrators::rkc;
+
+    REQUIRE(rkc::stages(0.0) == 2);
+    REQUIRE(rkc::stages(1.0) == 2);
+
+    // the stability interval of s stages is about 0.65 s^2
+    for (real z : {10.0, 100.0, 1000.0, 10000.0}) {
+        const int s = rkc::stages(z);
+        REQUIRE(0.65 * s * s >= z);
+        REQUIRE(0.65 * (s - 2) * (s - 2) < z);
+    }
+}
@@ -0,0 +1,72 @@
+#include "stability.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace ccs
+{
+namespace
+{
+std::complex<real> evaluate(std::span<const real> poly, std::complex<real> z)
+{
+    std::complex<real> r{};
+    for (auto it = poly.rbegin(); it != poly.rend(); ++it) r = r * z + *it;
+    return r;
+}
+
+// roundoff in |R| near the origin is not taken as growth
+constexpr real growth_tol = 1e-12;
+
+bool stable(std::span<const real> poly, std::complex<real> z)
+{
+    return std::norm(evaluate(poly, z)) <= 1 + growth_tol;
+}
+
+// length of the stable part of the ray t z, t > 0, |z| = 1 starting at the origin
+real stable_length(std::span<const real> poly, std::complex<real> z)
+{
+    // every root of R(z) = w with |w| = 1 lies within this radius
+    real big = 0.0;
+    for (std::size_t i = 0; i + 1 < poly.size(); i++)
+        big = std::max(big, std::abs(poly[i]));
+    const real bound = 1 + (big + 1) / std::abs(poly.back());
+
+    // find the first unstable sample and refine the boundary by bisection.  A ray that
+    // is unstable at the first sample is taken to have no stable part
+    constexpr int samples = 2000;
+    const real dt = bound / samples;
+    real lo = 0.0;
+    for (int i = 1; i <= samples; i++) {
+        const real t = i * dt;
+        if (!stable(poly, t * z)) {
+            if (i == 1) return 0.0;
+            real hi = t;
+            for (int j = 0; j < 60; j++) {
+                const real mid = 0.5 * (lo + hi);
+                (stable(poly, mid * z) ? lo : hi) = mid;
+            }
+            return lo;
+        }
+        lo = t;
+    }
+    return bound;
+}
+} // namespace
+
+real max_stable_step(std::span<const real> poly,
+                     std::span<const std::complex<real>> eigenvalues)
+{
+    real dt = std::numeric_limits<real>::infinity();
+    if (poly.size() < 2) return dt;
+
+    for (auto&& lambda : eigenvalues) {
+        const auto z = std::complex<real>{std::min(lambda.real(), 0.0), lambda.imag()};
+        const real r = std::abs(z);
+        if (r == 0.0) continue;
+
+        dt = std::min(dt, stable_length(poly, z / r) / r);
+    }
+    return dt;
+}
+} // namespace ccs
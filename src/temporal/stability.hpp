@@ -0,0 +1,18 @@
+#pragma once
+
+#include "types.hpp"
+
+#include <complex>
+#include <span>
+
+namespace ccs
+{
+// Largest step size dt for which dt * lambda lies in the stability region
+// |R(z)| <= 1 of a one step method for each eigenvalue lambda of the right hand side.
+// R(z) = sum_i poly[i] z^i is the stability polynomial of the method.  Eigenvalues in
+// the right half plane are moved onto the imaginary axis since no step makes them
+// stable.  Returns zero if some eigenvalue is unstable for any step size and infinity if
+// there are no eigenvalues or no polynomial
+real max_stable_step(std::span<const real> poly,
+                     std::span<const std::complex<real>> eigenvalues);
+} // namespace ccs
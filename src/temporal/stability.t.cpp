@@ -0,0 +1,41 @@
+#include "stability.hpp"
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+using namespace ccs;
+using C = std::complex<real>;
+
+TEST_CASE("euler")
+{
+    const std::vector<real> poly{1.0, 1.0};
+
+    // the stability region is the unit disk centered at -1
+    REQUIRE(max_stable_step(poly, std::vector<C>{{-4.0, 0.0}}) == Catch::Approx(0.5));
+    REQUIRE(max_stable_step(poly, std::vector<C>{{-1.0, 1.0}}) == Catch::Approx(1.0));
+
+    // nothing on the imaginary axis is stable
+    REQUIRE(max_stable_step(poly, std::vector<C>{{-1.0, 0.0}, {0.0, 3.0}}) == 0.0);
+}
+
+TEST_CASE("rk4")
+{
+    const std::vector<real> poly{1.0, 1.0, 1.0 / 2, 1.0 / 6, 1.0 / 24};
+
+    // known extents of the region on the real and imaginary axes
+    REQUIRE(max_stable_step(poly, std::vector<C>{{-1.0, 0.0}}) ==
+            Catch::Approx(2.785293563405));
+    REQUIRE(max_stable_step(poly, std::vector<C>{{0.0, 2.0}}) ==
+            Catch::Approx(std::sqrt(2.0)));
+
+    // the most restrictive eigenvalue wins and positive real parts are ignored
+    REQUIRE(max_stable_step(poly, std::vector<C>{{-1.0, 0.0}, {1e-8, -2.0}}) ==
+            Catch::Approx(std::sqrt(2.0)));
+
+    REQUIRE(max_stable_step(poly, std::vector<C>{}) ==
+            std::numeric_limits<real>::infinity());
+}
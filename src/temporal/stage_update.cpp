@@ -0,0 +1,78 @@
+#include "stage_update.hpp"
+#include "fields/execution.hpp"
+#include "parallel/thread_pool.hpp"
+
+namespace ccs::integrators
+{
+
+namespace
+{
+// parts smaller than min_parallel_items are updated on the calling thread, as are the
+// assignments of field expressions
+template <typename F>
+void sweep(integer n, F&& f)
+{
+    parallel_for(n, min_parallel_items, [&f](integer first, integer last) {
+        for (integer i = first; i < last; ++i) f(i);
+    });
+}
+} // namespace
+
+void stage_update(const field_span& u,
+                  const field_view& u0,
+                  const field_view& f,
+                  real a,
+                  const field_span& acc,
+                  real b,
+                  bool accumulate)
+{
+    for_each_span(
+        [a, b, accumulate](auto u, auto u0, auto f, auto acc) {
+            const integer n = u.size();
+            if (accumulate)
+                sweep(n, [&](integer i) {
+                    const real fi = f[i];
+                    u[i] = u0[i] + a * fi;
+                    acc[i] += b * fi;
+                });
+            else
+                sweep(n, [&](integer i) {
+                    const real fi = f[i];
+                    u[i] = u0[i] + a * fi;
+                    acc[i] = b * fi;
+                });
+        },
+        u,
+        u0,
+        f,
+        acc);
+}
+
+void final_update(const field_span& u,
+                  const field_view& u0,
+                  const field_view& acc,
+                  const field_view& f,
+                  real b)
+{
+    for_each_span(
+        [b](auto u, auto u0, auto acc, auto f) {
+            sweep(u.size(), [&](integer i) { u[i] = u0[i] + acc[i] + b * f[i]; });
+        },
+        u,
+        u0,
+        acc,
+        f);
+}
+
+void axpy_update(const field_span& u, const field_view& u0, const field_view& f, real a)
+{
+    for_each_span(
+        [a](auto u, auto u0, auto f) {
+            sweep(u.size(), [&](integer i) { u[i] = u0[i] + a * f[i]; });
+        },
+        u,
+        u0,
+        f);
+}
+
+} // namespace ccs::integrators
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "fields/field.hpp"
+
+namespace ccs::integrators
+{
+// Fused register updates for the explicit Runge-Kutta schemes.  Each makes a single
+// pass over the contiguous parts of its fields, split across the default thread pool,
+// rather than one lazy expression per register.  The fields are taken by reference so
+// the registers of a slab_field are passed without copying its spans.
+
+// u = u0 + a * f and acc = b * f, or acc += b * f when `accumulate` is set
+void stage_update(const field_span& u,
+                  const field_view& u0,
+                  const field_view& f,
+                  real a,
+                  const field_span& acc,
+                  real b,
+                  bool accumulate);
+
+// u = u0 + acc + b * f
+void final_update(const field_span& u,
+                  const field_view& u0,
+                  const field_view& acc,
+                  const field_view& f,
+                  real b);
+
+// u = u0 + a * f
+void axpy_update(const field_span& u, const field_view& u0, const field_view& f, real a);
+
+} // namespace ccs::integrators
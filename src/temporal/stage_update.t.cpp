@@ -0,0 +1,92 @@
+#include "stage_update.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <cmath>
+
+using namespace ccs;
+using Catch::Matchers::WithinULP;
+
+namespace
+{
+const auto sz = system_size{2, 1, tuple{tuple{40}, tuple{3, 5, 7}}};
+
+field make_field(real offset)
+{
+    field f{sz};
+    real v = offset;
+    for_each_span(
+        [&v](auto s) {
+            for (auto& x : s) x = std::sin(v += 0.37);
+        },
+        f);
+    return f;
+}
+
+void require_equal(const field& a, const field& b)
+{
+    integer n = 0;
+    for_each_span(
+        [&n](auto x, auto y) {
+            REQUIRE(x.size() == y.size());
+            for (std::size_t i = 0; i < x.size(); ++i)
+                REQUIRE_THAT(x[i], WithinULP(y[i], 1));
+            n += x.size();
+        },
+        a,
+        b);
+    // 2 scalars and the 3 components of 1 vector
+    REQUIRE(n == 5 * (40 + 3 + 5 + 7));
+}
+} // namespace
+
+TEST_CASE("stage update")
+{
+    const field u0 = make_field(0.1);
+    const field f = make_field(1.3);
+    field acc = make_field(2.9);
+    field u{sz};
+
+    SECTION("assign")
+    {
+        field expected_acc{sz};
+        expected_acc = 0.25 * f;
+        field expected_u{sz};
+        expected_u = u0 + 0.5 * f;
+
+        integrators::stage_update(u, u0, f, 0.5, acc, 0.25, false);
+        require_equal(u, expected_u);
+        require_equal(acc, expected_acc);
+    }
+
+    SECTION("accumulate")
+    {
+        field expected_acc{acc};
+        expected_acc += 0.25 * f;
+        field expected_u{sz};
+        expected_u = u0 + 0.5 * f;
+
+        integrators::stage_update(u, u0, f, 0.5, acc, 0.25, true);
+        require_equal(u, expected_u);
+        require_equal(acc, expected_acc);
+    }
+
+    SECTION("final")
+    {
+        field expected_u{sz};
+        expected_u = u0 + acc + 0.125 * f;
+
+        integrators::final_update(u, u0, acc, f, 0.125);
+        require_equal(u, expected_u);
+    }
+
+    SECTION("axpy")
+    {
+        field expected_u{sz};
+        expected_u = u0 + 0.75 * f;
+
+        integrators::axpy_update(u, u0, f, 0.75);
+        require_equal(u, expected_u);
+    }
+}
@@ -2,6 +2,9 @@
 
 #include <sol/sol.hpp>
 
+#include <algorithm>
+#include <cmath>
+
 namespace ccs
 {
 std::optional<step_controller> step_controller::from_lua(const sol::table& tbl,
@@ -18,13 +21,66 @@ std::optional<step_controller> step_controller::from_lua(const sol::table& tbl,
     real min_dt = c["min_dt"].get_or(1e-6);
     real h_cfl = c["cfl"]["hyperbolic"].get_or(1.0);
     real p_cfl = c["cfl"]["parabolic"].get_or(1.0);
+    // "cfl" or "spectral" for the largest stable step of the integrator
+    std::string timestep = c["timestep"].get_or(std::string{"cfl"});
+    real safety = c["safety"].get_or(0.9);
+    // error tolerances for integrators with an embedded error estimate
+    real atol = c["tolerance"]["absolute"].get_or(1e-6);
+    real rtol = c["tolerance"]["relative"].get_or(1e-6);
+
+    if (timestep != "cfl" && timestep != "spectral") {
+        logger(spdlog::level::err,
+               "step_controller.timestep must be 'cfl' or 'spectral' not {}",
+               timestep);
+        return std::nullopt;
+    }
 
     // if neither are specied (i.e. for eigenvalue analysis then do zero steps)
     if (max_step == std::numeric_limits<int>::max() &&
         max_time == std::numeric_limits<real>::max())
         max_step = 0;
 
-    return step_controller{
-        bounded<int>{max_step}, bounded<real>{max_time}, h_cfl, p_cfl, min_dt};
+    return step_controller{bounded<int>{max_step},
+                           bounded<real>{max_time},
+                           h_cfl,
+                           p_cfl,
+                           min_dt,
+                           timestep == "spectral",
+                           safety,
+                           atol,
+                           rtol};
+}
+
+bool step_controller::accept(real err, real dt, int order)
+{
+    // gains of the PI controller and the limits on the change in step size
+    const real alpha = 0.7 / (order + 1);
+    const real beta = 0.4 / (order + 1);
+    constexpr real min_factor = 0.2;
+    constexpr real max_factor = 5.0;
+
+    if (!std::isfinite(err)) {
+        rejected = true;
+        adaptive_dt = min_factor * dt;
+        return false;
+    }
+
+    if (err > 1.0) {
+        // only the integral part is used after a rejection
+        const real factor = safety * std::pow(err, -1.0 / (order + 1));
+        adaptive_dt = dt * std::max(min_factor, factor);
+        rejected = true;
+        return false;
+    }
+
+    err = std::max(err, 1e-10);
+    real factor = safety * std::pow(err, -alpha) * std::pow(err_prev, beta);
+    // do not grow the step right after a rejection
+    factor = std::clamp(factor, min_factor, rejected ? 1.0 : max_factor);
+
+    adaptive_dt = dt * factor;
+    err_prev = err;
+    rejected = false;
+    return true;
 }
 } // namespace ccs
@@ -16,12 +16,39 @@ class step_controller
     real h_cfl;
     real p_cfl;
     real min_dt;
+    // when set the timestep comes from the spectrum of the system's right hand side
+    // rather than the cfl numbers.  `safety` scales the largest stable step
+    bool spectral = false;
+    real safety = 0.9;
+    std::optional<real> stable_dt;
+    // tolerances for integrators with an error estimate.  The step size is then chosen
+    // by a PI controller from the errors of the last two steps
+    real atol = 1e-6;
+    real rtol = 1e-6;
+    real err_prev = 1.0;
+    bool rejected = false;
+    std::optional<real> adaptive_dt;
 
 public:
     step_controller() = default;
-    step_controller(
-        bounded<int> step, bounded<real> time, real h_cfl, real p_cfl, real min_dt)
-        : step{step}, time{time}, h_cfl{h_cfl}, p_cfl{p_cfl}, min_dt{min_dt}
+    step_controller(bounded<int> step,
+                    bounded<real> time,
+                    real h_cfl,
+                    real p_cfl,
+                    real min_dt,
+                    bool spectral = false,
+                    real safety = 0.9,
+                    real atol = 1e-6,
+                    real rtol = 1e-6)
+        : step{step},
+          time{time},
+          h_cfl{h_cfl},
+          p_cfl{p_cfl},
+          min_dt{min_dt},
+          spectral{spectral},
+          safety{safety},
+          atol{atol},
+          rtol{rtol}
     {
     }
 
@@ -47,6 +74,21 @@ public:
     real parabolic_cfl() const { return p_cfl; }
     real hyperbolic_cfl() const { return h_cfl; }
 
+    bool spectral_timestep() const { return spectral; }
+
+    // record the largest stable timestep found by analysing the system.  The timestep
+    // used is this scaled by the safety factor
+    void set_stable_timestep(real dt) { stable_dt = safety * dt; }
+    std::optional<real> stable_timestep() const { return stable_dt; }
+
+    real absolute_tolerance() const { return atol; }
+    real relative_tolerance() const { return rtol; }
+
+    // Decide whether a step of size `dt` with weighted error norm `err` is accepted and
+    // choose the size of the next attempt.  `order` is the order of the error estimate
+    bool accept(real err, real dt, int order);
+    std::optional<real> adaptive_timestep() const { return adaptive_dt; }
+
     static std::optional<step_controller> from_lua(const sol::table&, const logs& = {});
 };
 } // namespace ccs
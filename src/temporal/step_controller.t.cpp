@@ -5,6 +5,8 @@
 
 #include <sol/sol.hpp>
 
+#include <limits>
+
 using namespace ccs;
 
 TEST_CASE("default")
@@ -61,3 +63,58 @@ TEST_CASE("from_lua")
     REQUIRE((real)step == 0.4);
     REQUIRE(!step);
 }
+
+TEST_CASE("spectral timestep")
+{
+    sol::state lua;
+    lua.script(R"(
+        simulation = {
+            step_controller = {
+                max_time = 1.0,
+                timestep = "spectral",
+                safety = 0.5
+            }
+        }
+    )");
+
+    auto step_opt = step_controller::from_lua(lua["simulation"]);
+    REQUIRE(step_opt);
+    auto& step = *step_opt;
+
+    REQUIRE(step.spectral_timestep());
+    REQUIRE(!step.stable_timestep());
+
+    step.set_stable_timestep(0.2);
+    REQUIRE(step.stable_timestep());
+    REQUIRE(*step.stable_timestep() == Catch::Approx(0.1));
+
+    lua.script("simulation.step_controller.timestep = 'fastest'");
+    REQUIRE(!step_controller::from_lua(lua["simulation"]));
+}
+
+TEST_CASE("pi controller")
+{
+    auto step = step_controller{};
+    REQUIRE(!step.adaptive_timestep());
+
+    // small errors grow the step by the largest factor
+    REQUIRE(step.accept(1e-12, 0.1, 2));
+    REQUIRE(*step.adaptive_timestep() == Catch::Approx(0.5));
+
+    // large errors are rejected and the step cut by at most a factor of 5
+    REQUIRE(!step.accept(100.0, 0.5, 2));
+    REQUIRE(*step.adaptive_timestep() == Catch::Approx(0.1));
+
+    // the step is not grown right after a rejection
+    REQUIRE(step.accept(1e-12, 0.1, 2));
+    REQUIRE(*step.adaptive_timestep() == Catch::Approx(0.1));
+    REQUIRE(step.accept(1e-12, 0.1, 2));
+    REQUIRE(*step.adaptive_timestep() == Catch::Approx(0.5));
+
+    // an error at the tolerance after much smaller ones shrinks the step
+    REQUIRE(step.accept(1.0, 0.1, 2));
+    REQUIRE(*step.adaptive_timestep() < 0.1);
+
+    REQUIRE(!step.accept(std::numeric_limits<real>::quiet_NaN(), 0.1, 2));
+    REQUIRE(*step.adaptive_timestep() == Catch::Approx(0.02));
+}
@@ -0,0 +1,182 @@
+#pragma once
+
+#include "integrator.hpp"
+#include "step_controller.hpp"
+#include "systems/system.hpp"
+
+#include <sol/sol.hpp>
+
+#include <cmath>
+#include <limits>
+#include <string>
+#include <utility>
+
+//
+// Heat problems shared by the integrator tests.  Each builds the table `simulation` in
+// `lua` with `integrator` as the body of its integrator table, e.g. `type = "rk4"`
+//
+namespace ccs::testing
+{
+
+// Dirichlet, neumann and floating boundaries around a dirichlet sphere.  The solution is
+// linear in time and cubic in space, which the E2 scheme differentiates exactly, so any
+// consistent integrator reproduces it to roundoff
+inline void cubic_heat(sol::state& lua, const std::string& integrator)
+{
+    lua.open_libraries(sol::lib::base, sol::lib::math);
+    lua.script(R"(
+        simulation = {
+            mesh = {
+                index_extents = {21, 22, 23},
+                domain_bounds = {
+                    min = {1, 1.1, 0.3},
+                    max = {3, 3.3, 2.2}
+                }
+            },
+            domain_boundaries = {
+                xmin = "dirichlet",
+                ymin = "neumann",
+                ymax = "neumann",
+                zmax = "dirichlet"
+            },
+            shapes = {
+                {
+                    type = "sphere",
+                    center = {2.0001, 2.5656565, 1.313131311},
+                    radius = 0.25,
+                    boundary_condition = "dirichlet"
+                }
+            },
+            scheme = {
+                order = 2,
+                type = "E2"
+            },
+            system = {
+                type = "heat",
+                diffusivity = 1.0
+            },
+            integrator = {)" +
+               integrator + R"(
+            },
+            step_controller = {
+                max_step = 1,
+            },
+            manufactured_solution = {
+                type = "lua",
+                call = function(time, loc)
+                    local x, y, z = loc[1], loc[2], loc[3]
+                    return (time +
+                        x * x * (y + z) + y * y * (x + z) + z * z * (x + y) +
+                        3 * x * y * z + x + y + z)
+                end,
+                ddt = function(time, loc)
+                    return 1.0
+                end,
+                grad = function(time, loc)
+                    local x, y, z = loc[1], loc[2], loc[3]
+                    return 2. * x * (y + z) + y * y + z * z + 3. * y * z + 1,
+                            x * x + 2. * y * (x + z) + z * z + 3. * x * z + 1,
+                            x * x + y * y + 2. * z * (x + y) + 3. * x * y + 1
+                end,
+                lap = function(time, loc)
+                    local x, y, z = loc[1], loc[2], loc[3]
+                    return 2. * (y + z) + 2. * (x + z) + 2. * (x + y)
+                end,
+                div = function(time, loc)
+                    return 0.0
+                end
+            }
+        }
+    )");
+}
+
+// Floating boundaries only, a small diffusivity and the solution sin(t) plus a cubic.
+// The cubic is again differentiated exactly so every point follows y' = cos(t) and the
+// error is that of the integrator alone
+inline void forced_heat(sol::state& lua, const std::string& integrator)
+{
+    lua.open_libraries(sol::lib::base, sol::lib::math);
+    lua.script(R"(
+        simulation = {
+            mesh = {
+                index_extents = {11, 11, 11},
+                domain_bounds = {
+                    min = {0, 0, 0},
+                    max = {2, 2, 2}
+                }
+            },
+            scheme = {
+                order = 2,
+                type = "E2"
+            },
+            system = {
+                type = "heat",
+                diffusivity = 0.001
+            },
+            integrator = {)" +
+               integrator + R"(
+            },
+            step_controller = {
+                max_step = 1000,
+            },
+            manufactured_solution = {
+                type = "lua",
+                call = function(time, loc)
+                    local x, y, z = loc[1], loc[2], loc[3]
+                    return math.sin(time) + x * x * y + y * z * z + x * y * z
+                end,
+                ddt = function(time, loc)
+                    return math.cos(time)
+                end,
+                grad = function(time, loc)
+                    local x, y, z = loc[1], loc[2], loc[3]
+                    return 2. * x * y + y * z, x * x + z * z + x * z, 2. * y * z + x * y
+                end,
+                lap = function(time, loc)
+                    return 4. * loc[2]
+                end,
+                div = function(time, loc)
+                    return 0.0
+                end
+            }
+        }
+    )");
+}
+
+// Max error of the solution after `steps` steps of size dt from time 0.  NaN if the
+// table does not build
+inline real integration_error(const sol::table& simulation, integer steps, real dt)
+{
+    constexpr auto nan = std::numeric_limits<real>::quiet_NaN();
+
+    auto sys = system::from_lua(simulation);
+    auto it = integrator::from_lua(simulation);
+    auto step = step_controller::from_lua(simulation);
+    if (!sys || !it || !step || !it->prepare(*sys)) return nan;
+
+    field f{(*sys)(*step)};
+    sys->update_boundary(f, *step);
+    field g{it->in_place() ? field{} : f};
+
+    for (integer i = 0; i < steps; i++) {
+        if (it->in_place()) {
+            f = (*it)(*sys, f, *step, dt);
+        } else {
+            g = (*it)(*sys, f, *step, dt);
+            std::swap(f, g);
+        }
+        step->advance(dt);
+    }
+
+    return sys->stats(f, f, *step).stats[0];
+}
+
+// The order of accuracy observed by halving the step size of a run to time `t`
+inline real observed_order(const sol::table& simulation, real t, integer steps)
+{
+    const real coarse = integration_error(simulation, steps, t / steps);
+    const real fine = integration_error(simulation, 2 * steps, t / (2 * steps));
+    return std::log2(coarse / fine);
+}
+
+} // namespace ccs::testing